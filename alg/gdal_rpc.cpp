@@ -38,6 +38,7 @@
 #include <algorithm>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -229,6 +230,16 @@ static void RPCComputeTerms(double dfLong, double dfLat, double dfHeight,
 /* ==================================================================== */
 /************************************************************************/
 
+/*! Window of the DEM, loaded in a single RasterIO() request */
+typedef struct
+{
+    const double *padfData;
+    int nXOff;
+    int nYOff;
+    int nXSize;
+    int nYSize;
+} GDALRPCDEMWindow;
+
 /*! DEM Resampling Algorithm */
 typedef enum
 {
@@ -269,6 +280,11 @@ typedef struct
     // the key is (nYBlock << 32) | nXBlock)
     lru11::Cache<uint64_t, std::shared_ptr<std::vector<double>>> *poCacheDEM;
 
+    // Last DEM window loaded by GDALRPCLoadDEMWindow(), reused by the next
+    // calls whose points fall within it.
+    std::vector<double> *padfDEMWindowBuffer;
+    GDALRPCDEMWindow sDEMWindow;
+
     OGRCoordinateTransformation *poCT;
 
     int nMaxIterations;
@@ -359,20 +375,15 @@ static double RPCEvaluate(const double *padfTerms, const double *padfCoefs)
 #endif
 
 /************************************************************************/
-/*                         RPCTransformPoint()                          */
+/*                       RPCNormalizeCoordinates()                      */
 /************************************************************************/
 
-static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
-                              double dfLong, double dfLat, double dfHeight,
-                              double *pdfPixel, double *pdfLine)
-
+static void
+RPCNormalizeCoordinates(const GDALRPCTransformInfo *psRPCTransformInfo,
+                        double dfLong, double dfLat, double dfHeight,
+                        double &dfNormalizedLong, double &dfNormalizedLat,
+                        double &dfNormalizedHeight)
 {
-    double adfTermsWithMargin[20 + 1] = {};
-    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
-    double *padfTerms =
-        adfTermsWithMargin +
-        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
-
     // Avoid dateline issues.
     double diffLong = dfLong - psRPCTransformInfo->sRPC.dfLONG_OFF;
     if (diffLong < -270)
@@ -384,14 +395,11 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
         diffLong -= 360;
     }
 
-    const double dfNormalizedLong =
-        diffLong / psRPCTransformInfo->sRPC.dfLONG_SCALE;
-    const double dfNormalizedLat =
-        (dfLat - psRPCTransformInfo->sRPC.dfLAT_OFF) /
-        psRPCTransformInfo->sRPC.dfLAT_SCALE;
-    const double dfNormalizedHeight =
-        (dfHeight - psRPCTransformInfo->sRPC.dfHEIGHT_OFF) /
-        psRPCTransformInfo->sRPC.dfHEIGHT_SCALE;
+    dfNormalizedLong = diffLong / psRPCTransformInfo->sRPC.dfLONG_SCALE;
+    dfNormalizedLat = (dfLat - psRPCTransformInfo->sRPC.dfLAT_OFF) /
+                      psRPCTransformInfo->sRPC.dfLAT_SCALE;
+    dfNormalizedHeight = (dfHeight - psRPCTransformInfo->sRPC.dfHEIGHT_OFF) /
+                         psRPCTransformInfo->sRPC.dfHEIGHT_SCALE;
 
     // The absolute values of the 3 above normalized values are supposed to be
     // below 1. Warn (as debug message) if it is not the case. We allow for some
@@ -441,6 +449,29 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
             }
         }
     }
+}
+
+/************************************************************************/
+/*                         RPCTransformPoint()                          */
+/************************************************************************/
+
+static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
+                              double dfLong, double dfLat, double dfHeight,
+                              double *pdfPixel, double *pdfLine)
+
+{
+    double adfTermsWithMargin[20 + 1] = {};
+    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
+    double *padfTerms =
+        adfTermsWithMargin +
+        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
+
+    double dfNormalizedLong = 0.0;
+    double dfNormalizedLat = 0.0;
+    double dfNormalizedHeight = 0.0;
+    RPCNormalizeCoordinates(psRPCTransformInfo, dfLong, dfLat, dfHeight,
+                            dfNormalizedLong, dfNormalizedLat,
+                            dfNormalizedHeight);
 
     RPCComputeTerms(dfNormalizedLong, dfNormalizedLat, dfNormalizedHeight,
                     padfTerms);
@@ -472,6 +503,154 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
                psRPCTransformInfo->sRPC.dfLINE_OFF + 0.5;
 }
 
+#ifdef USE_SSE2_OPTIM
+
+/************************************************************************/
+/*                         RPCTransformTwoPoints()                      */
+/************************************************************************/
+
+// Same as RPCTransformPoint(), but process two points at once, each one
+// in a lane of the SSE2 registers. The order of operations is the one of
+// RPCComputeTerms() and RPCEvaluate4(), so results are bit-identical.
+static void
+RPCTransformTwoPoints(const GDALRPCTransformInfo *psRPCTransformInfo,
+                      const double adfLong[2], const double adfLat[2],
+                      const double adfHeight[2], double adfPixel[2],
+                      double adfLine[2])
+{
+    double adfNormalizedLong[2];
+    double adfNormalizedLat[2];
+    double adfNormalizedHeight[2];
+    for (int i = 0; i < 2; i++)
+    {
+        RPCNormalizeCoordinates(psRPCTransformInfo, adfLong[i], adfLat[i],
+                                adfHeight[i], adfNormalizedLong[i],
+                                adfNormalizedLat[i], adfNormalizedHeight[i]);
+    }
+
+    const auto x = XMMReg2Double::Load2Val(adfNormalizedLong);
+    const auto y = XMMReg2Double::Load2Val(adfNormalizedLat);
+    const auto z = XMMReg2Double::Load2Val(adfNormalizedHeight);
+    const double dfOne = 1.0;
+    const XMMReg2Double aTerms[20] = {
+        XMMReg2Double::Load1ValHighAndLow(&dfOne),
+        x,
+        y,
+        z,
+        x * y,
+        x * z,
+        y * z,
+        x * x,
+        y * y,
+        z * z,
+        x * y * z,
+        x * x * x,
+        x * y * y,
+        x * z * z,
+        x * x * y,
+        y * y * y,
+        y * z * z,
+        x * x * z,
+        y * y * z,
+        z * z * z};
+
+    // RPCEvaluate4() accumulates even and odd terms separately, and then
+    // adds both sums. Do the same.
+    const double *padfCoefs = psRPCTransformInfo->padfCoeffs;
+    XMMReg2Double aSumEven[4] = {XMMReg2Double::Zero(), XMMReg2Double::Zero(),
+                                 XMMReg2Double::Zero(), XMMReg2Double::Zero()};
+    XMMReg2Double aSumOdd[4] = {XMMReg2Double::Zero(), XMMReg2Double::Zero(),
+                                XMMReg2Double::Zero(), XMMReg2Double::Zero()};
+    for (int i = 0; i < 20; i += 2)
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            aSumEven[k] +=
+                aTerms[i] *
+                XMMReg2Double::Load1ValHighAndLow(padfCoefs + 20 * k + i);
+            aSumOdd[k] +=
+                aTerms[i + 1] *
+                XMMReg2Double::Load1ValHighAndLow(padfCoefs + 20 * k + i + 1);
+        }
+    }
+    const auto lineNum = aSumEven[0] + aSumOdd[0];
+    const auto lineDen = aSumEven[1] + aSumOdd[1];
+    const auto sampNum = aSumEven[2] + aSumOdd[2];
+    const auto sampDen = aSumEven[3] + aSumOdd[3];
+    const auto resultX = sampNum / sampDen;
+    const auto resultY = lineNum / lineDen;
+
+    double adfResultX[2];
+    double adfResultY[2];
+    resultX.Store2Val(adfResultX);
+    resultY.Store2Val(adfResultY);
+
+    // RPCs are using the center of upper left pixel = 0,0 convention
+    // convert to top left corner = 0,0 convention used in GDAL.
+    for (int i = 0; i < 2; i++)
+    {
+        adfPixel[i] = adfResultX[i] * psRPCTransformInfo->sRPC.dfSAMP_SCALE +
+                      psRPCTransformInfo->sRPC.dfSAMP_OFF + 0.5;
+        adfLine[i] = adfResultY[i] * psRPCTransformInfo->sRPC.dfLINE_SCALE +
+                     psRPCTransformInfo->sRPC.dfLINE_OFF + 0.5;
+    }
+}
+
+#endif
+
+/************************************************************************/
+/*                         RPCTransformPoints()                         */
+/************************************************************************/
+
+// Transform in place the (padfX[i], padfY[i]) = (long, lat) points at height
+// padfHeight[i] to (pixel, line), for the points whose panSuccess[i] is TRUE.
+static void RPCTransformPoints(const GDALRPCTransformInfo *psRPCTransformInfo,
+                               int nPointCount, double *padfX, double *padfY,
+                               const double *padfHeight, const int *panSuccess)
+{
+#ifdef USE_SSE2_OPTIM
+    int anPending[2] = {0, 0};
+    int nPending = 0;
+    for (int i = 0; i < nPointCount; i++)
+    {
+        if (!panSuccess[i])
+            continue;
+        anPending[nPending++] = i;
+        if (nPending == 2)
+        {
+            const int i0 = anPending[0];
+            const int i1 = anPending[1];
+            const double adfLong[2] = {padfX[i0], padfX[i1]};
+            const double adfLat[2] = {padfY[i0], padfY[i1]};
+            const double adfHeight[2] = {padfHeight[i0], padfHeight[i1]};
+            double adfPixel[2];
+            double adfLine[2];
+            RPCTransformTwoPoints(psRPCTransformInfo, adfLong, adfLat,
+                                  adfHeight, adfPixel, adfLine);
+            padfX[i0] = adfPixel[0];
+            padfY[i0] = adfLine[0];
+            padfX[i1] = adfPixel[1];
+            padfY[i1] = adfLine[1];
+            nPending = 0;
+        }
+    }
+    if (nPending == 1)
+    {
+        const int i = anPending[0];
+        RPCTransformPoint(psRPCTransformInfo, padfX[i], padfY[i], padfHeight[i],
+                          padfX + i, padfY + i);
+    }
+#else
+    for (int i = 0; i < nPointCount; i++)
+    {
+        if (!panSuccess[i])
+            continue;
+        RPCTransformPoint(psRPCTransformInfo, padfX[i], padfY[i], padfHeight[i],
+                          padfX + i, padfY + i);
+    }
+#endif
+}
+
 /************************************************************************/
 /*                     GDALSerializeRPCDEMResample()                    */
 /************************************************************************/
@@ -551,13 +730,15 @@ static void *GDALCreateSimilarRPCTransformer(void *hTransformArg,
 
 static int GDALRPCGetDEMHeight(GDALRPCTransformInfo *psTransform,
                                const double dfXIn, const double dfYIn,
-                               double *pdfDEMH);
-
-static bool GDALRPCGetHeightAtLongLat(GDALRPCTransformInfo *psTransform,
-                                      const double dfXIn, const double dfYIn,
-                                      double *pdfHeight,
-                                      double *pdfDEMPixel = nullptr,
-                                      double *pdfDEMLine = nullptr)
+                               double *pdfDEMH,
+                               const GDALRPCDEMWindow *psWindow = nullptr);
+
+static bool
+GDALRPCGetHeightAtLongLat(GDALRPCTransformInfo *psTransform,
+                          const double dfXIn, const double dfYIn,
+                          double *pdfHeight, double *pdfDEMPixel = nullptr,
+                          double *pdfDEMLine = nullptr,
+                          const GDALRPCDEMWindow *psWindow = nullptr)
 {
     double dfVDatumShift = 0.0;
     double dfDEMH = 0.0;
@@ -592,7 +773,7 @@ static bool GDALRPCGetHeightAtLongLat(GDALRPCTransformInfo *psTransform,
         if (pdfDEMLine)
             *pdfDEMLine = dfY;
 
-        if (!GDALRPCGetDEMHeight(psTransform, dfX, dfY, &dfDEMH))
+        if (!GDALRPCGetDEMHeight(psTransform, dfX, dfY, &dfDEMH, psWindow))
         {
             // Try to handle the case where the DEM is in LL WGS84 and spans
             // over [-180,180], (or very close to it ), presumably with much
@@ -1109,6 +1290,7 @@ void GDALDestroyRPCTransformer(void *pTransformAlg)
     if (psTransform->poDS)
         GDALClose(psTransform->poDS);
     delete psTransform->poCacheDEM;
+    delete psTransform->padfDEMWindowBuffer;
     if (psTransform->poCT)
         OCTDestroyCoordinateTransformation(
             reinterpret_cast<OGRCoordinateTransformationH>(psTransform->poCT));
@@ -1392,8 +1574,26 @@ static double BiCubicKernel(double dfVal)
 
 static bool GDALRPCExtractDEMWindow(GDALRPCTransformInfo *psTransform, int nX,
                                     int nY, int nWidth, int nHeight,
-                                    double *padfOut)
+                                    double *padfOut,
+                                    const GDALRPCDEMWindow *psWindow)
 {
+    // If the request is within the preloaded window, just copy from it.
+    if (psWindow && nX >= psWindow->nXOff && nY >= psWindow->nYOff &&
+        nX + nWidth <= psWindow->nXOff + psWindow->nXSize &&
+        nY + nHeight <= psWindow->nYOff + psWindow->nYSize)
+    {
+        for (int j = 0; j < nHeight; j++)
+        {
+            memcpy(padfOut + j * nWidth,
+                   psWindow->padfData +
+                       static_cast<size_t>(nY - psWindow->nYOff + j) *
+                           psWindow->nXSize +
+                       (nX - psWindow->nXOff),
+                   nWidth * sizeof(double));
+        }
+        return true;
+    }
+
     constexpr int BLOCK_SIZE = 64;
 
     // Request the DEM by blocks of BLOCK_SIZE * BLOCK_SIZE and put them
@@ -1499,7 +1699,8 @@ static bool GDALRPCExtractDEMWindow(GDALRPCTransformInfo *psTransform, int nX,
 
 static int GDALRPCGetDEMHeight(GDALRPCTransformInfo *psTransform,
                                const double dfXIn, const double dfYIn,
-                               double *pdfDEMH)
+                               double *pdfDEMH,
+                               const GDALRPCDEMWindow *psWindow)
 {
     const int nRasterXSize = psTransform->poDS->GetRasterXSize();
     const int nRasterYSize = psTransform->poDS->GetRasterYSize();
@@ -1528,7 +1729,7 @@ static int GDALRPCGetDEMHeight(GDALRPCTransformInfo *psTransform,
         // Cubic interpolation.
         double adfElevData[16] = {0.0};
         if (!GDALRPCExtractDEMWindow(psTransform, dXNew, dYNew, 4, 4,
-                                     adfElevData))
+                                     adfElevData, psWindow))
         {
             return FALSE;
         }
@@ -1588,7 +1789,8 @@ static int GDALRPCGetDEMHeight(GDALRPCTransformInfo *psTransform,
 
         // Bilinear interpolation.
         double adfElevData[4] = {0.0, 0.0, 0.0, 0.0};
-        if (!GDALRPCExtractDEMWindow(psTransform, dX, dY, 2, 2, adfElevData))
+        if (!GDALRPCExtractDEMWindow(psTransform, dX, dY, 2, 2, adfElevData,
+                                     psWindow))
         {
             return FALSE;
         }
@@ -1630,7 +1832,8 @@ static int GDALRPCGetDEMHeight(GDALRPCTransformInfo *psTransform,
             return FALSE;
         }
         double dfDEMH = 0.0;
-        if (!GDALRPCExtractDEMWindow(psTransform, dX, dY, 1, 1, &dfDEMH) ||
+        if (!GDALRPCExtractDEMWindow(psTransform, dX, dY, 1, 1, &dfDEMH,
+                                     psWindow) ||
             (bGotNoDataValue && ARE_REAL_EQUAL(dfNoDataValue, dfDEMH)))
         {
             return FALSE;
@@ -1889,6 +2092,102 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
     return TRUE;
 }
 
+/************************************************************************/
+/*                        GDALRPCLoadDEMWindow()                        */
+/************************************************************************/
+
+// Make psTransform->sDEMWindow cover the (long, lat) points, with enough
+// margin for the resampling kernel. The previously loaded window is reused
+// if it already covers them, otherwise a new one is read. Only valid when
+// the DEM is in WGS84 geodetic (poCT == nullptr).
+static bool GDALRPCLoadDEMWindow(GDALRPCTransformInfo *psTransform,
+                                 int nPointCount, const double *padfX,
+                                 const double *padfY)
+{
+    CPLAssert(psTransform->poCT == nullptr);
+
+    double dfMinX = std::numeric_limits<double>::max();
+    double dfMinY = std::numeric_limits<double>::max();
+    double dfMaxX = -std::numeric_limits<double>::max();
+    double dfMaxY = -std::numeric_limits<double>::max();
+    for (int i = 0; i < nPointCount; i++)
+    {
+        if (!std::isfinite(padfX[i]) || !std::isfinite(padfY[i]))
+            continue;
+        double dfX = 0.0;
+        double dfY = 0.0;
+        GDALApplyGeoTransform(psTransform->adfDEMReverseGeoTransform, padfX[i],
+                              padfY[i], &dfX, &dfY);
+        dfMinX = std::min(dfMinX, dfX);
+        dfMinY = std::min(dfMinY, dfY);
+        dfMaxX = std::max(dfMaxX, dfX);
+        dfMaxY = std::max(dfMaxY, dfY);
+    }
+    if (dfMinX > dfMaxX)
+        return false;
+
+    // Margin of 2 pixels on each side accommodates the cubic kernel, once
+    // the half-pixel shift to pixel center convention is taken into account.
+    constexpr int MARGIN = 2;
+    const int nRasterXSize = psTransform->poDS->GetRasterXSize();
+    const int nRasterYSize = psTransform->poDS->GetRasterYSize();
+    const double dfXLeft = std::max(0.0, std::floor(dfMinX) - MARGIN);
+    const double dfYTop = std::max(0.0, std::floor(dfMinY) - MARGIN);
+    const double dfXRight = std::min(static_cast<double>(nRasterXSize),
+                                     std::floor(dfMaxX) + 1 + MARGIN);
+    const double dfYBottom = std::min(static_cast<double>(nRasterYSize),
+                                      std::floor(dfMaxY) + 1 + MARGIN);
+    if (!(dfXLeft < dfXRight && dfYTop < dfYBottom))
+        return false;
+
+    // Only worth it if the window is not much larger than what the point
+    // density requires. Otherwise the block cache is more economical.
+    const double dfWindowPixels =
+        (dfXRight - dfXLeft) * (dfYBottom - dfYTop);
+    if (dfWindowPixels > std::max(256.0 * 256.0, 16.0 * nPointCount))
+        return false;
+
+    const int nXOff = static_cast<int>(dfXLeft);
+    const int nYOff = static_cast<int>(dfYTop);
+    const int nXSize = static_cast<int>(dfXRight) - nXOff;
+    const int nYSize = static_cast<int>(dfYBottom) - nYOff;
+
+    GDALRPCDEMWindow &sWindow = psTransform->sDEMWindow;
+    if (sWindow.padfData != nullptr && nXOff >= sWindow.nXOff &&
+        nYOff >= sWindow.nYOff &&
+        nXOff + nXSize <= sWindow.nXOff + sWindow.nXSize &&
+        nYOff + nYSize <= sWindow.nYOff + sWindow.nYSize)
+    {
+        return true;
+    }
+
+    sWindow.padfData = nullptr;
+    if (psTransform->padfDEMWindowBuffer == nullptr)
+        psTransform->padfDEMWindowBuffer = new std::vector<double>();
+    std::vector<double> &adfBuffer = *(psTransform->padfDEMWindowBuffer);
+    try
+    {
+        adfBuffer.resize(static_cast<size_t>(nXSize) * nYSize);
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    if (psTransform->poDS->GetRasterBand(1)->RasterIO(
+            GF_Read, nXOff, nYOff, nXSize, nYSize, adfBuffer.data(), nXSize,
+            nYSize, GDT_Float64, 0, 0, nullptr) != CE_None)
+    {
+        return false;
+    }
+    sWindow.nXOff = nXOff;
+    sWindow.nYOff = nYOff;
+    sWindow.nXSize = nXSize;
+    sWindow.nYSize = nYSize;
+    sWindow.padfData = adfBuffer.data();
+
+    return true;
+}
+
 /************************************************************************/
 /*                           GDALRPCOpenDEM()                           */
 /************************************************************************/
@@ -2148,6 +2447,31 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
             }
         }
 
+        // Load the DEM window covering all the points in a single request,
+        // rather than going through the block cache point after point.
+        const GDALRPCDEMWindow *psDEMWindow = nullptr;
+        if (nPointCount >= 10 && psTransform->poDS != nullptr &&
+            psTransform->poCT == nullptr &&
+            CPLTestBool(CPLGetConfigOption("GDAL_RPC_DEM_OPTIM", "YES")) &&
+            GDALRPCLoadDEMWindow(psTransform, nPointCount, padfX, padfY))
+        {
+            psDEMWindow = &(psTransform->sDEMWindow);
+        }
+
+        std::vector<double> adfHeight;
+        try
+        {
+            adfHeight.resize(nPointCount);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate height array");
+            for (int i = 0; i < nPointCount; i++)
+                panSuccess[i] = FALSE;
+            return FALSE;
+        }
+
         for (int i = 0; i < nPointCount; i++)
         {
             if (!RPCIsValidLongLat(psTransform, padfX[i], padfY[i]))
@@ -2159,7 +2483,8 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
             }
             double dfHeight = 0.0;
             if (!GDALRPCGetHeightAtLongLat(psTransform, padfX[i], padfY[i],
-                                           &dfHeight))
+                                           &dfHeight, nullptr, nullptr,
+                                           psDEMWindow))
             {
                 panSuccess[i] = FALSE;
                 padfX[i] = HUGE_VAL;
@@ -2167,12 +2492,13 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
                 continue;
             }
 
-            RPCTransformPoint(psTransform, padfX[i], padfY[i],
-                              (padfZ ? padfZ[i] : 0.0) + dfHeight, padfX + i,
-                              padfY + i);
+            adfHeight[i] = (padfZ ? padfZ[i] : 0.0) + dfHeight;
             panSuccess[i] = TRUE;
         }
 
+        RPCTransformPoints(psTransform, nPointCount, padfX, padfY,
+                           adfHeight.data(), panSuccess);
+
         return TRUE;
     }
 
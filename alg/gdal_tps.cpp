@@ -32,8 +32,10 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "cpl_atomic_ops.h"
 #include "cpl_conv.h"
@@ -67,6 +69,10 @@ typedef struct
     int nGCPCount;
     GDAL_GCP *pasGCPList;
 
+    // Number of threads used to solve the systems and to transform
+    // large arrays of points.
+    int nThreads;
+
     volatile int nRefCount;
 
 } TPSTransformInfo;
@@ -98,8 +104,12 @@ static void *GDALCreateSimilarTPSTransformer(void *hTransformArg,
             pasGCPList[i].dfGCPPixel /= dfRatioX;
             pasGCPList[i].dfGCPLine /= dfRatioY;
         }
-        psInfo = static_cast<TPSTransformInfo *>(GDALCreateTPSTransformer(
-            psInfo->nGCPCount, pasGCPList, psInfo->bReversed));
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("NUM_THREADS",
+                                CPLSPrintf("%d", psInfo->nThreads));
+        psInfo = static_cast<TPSTransformInfo *>(GDALCreateTPSTransformerInt(
+            psInfo->nGCPCount, pasGCPList, psInfo->bReversed,
+            aosOptions.List()));
         GDALDeinitGCPs(psInfo->nGCPCount, pasGCPList);
         CPLFree(pasGCPList);
     }
@@ -150,7 +160,7 @@ void *GDALCreateTPSTransformer(int nGCPCount, const GDAL_GCP *pasGCPList,
 static void GDALTPSComputeForwardInThread(void *pData)
 {
     TPSTransformInfo *psInfo = static_cast<TPSTransformInfo *>(pData);
-    psInfo->bForwardSolved = psInfo->poForward->solve() != 0;
+    psInfo->bForwardSolved = psInfo->poForward->solve(psInfo->nThreads) != 0;
 }
 
 void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
@@ -264,16 +274,20 @@ void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
             nThreads = atoi(pszWarpThreads);
     }
 
+    psInfo->nThreads = std::max(1, nThreads);
+
     if (nThreads > 1)
     {
-        // Compute direct and reverse transforms in parallel.
+        // Compute direct and reverse transforms in parallel. Each solve
+        // also uses the global thread pool for the O(n^2) matrix
+        // construction and O(n^3) LU decomposition.
         CPLJoinableThread *hThread =
             CPLCreateJoinableThread(GDALTPSComputeForwardInThread, psInfo);
-        psInfo->bReverseSolved = psInfo->poReverse->solve() != 0;
+        psInfo->bReverseSolved = psInfo->poReverse->solve(nThreads) != 0;
         if (hThread != nullptr)
             CPLJoinThread(hThread);
         else
-            psInfo->bForwardSolved = psInfo->poForward->solve() != 0;
+            psInfo->bForwardSolved = psInfo->poForward->solve(nThreads) != 0;
     }
     else
     {
@@ -324,6 +338,41 @@ void GDALDestroyTPSTransformer(void *pTransformArg)
     }
 }
 
+/************************************************************************/
+/*                        GDALTPSTransformRange()                       */
+/************************************************************************/
+
+namespace
+{
+struct TPSTransformJob
+{
+    TPSTransformInfo *psInfo;
+    int bDstToSrc;
+    int nStart;
+    int nEnd;
+    double *x;
+    double *y;
+    int *panSuccess;
+};
+}  // namespace
+
+static void GDALTPSTransformRange(void *pData)
+{
+    const TPSTransformJob *psJob = static_cast<const TPSTransformJob *>(pData);
+    VizGeorefSpline2D *poSpline = psJob->bDstToSrc ? psJob->psInfo->poReverse
+                                                   : psJob->psInfo->poForward;
+    double *x = psJob->x;
+    double *y = psJob->y;
+    for (int i = psJob->nStart; i < psJob->nEnd; i++)
+    {
+        double xy_out[2] = {0.0, 0.0};
+        poSpline->get_point(x[i], y[i], xy_out);
+        x[i] = xy_out[0];
+        y[i] = xy_out[1];
+        psJob->panSuccess[i] = TRUE;
+    }
+}
+
 /************************************************************************/
 /*                          GDALTPSTransform()                          */
 /************************************************************************/
@@ -357,25 +406,55 @@ int GDALTPSTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
 
     TPSTransformInfo *psInfo = static_cast<TPSTransformInfo *>(pTransformArg);
 
-    for (int i = 0; i < nPointCount; i++)
+    // Evaluating a point is O(nGCPCount). For large requests, split the
+    // points between several threads. Dedicated threads are used rather
+    // than the global thread pool, since we might be called from one of
+    // its jobs (e.g. by the warping kernel).
+    constexpr double MIN_WORK_PER_THREAD = 10 * 1000 * 1000;
+    const int nThreads = static_cast<int>(std::min(
+        static_cast<double>(psInfo->nThreads),
+        static_cast<double>(nPointCount) * psInfo->nGCPCount /
+            MIN_WORK_PER_THREAD));
+    if (nThreads > 1)
     {
-        double xy_out[2] = {0.0, 0.0};
-
-        if (bDstToSrc)
+        std::vector<TPSTransformJob> asJobs(nThreads);
+        std::vector<CPLJoinableThread *> ahThreads(nThreads, nullptr);
+        const int nPointsPerThread = (nPointCount + nThreads - 1) / nThreads;
+        for (int i = 0; i < nThreads; i++)
         {
-            psInfo->poReverse->get_point(x[i], y[i], xy_out);
-            x[i] = xy_out[0];
-            y[i] = xy_out[1];
+            asJobs[i].psInfo = psInfo;
+            asJobs[i].bDstToSrc = bDstToSrc;
+            asJobs[i].nStart = std::min(nPointCount, i * nPointsPerThread);
+            asJobs[i].nEnd =
+                std::min(nPointCount, asJobs[i].nStart + nPointsPerThread);
+            asJobs[i].x = x;
+            asJobs[i].y = y;
+            asJobs[i].panSuccess = panSuccess;
+            // The last range is processed by the calling thread.
+            if (i + 1 < nThreads)
+                ahThreads[i] =
+                    CPLCreateJoinableThread(GDALTPSTransformRange, &asJobs[i]);
+            if (ahThreads[i] == nullptr)
+                GDALTPSTransformRange(&asJobs[i]);
         }
-        else
+        for (auto hThread : ahThreads)
         {
-            psInfo->poForward->get_point(x[i], y[i], xy_out);
-            x[i] = xy_out[0];
-            y[i] = xy_out[1];
+            if (hThread)
+                CPLJoinThread(hThread);
         }
-        panSuccess[i] = TRUE;
+        return TRUE;
     }
 
+    TPSTransformJob sJob;
+    sJob.psInfo = psInfo;
+    sJob.bDstToSrc = bDstToSrc;
+    sJob.nStart = 0;
+    sJob.nEnd = nPointCount;
+    sJob.x = x;
+    sJob.y = y;
+    sJob.panSuccess = panSuccess;
+    GDALTPSTransformRange(&sJob);
+
     return TRUE;
 }
 
@@ -36,6 +36,7 @@
 #include "cpl_port.h"
 #include "cpl_conv.h"
 #include "gdallinearsystem.h"
+#include "gdal_thread_pool.h"
 
 #ifdef HAVE_ARMADILLO
 #include "armadillo_headers.h"
@@ -45,15 +46,45 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <memory>
 
 CPL_CVSID("$Id$")
 
 #ifndef HAVE_ARMADILLO
 namespace
 {
+struct LUUpdateJob
+{
+    GDALMatrix *poA;
+    int nStep;
+    int nColStart;
+    int nColEnd;
+};
+
+// Update of the columns [nColStart, nColEnd[ of the trailing submatrix.
+void LUUpdateColumns(GDALMatrix &A, int step, int nColStart, int nColEnd)
+{
+    int const m = A.getNumRows();
+    for (int iCol = nColStart; iCol < nColEnd; ++iCol)
+    {
+        for (int iRow = step + 1; iRow < m; ++iRow)
+        {
+            A(iRow, iCol) -= A(iRow, step) * A(step, iCol);
+        }
+    }
+}
+
+void LUUpdateColumnsJob(void *pData)
+{
+    const LUUpdateJob *psJob = static_cast<const LUUpdateJob *>(pData);
+    LUUpdateColumns(*(psJob->poA), psJob->nStep, psJob->nColStart,
+                    psJob->nColEnd);
+}
+
 // LU decomposition of the quadratic matrix A
 // see https://en.wikipedia.org/wiki/LU_decomposition#C_code_examples
-bool solve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X, double eps)
+bool solve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X, double eps,
+           int nThreads)
 {
     assert(A.getNumRows() == A.getNumCols());
     if (eps < 0)
@@ -65,6 +96,16 @@ bool solve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X, double eps)
     for (int iRow = 0; iRow < m; ++iRow)
         perm[iRow] = iRow;
 
+    // Below that size of the trailing submatrix, the cost of dispatching
+    // the update to worker threads exceeds the gain.
+    constexpr int MIN_COLS_PER_JOB = 64;
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 && m > 2 * MIN_COLS_PER_JOB
+            ? GDALGetGlobalThreadPool(nThreads)
+            : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    std::vector<LUUpdateJob> asJobs(poQueue ? nThreads : 0);
+
     for (int step = 0; step < m - 1; ++step)
     {
         // determine pivot element
@@ -97,12 +138,35 @@ bool solve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X, double eps)
         {
             A(iRow, step) /= A(step, step);
         }
-        for (int iCol = step + 1; iCol < m; ++iCol)
+        const int nCols = m - (step + 1);
+        const int nJobs =
+            poQueue ? std::min(nThreads, nCols / MIN_COLS_PER_JOB) : 0;
+        if (nJobs > 1)
         {
-            for (int iRow = step + 1; iRow < m; ++iRow)
+            const int nColsPerJob = (nCols + nJobs - 1) / nJobs;
+            bool bOK = true;
+            for (int iJob = 0; iJob < nJobs; ++iJob)
             {
-                A(iRow, iCol) -= A(iRow, step) * A(step, iCol);
+                auto &sJob = asJobs[iJob];
+                sJob.poA = &A;
+                sJob.nStep = step;
+                sJob.nColStart = step + 1 + iJob * nColsPerJob;
+                sJob.nColEnd = std::min(m, sJob.nColStart + nColsPerJob);
+                if (sJob.nColStart < sJob.nColEnd)
+                {
+                    if (!bOK || !poQueue->SubmitJob(LUUpdateColumnsJob, &sJob))
+                    {
+                        bOK = false;
+                        LUUpdateColumns(A, step, sJob.nColStart,
+                                        sJob.nColEnd);
+                    }
+                }
             }
+            poQueue->WaitCompletion();
+        }
+        else
+        {
+            LUUpdateColumns(A, step, step + 1, m);
         }
     }
 
@@ -135,8 +199,12 @@ bool solve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X, double eps)
 /*                                                                      */
 /*   Solves the linear system A*X_i = RHS_i for each column i           */
 /*   where A is a square matrix.                                        */
+/*                                                                      */
+/*   nThreads is the maximum number of threads used by the built-in     */
+/*   LU decomposition (ignored when using Armadillo).                   */
 /************************************************************************/
-bool GDALLinearSystemSolve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X)
+bool GDALLinearSystemSolve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X,
+                           int nThreads)
 {
     assert(A.getNumRows() == RHS.getNumRows());
     assert(A.getNumCols() == X.getNumRows());
@@ -144,6 +212,7 @@ bool GDALLinearSystemSolve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X)
     try
     {
 #ifdef HAVE_ARMADILLO
+        CPL_IGNORE_RET_VAL(nThreads);
         arma::mat matA(A.data(), A.getNumRows(), A.getNumCols(), false, true);
         arma::mat matRHS(RHS.data(), RHS.getNumRows(), RHS.getNumCols(), false,
                          true);
@@ -159,7 +228,7 @@ bool GDALLinearSystemSolve(GDALMatrix &A, GDALMatrix &RHS, GDALMatrix &X)
 #endif
 
 #else  // HAVE_ARMADILLO
-        return solve(A, RHS, X, 0);
+        return solve(A, RHS, X, 0, nThreads);
 #endif
     }
     catch (std::exception const &e)
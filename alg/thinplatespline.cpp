@@ -35,6 +35,7 @@
 #include "cpl_port.h"
 #include "thinplatespline.h"
 #include "gdallinearsystem.h"
+#include "gdal_thread_pool.h"
 
 #include <climits>
 #include <cstdio>
@@ -43,6 +44,7 @@
 #include <algorithm>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include "cpl_error.h"
 #include "cpl_vsi.h"
@@ -437,7 +439,43 @@ static void VizGeorefSpline2DBase_func4(double *res, const double *pxy,
 }
 #endif  // defined(USE_OPTIMIZED_VizGeorefSpline2DBase_func4)
 
-int VizGeorefSpline2D::solve()
+namespace
+{
+struct FillMatrixJob
+{
+    GDALMatrix *poA;
+    const double *x;
+    const double *y;
+    int nof_points;
+    int iFirstRow;
+    int nRowStep;
+};
+}  // namespace
+
+// Fill the radial basis function part of the matrix, for the rows
+// iFirstRow, iFirstRow + nRowStep, ... (interleaving balances the work
+// between jobs, given that only the upper triangle is computed)
+static void FillMatrixRows(GDALMatrix &A, const double *x, const double *y,
+                           int nof_points, int iFirstRow, int nRowStep)
+{
+    for (int r = iFirstRow; r < nof_points; r += nRowStep)
+        for (int c = r; c < nof_points; c++)
+        {
+            A(r + 3, c + 3) =
+                VizGeorefSpline2DBase_func(x[r], y[r], x[c], y[c]);
+            if (r != c)
+                A(c + 3, r + 3) = A(r + 3, c + 3);
+        }
+}
+
+static void FillMatrixRowsJob(void *pData)
+{
+    const FillMatrixJob *psJob = static_cast<const FillMatrixJob *>(pData);
+    FillMatrixRows(*(psJob->poA), psJob->x, psJob->y, psJob->nof_points,
+                   psJob->iFirstRow, psJob->nRowStep);
+}
+
+int VizGeorefSpline2D::solve(int nThreads)
 {
     // No points at all.
     if (_nof_points < 1)
@@ -586,14 +624,31 @@ int VizGeorefSpline2D::solve()
         A(c + 3, 2) = y[c];
     }
 
-    for (int r = 0; r < _nof_points; r++)
-        for (int c = r; c < _nof_points; c++)
+    // Only worth using threads for large number of points.
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 && _nof_points >= 1000 ? GDALGetGlobalThreadPool(nThreads)
+                                            : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poQueue)
+    {
+        std::vector<FillMatrixJob> asJobs(nThreads);
+        for (int i = 0; i < nThreads; i++)
         {
-            A(r + 3, c + 3) =
-                VizGeorefSpline2DBase_func(x[r], y[r], x[c], y[c]);
-            if (r != c)
-                A(c + 3, r + 3) = A(r + 3, c + 3);
+            asJobs[i].poA = &A;
+            asJobs[i].x = x;
+            asJobs[i].y = y;
+            asJobs[i].nof_points = _nof_points;
+            asJobs[i].iFirstRow = i;
+            asJobs[i].nRowStep = nThreads;
+            if (!poQueue->SubmitJob(FillMatrixRowsJob, &asJobs[i]))
+                FillMatrixRowsJob(&asJobs[i]);
         }
+        poQueue->WaitCompletion();
+    }
+    else
+    {
+        FillMatrixRows(A, x, y, _nof_points, 0, 1);
+    }
 
 #if VIZ_GEOREF_SPLINE_DEBUG
 
@@ -613,7 +668,7 @@ int VizGeorefSpline2D::solve()
 
     GDALMatrix Coef(_nof_eqs, _nof_vars);
 
-    if (!GDALLinearSystemSolve(A, RHS, Coef))
+    if (!GDALLinearSystemSolve(A, RHS, Coef, nThreads))
     {
         return 0;
     }
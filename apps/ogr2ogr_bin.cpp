@@ -85,7 +85,7 @@ static void Usage(const char *pszAdditionalMsg = nullptr, bool bShort = true)
         "               [-dim XY|XYZ|XYM|XYZM|layer_dim] [layer [layer ...]]\n"
         "\n"
         "Advanced options :\n"
-        "               [-gt n] [-ds_transaction]\n"
+        "               [-gt n] [-ds_transaction] [-num_threads n|ALL_CPUS]\n"
         "               [[-oo NAME=VALUE] ...] [[-doo NAME=VALUE] ...]\n"
         "               [-clipsrc [xmin ymin xmax "
         "ymax]|WKT|datasource|spat_extent]\n"
@@ -165,6 +165,8 @@ static void Usage(const char *pszAdditionalMsg = nullptr, bool bShort = true)
         " -skipfailures: skip features or layers that fail to convert\n"
         " -gt n: group n features per transaction (default 20000). n can be "
         "set to unlimited\n"
+        " -num_threads n|ALL_CPUS: number of threads used to process "
+        "features\n"
         " -spat xmin ymin xmax ymax: spatial query extents\n"
         " -simplify tolerance: distance tolerance for simplification.\n"
         " -segmentize max_dist: maximum distance between 2 nodes.\n"
@@ -39,31 +39,41 @@
 #include <cstring>
 
 #include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <unordered_set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_featurestyle.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
+#include "ogr_recordbatch.h"
 #include "ogr_spatialref.h"
+#include "ogr_wkb.h"
 #include "ogrlayerdecorator.h"
 #include "ogrsf_frmts.h"
 
@@ -424,6 +434,10 @@ struct GDALVectorTranslateOptions
 
     /*! Maximum number of features, or -1 if no limit. */
     GIntBig nLimit = -1;
+
+    /*! Number of threads used to process features, or 0 to use the
+        GDAL_NUM_THREADS configuration option. */
+    int nNumThreads = 0;
 };
 
 struct TargetLayerInfo
@@ -499,6 +513,57 @@ class SetupTargetLayer
           GDALVectorTranslateOptions *psOptions, GIntBig &nTotalEventsDone);
 };
 
+/** Outcome of LayerTranslator::ProcessFeature() */
+enum class FeatureProcessingResult
+{
+    OK,
+    DISCARDED,
+    TRANSLATION_FAILED,
+    REPROJECTION_FAILED,
+};
+
+/** State used by LayerTranslator::ProcessFeature(). When features are
+ * processed in several threads, each thread uses its own context. */
+struct FeatureProcessingContext
+{
+    // Per-thread copies of TargetLayerInfo::m_apoCT. Empty when features
+    // are processed in the calling thread.
+    std::vector<std::unique_ptr<OGRCoordinateTransformation>> m_apoCT{};
+    OGRGeometryFactory::TransformWithOptionsCache m_transformWithOptionsCache{};
+    std::unique_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS{};
+    const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS = nullptr;
+    std::unique_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS{};
+    const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS = nullptr;
+};
+
+/** A source feature and the target features derived from it */
+struct FeatureToTranslate
+{
+    std::unique_ptr<OGRFeature> m_poSrcFeature{};
+    GIntBig m_nSrcFID = OGRNullFID;
+    GIntBig m_nDesiredFID = OGRNullFID;
+    std::vector<std::unique_ptr<OGRFeature>> m_apoDstFeatures{};
+    std::vector<FeatureProcessingResult> m_aeResults{};
+    // Errors emitted while reading or processing the feature in another
+    // thread, to be emitted again in the calling thread
+    std::vector<CPLErrorHandlerAccumulatorStruct> m_aoErrors{};
+};
+
+class LayerTranslator;
+
+/** Range of features of a batch to be processed by a worker thread */
+struct FeatureProcessingJob
+{
+    LayerTranslator *m_poTranslator = nullptr;
+    TargetLayerInfo *m_psInfo = nullptr;
+    std::vector<FeatureToTranslate> *m_paoFeatures = nullptr;
+    size_t m_nStart = 0;
+    size_t m_nEnd = 0;
+    OGRSpatialReference *m_poOutputSRS = nullptr;
+    FeatureProcessingContext *m_poCtxt = nullptr;
+    const GDALVectorTranslateOptions *m_psOptions = nullptr;
+};
+
 class LayerTranslator
 {
   public:
@@ -519,21 +584,51 @@ class LayerTranslator
     double m_dfGeomOpParam = 0;
     OGRGeometry *m_poClipSrcOri = nullptr;
     bool m_bWarnedClipSrcSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS;
-    const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS = nullptr;
     OGRGeometry *m_poClipDstOri = nullptr;
     bool m_bWarnedClipDstSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS;
-    const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS = nullptr;
     bool m_bExplodeCollections = false;
     bool m_bNativeData = false;
     GIntBig m_nLimit = -1;
-    OGRGeometryFactory::TransformWithOptionsCache m_transformWithOptionsCache;
+    FeatureProcessingContext m_oProcessingContext{};
+    // Protects the reprojection of clip geometries and the related warnings
+    std::mutex m_oMutex{};
 
     int Translate(OGRFeature *poFeatureIn, TargetLayerInfo *psInfo,
                   GIntBig nCountLayerFeatures, GIntBig *pnReadFeatureCount,
                   GIntBig &nTotalEventsDone, GDALProgressFunc pfnProgress,
                   void *pProgressArg, GDALVectorTranslateOptions *psOptions);
+
+  private:
+    int GetCollectionToExplode(
+        TargetLayerInfo *psInfo, OGRFeature *poFeature,
+        std::unique_ptr<OGRGeometryCollection> &poCollToExplode,
+        int &iGeomCollToExplode) const;
+    FeatureProcessingResult
+    ProcessFeature(TargetLayerInfo *psInfo,
+                   std::unique_ptr<OGRFeature> &poFeature,
+                   std::unique_ptr<OGRFeature> &poDstFeature,
+                   OGRGeometryCollection *poCollToExplode,
+                   int iGeomCollToExplode, GIntBig nSrcFID,
+                   GIntBig nDesiredFID, OGRSpatialReference *poOutputSRS,
+                   FeatureProcessingContext &oCtxt,
+                   const GDALVectorTranslateOptions *psOptions);
+    static void ProcessFeaturesJob(void *pData);
+    bool SetupCTWithoutFeature(TargetLayerInfo *psInfo,
+                               OGRSpatialReference *poOutputSRS,
+                               bool &bSetupCTOK);
+    bool CanUseWriteArrowBatch(TargetLayerInfo *psInfo,
+                               GDALVectorTranslateOptions *psOptions) const;
+    bool TranslateArrow(TargetLayerInfo *psInfo, GIntBig nCountLayerFeatures,
+                        GIntBig *pnReadFeatureCount, GIntBig &nTotalEventsDone,
+                        GDALProgressFunc pfnProgress, void *pProgressArg,
+                        GDALVectorTranslateOptions *psOptions);
+    bool TranslateMultiThreaded(
+        TargetLayerInfo *psInfo, GIntBig nCountLayerFeatures,
+        GIntBig *pnReadFeatureCount, GIntBig &nTotalEventsDone,
+        GDALProgressFunc pfnProgress, void *pProgressArg,
+        GDALVectorTranslateOptions *psOptions,
+        OGRSpatialReference *poOutputSRS,
+        std::vector<std::unique_ptr<FeatureProcessingContext>> &apoContexts);
 };
 
 static OGRLayer *GetLayerAndOverwriteIfNecessary(GDALDataset *poDstDS,
@@ -5068,639 +5163,1544 @@ static bool SetupCT(TargetLayerInfo *psInfo, OGRLayer *poSrcLayer,
 }
 
 /************************************************************************/
-/*                     LayerTranslator::Translate()                     */
+/*                           GetNumThreads()                            */
 /************************************************************************/
 
-int LayerTranslator::Translate(OGRFeature *poFeatureIn, TargetLayerInfo *psInfo,
-                               GIntBig nCountLayerFeatures,
-                               GIntBig *pnReadFeatureCount,
-                               GIntBig &nTotalEventsDone,
-                               GDALProgressFunc pfnProgress, void *pProgressArg,
-                               GDALVectorTranslateOptions *psOptions)
+/** Returns the number of threads to use to process features, from the
+ * -num_threads switch or the GDAL_NUM_THREADS configuration option. */
+static int GetNumThreads(const GDALVectorTranslateOptions *psOptions)
 {
-    const int eGType = m_eGType;
-    OGRSpatialReference *poOutputSRS = m_poOutputSRS;
+    int nThreads = psOptions->nNumThreads;
+    if (nThreads <= 0)
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszNumThreads == nullptr)
+            return 1;
+        if (EQUAL(pszNumThreads, "ALL_CPUS"))
+            nThreads = CPLGetNumCPUs();
+        else
+            nThreads = atoi(pszNumThreads);
+    }
+    return std::max(1, std::min(128, nThreads));
+}
 
+/************************************************************************/
+/*                           GetDesiredFID()                            */
+/************************************************************************/
+
+static GIntBig GetDesiredFID(const TargetLayerInfo *psInfo,
+                             const OGRFeature *poFeature)
+{
+    if (psInfo->m_bPreserveFID)
+        return poFeature->GetFID();
+    if (psInfo->m_iSrcFIDField >= 0 &&
+        poFeature->IsFieldSetAndNotNull(psInfo->m_iSrcFIDField))
+        return poFeature->GetFieldAsInteger64(psInfo->m_iSrcFIDField);
+    return OGRNullFID;
+}
+
+/************************************************************************/
+/*               LayerTranslator::GetCollectionToExplode()              */
+/************************************************************************/
+
+/** Steals from poFeature the geometry collection to explode, if any, and
+ * returns the number of target features to generate from poFeature. */
+int LayerTranslator::GetCollectionToExplode(
+    TargetLayerInfo *psInfo, OGRFeature *poFeature,
+    std::unique_ptr<OGRGeometryCollection> &poCollToExplode,
+    int &iGeomCollToExplode) const
+{
+    const int nDstGeomFieldCount =
+        psInfo->m_poDstLayer->GetLayerDefn()->GetGeomFieldCount();
+    if (!m_bExplodeCollections || nDstGeomFieldCount > 1)
+        return 1;
+
+    const int iRequestedSrcGeomField = psInfo->m_iRequestedSrcGeomField;
+    OGRGeometry *poSrcGeometry;
+    if (iRequestedSrcGeomField >= 0)
+        poSrcGeometry = poFeature->GetGeomFieldRef(iRequestedSrcGeomField);
+    else
+        poSrcGeometry = poFeature->GetGeometryRef();
+    if (poSrcGeometry &&
+        OGR_GT_IsSubClassOf(poSrcGeometry->getGeometryType(),
+                            wkbGeometryCollection))
+    {
+        const int nParts =
+            poSrcGeometry->toGeometryCollection()->getNumGeometries();
+        if (nParts > 0)
+        {
+            iGeomCollToExplode =
+                iRequestedSrcGeomField >= 0 ? iRequestedSrcGeomField : 0;
+            poCollToExplode.reset(poFeature->StealGeometry(iGeomCollToExplode)
+                                      ->toGeometryCollection());
+            return nParts;
+        }
+    }
+    return 1;
+}
+
+/************************************************************************/
+/*                  LayerTranslator::ProcessFeature()                   */
+/************************************************************************/
+
+/** Builds the target feature from a source feature, and applies to its
+ * geometries the requested operations (clipping, reprojection, etc.)
+ *
+ * This method does not touch the source and target layers, and may thus be
+ * called concurrently from several threads, provided each of them uses its
+ * own context.
+ */
+FeatureProcessingResult LayerTranslator::ProcessFeature(
+    TargetLayerInfo *psInfo, std::unique_ptr<OGRFeature> &poFeature,
+    std::unique_ptr<OGRFeature> &poDstFeature,
+    OGRGeometryCollection *poCollToExplode, int iGeomCollToExplode,
+    GIntBig nSrcFID, GIntBig nDesiredFID, OGRSpatialReference *poOutputSRS,
+    FeatureProcessingContext &oCtxt,
+    const GDALVectorTranslateOptions *psOptions)
+{
     OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
-    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
     const int *const panMap = psInfo->m_anMap.data();
     const int iSrcZField = psInfo->m_iSrcZField;
-    const bool bPreserveFID = psInfo->m_bPreserveFID;
-    const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
-    const auto poDstFDefn = poDstLayer->GetLayerDefn();
-    const int nSrcGeomFieldCount = poSrcFDefn->GetGeomFieldCount();
+    const auto poDstFDefn = psInfo->m_poDstLayer->GetLayerDefn();
+    const int nSrcGeomFieldCount =
+        poSrcLayer->GetLayerDefn()->GetGeomFieldCount();
     const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
     const bool bExplodeCollections =
         m_bExplodeCollections && nDstGeomFieldCount <= 1;
     const int iRequestedSrcGeomField = psInfo->m_iRequestedSrcGeomField;
+    FeatureProcessingResult eResult = FeatureProcessingResult::OK;
 
-    if (poOutputSRS == nullptr && !m_bNullifyOutputSRS)
+    if (psInfo->m_bCanAvoidSetFrom)
     {
-        if (nSrcGeomFieldCount == 1)
+        poDstFeature = std::move(poFeature);
+        // From now on, poFeature is null !
+        poDstFeature->SetFDefnUnsafe(poDstFDefn);
+        poDstFeature->SetFID(nDesiredFID);
+    }
+    else
+    {
+        /* Optimization to avoid duplicating the source geometry in the */
+        /* target feature : we steal it from the source feature for now... */
+        OGRGeometry *poStolenGeometry = nullptr;
+        if (!bExplodeCollections && nSrcGeomFieldCount == 1 &&
+            (nDstGeomFieldCount == 1 ||
+             (nDstGeomFieldCount == 0 && m_poClipSrcOri)))
         {
-            poOutputSRS = poSrcLayer->GetSpatialRef();
+            poStolenGeometry = poFeature->StealGeometry();
         }
-        else if (iRequestedSrcGeomField > 0)
+        else if (!bExplodeCollections && iRequestedSrcGeomField >= 0)
         {
-            poOutputSRS = poSrcLayer->GetLayerDefn()
-                              ->GetGeomFieldDefn(iRequestedSrcGeomField)
-                              ->GetSpatialRef();
+            poStolenGeometry = poFeature->StealGeometry(iRequestedSrcGeomField);
         }
-    }
 
-    /* -------------------------------------------------------------------- */
-    /*      Transfer features.                                              */
-    /* -------------------------------------------------------------------- */
-    if (psOptions->nGroupTransactions)
-    {
-        if (psOptions->nLayerTransaction)
+        if (nDstGeomFieldCount == 0 && poStolenGeometry && m_poClipSrcOri)
         {
-            if (poDstLayer->StartTransaction() == OGRERR_FAILURE)
+            auto poGeomSRS = poStolenGeometry->getSpatialReference();
+            if (oCtxt.m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
             {
-                delete poFeatureIn;
-                return false;
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                auto poClipSrcSRS = m_poClipSrcOri->getSpatialReference();
+                if (poClipSrcSRS && poGeomSRS &&
+                    !poClipSrcSRS->IsSame(poGeomSRS))
+                {
+                    // Transform clip geom to geometry SRS
+                    oCtxt.m_poClipSrcReprojectedToSrcSRS.reset(
+                        m_poClipSrcOri->clone());
+                    if (oCtxt.m_poClipSrcReprojectedToSrcSRS->transformTo(
+                            poGeomSRS) != OGRERR_NONE)
+                    {
+                        delete poStolenGeometry;
+                        return FeatureProcessingResult::DISCARDED;
+                    }
+                    oCtxt.m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
+                }
+                else if (!poClipSrcSRS && poGeomSRS)
+                {
+                    if (!m_bWarnedClipSrcSRS)
+                    {
+                        m_bWarnedClipSrcSRS = true;
+                        CPLError(
+                            CE_Warning, CPLE_AppDefined,
+                            "Clip source geometry has no attached SRS, "
+                            "but the feature's geometry has one. "
+                            "Assuming clip source geometry SRS is the "
+                            "same as the feature's geometry");
+                    }
+                }
+            }
+            OGRGeometry *poClipped = poStolenGeometry->Intersection(
+                oCtxt.m_poClipSrcReprojectedToSrcSRS
+                    ? oCtxt.m_poClipSrcReprojectedToSrcSRS.get()
+                    : m_poClipSrcOri);
+            delete poStolenGeometry;
+            poStolenGeometry = nullptr;
+            if (poClipped == nullptr || poClipped->IsEmpty())
+            {
+                delete poClipped;
+                return FeatureProcessingResult::DISCARDED;
             }
+            delete poClipped;
         }
-    }
 
-    std::unique_ptr<OGRFeature> poFeature;
-    std::unique_ptr<OGRFeature> poDstFeature(new OGRFeature(poDstFDefn));
-    int nFeaturesInTransaction = 0;
-    GIntBig nCount = 0; /* written + failed */
-    GIntBig nFeaturesWritten = 0;
+        poDstFeature->Reset();
+        if (poDstFeature->SetFrom(poFeature.get(), panMap, TRUE) !=
+            OGRERR_NONE)
+        {
+            OGRGeometryFactory::destroyGeometry(poStolenGeometry);
+            return FeatureProcessingResult::TRANSLATION_FAILED;
+        }
 
-    bool bRet = true;
-    CPLErrorReset();
+        /* ... and now we can attach the stolen geometry */
+        if (poStolenGeometry)
+        {
+            poDstFeature->SetGeometryDirectly(poStolenGeometry);
+        }
 
-    bool bSetupCTOK = false;
-    if (m_bTransform && psInfo->m_nFeaturesRead == 0 &&
-        !psInfo->m_bPerFeatureCT)
-    {
-        bSetupCTOK = SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
-                             m_osDateLineOffset, m_poUserSourceSRS, nullptr,
-                             poOutputSRS, m_poGCPCoordTrans, false);
+        if (!psInfo->m_oMapResolved.empty())
+        {
+            for (const auto &kv : psInfo->m_oMapResolved)
+            {
+                const int nDstField = kv.first;
+                const int nSrcField = kv.second.nSrcField;
+                if (poFeature->IsFieldSetAndNotNull(nSrcField))
+                {
+                    // Do not use operator[] as this may be called
+                    // concurrently from several threads
+                    const auto oIterDomain =
+                        psInfo->m_oMapDomainToKV.find(kv.second.poDomain);
+                    if (oIterDomain == psInfo->m_oMapDomainToKV.end())
+                        continue;
+                    const auto &oMapKV = oIterDomain->second;
+                    const auto iter =
+                        oMapKV.find(poFeature->GetFieldAsString(nSrcField));
+                    if (iter != oMapKV.end())
+                    {
+                        poDstFeature->SetField(nDstField, iter->second.c_str());
+                    }
+                }
+            }
+        }
+
+        if (nDesiredFID != OGRNullFID)
+            poDstFeature->SetFID(nDesiredFID);
     }
 
-    while (true)
+    if (psOptions->bEmptyStrAsNull)
     {
-        if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
+        for (int i = 0; i < poDstFeature->GetFieldCount(); i++)
         {
-            break;
+            if (!poDstFeature->IsFieldSetAndNotNull(i))
+                continue;
+            auto fieldDef = poDstFeature->GetFieldDefnRef(i);
+            if (fieldDef->GetType() != OGRFieldType::OFTString)
+                continue;
+            auto str = poDstFeature->GetFieldAsString(i);
+            if (strcmp(str, "") == 0)
+                poDstFeature->SetFieldNull(i);
         }
+    }
 
-        if (poFeatureIn != nullptr)
-            poFeature.reset(poFeatureIn);
-        else if (psOptions->nFIDToFetch != OGRNullFID)
-            poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
-        else
-            poFeature.reset(poSrcLayer->GetNextFeature());
+    /* Erase native data if asked explicitly */
+    if (!m_bNativeData)
+    {
+        poDstFeature->SetNativeData(nullptr);
+        poDstFeature->SetNativeMediaType(nullptr);
+    }
 
-        if (poFeature == nullptr)
+    for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
+    {
+        OGRGeometry *poDstGeometry;
+
+        if (poCollToExplode && iGeom == iGeomCollToExplode)
         {
-            if (CPLGetLastErrorType() == CE_Failure)
-            {
-                bRet = false;
-            }
-            break;
+            OGRGeometry *poPart = poCollToExplode->getGeometryRef(0);
+            poCollToExplode->removeGeometry(0, FALSE);
+            poDstGeometry = poPart;
+            assert(poDstGeometry);
+        }
+        else
+        {
+            poDstGeometry = poDstFeature->StealGeometry(iGeom);
+            if (poDstGeometry == nullptr)
+                continue;
         }
 
-        if (!bSetupCTOK &&
-            (psInfo->m_nFeaturesRead == 0 || psInfo->m_bPerFeatureCT))
+        // poFeature hasn't been moved if iSrcZField != -1
+        // cppcheck-suppress accessMoved
+        if (iSrcZField != -1 && poFeature != nullptr)
         {
-            if (!SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
-                         m_osDateLineOffset, m_poUserSourceSRS, poFeature.get(),
-                         poOutputSRS, m_poGCPCoordTrans, true))
-            {
-                return false;
-            }
+            SetZ(poDstGeometry, poFeature->GetFieldAsDouble(iSrcZField));
+            /* This will correct the coordinate dimension to 3 */
+            OGRGeometry *poDupGeometry = poDstGeometry->clone();
+            delete poDstGeometry;
+            poDstGeometry = poDupGeometry;
         }
 
-        psInfo->m_nFeaturesRead++;
+        if (m_nCoordDim == 2 || m_nCoordDim == 3)
+        {
+            poDstGeometry->setCoordinateDimension(m_nCoordDim);
+        }
+        else if (m_nCoordDim == 4)
+        {
+            poDstGeometry->set3D(TRUE);
+            poDstGeometry->setMeasured(TRUE);
+        }
+        else if (m_nCoordDim == COORD_DIM_XYM)
+        {
+            poDstGeometry->set3D(FALSE);
+            poDstGeometry->setMeasured(TRUE);
+        }
+        else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
+        {
+            const OGRwkbGeometryType eDstLayerGeomType =
+                poDstFDefn->GetGeomFieldDefn(iGeom)->GetType();
+            poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
+            poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+        }
 
-        int nIters = 1;
-        std::unique_ptr<OGRGeometryCollection> poCollToExplode;
-        int iGeomCollToExplode = -1;
-        if (bExplodeCollections)
+        if (m_eGeomOp == GEOMOP_SEGMENTIZE)
         {
-            OGRGeometry *poSrcGeometry;
-            if (iRequestedSrcGeomField >= 0)
-                poSrcGeometry =
-                    poFeature->GetGeomFieldRef(iRequestedSrcGeomField);
-            else
-                poSrcGeometry = poFeature->GetGeometryRef();
-            if (poSrcGeometry &&
-                OGR_GT_IsSubClassOf(poSrcGeometry->getGeometryType(),
-                                    wkbGeometryCollection))
-            {
-                const int nParts =
-                    poSrcGeometry->toGeometryCollection()->getNumGeometries();
-                if (nParts > 0)
+            if (m_dfGeomOpParam > 0)
+                poDstGeometry->segmentize(m_dfGeomOpParam);
+        }
+        else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+        {
+            if (m_dfGeomOpParam > 0)
+            {
+                OGRGeometry *poNewGeom =
+                    poDstGeometry->SimplifyPreserveTopology(m_dfGeomOpParam);
+                if (poNewGeom)
                 {
-                    iGeomCollToExplode = iRequestedSrcGeomField >= 0
-                                             ? iRequestedSrcGeomField
-                                             : 0;
-                    poCollToExplode.reset(
-                        poFeature->StealGeometry(iGeomCollToExplode)
-                            ->toGeometryCollection());
-                    nIters = nParts;
+                    delete poDstGeometry;
+                    poDstGeometry = poNewGeom;
                 }
             }
         }
 
-        const GIntBig nSrcFID = poFeature->GetFID();
-        GIntBig nDesiredFID = OGRNullFID;
-        if (bPreserveFID)
-            nDesiredFID = nSrcFID;
-        else if (psInfo->m_iSrcFIDField >= 0 &&
-                 poFeature->IsFieldSetAndNotNull(psInfo->m_iSrcFIDField))
-            nDesiredFID =
-                poFeature->GetFieldAsInteger64(psInfo->m_iSrcFIDField);
-
-        for (int iPart = 0; iPart < nIters; iPart++)
+        if (m_poClipSrcOri)
         {
-            if (psOptions->nLayerTransaction &&
-                ++nFeaturesInTransaction == psOptions->nGroupTransactions)
+            auto poGeomSRS = poDstGeometry->getSpatialReference();
+            if (oCtxt.m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
             {
-                if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
-                    poDstLayer->StartTransaction() == OGRERR_FAILURE)
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                auto poClipSrcSRS = m_poClipSrcOri->getSpatialReference();
+                if (poClipSrcSRS && poGeomSRS &&
+                    !poClipSrcSRS->IsSame(poGeomSRS))
                 {
-                    return false;
+                    // Transform clip geom to geometry SRS
+                    oCtxt.m_poClipSrcReprojectedToSrcSRS.reset(
+                        m_poClipSrcOri->clone());
+                    if (oCtxt.m_poClipSrcReprojectedToSrcSRS->transformTo(
+                            poGeomSRS) != OGRERR_NONE)
+                    {
+                        delete poDstGeometry;
+                        return FeatureProcessingResult::DISCARDED;
+                    }
+                    oCtxt.m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
                 }
-                nFeaturesInTransaction = 0;
-            }
-            else if (!psOptions->nLayerTransaction &&
-                     psOptions->nGroupTransactions >= 0 &&
-                     ++nTotalEventsDone >= psOptions->nGroupTransactions)
-            {
-                if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
-                    m_poODS->StartTransaction(psOptions->bForceTransaction) ==
-                        OGRERR_FAILURE)
+                else if (!poClipSrcSRS && poGeomSRS)
                 {
-                    return false;
+                    if (!m_bWarnedClipSrcSRS)
+                    {
+                        m_bWarnedClipSrcSRS = true;
+                        CPLError(
+                            CE_Warning, CPLE_AppDefined,
+                            "Clip source geometry has no attached SRS, "
+                            "but the feature's geometry has one. "
+                            "Assuming clip source geometry SRS is the "
+                            "same as the feature's geometry");
+                    }
                 }
-                nTotalEventsDone = 0;
             }
-
-            CPLErrorReset();
-            if (psInfo->m_bCanAvoidSetFrom)
+            OGRGeometry *poClipped = poDstGeometry->Intersection(
+                oCtxt.m_poClipSrcReprojectedToSrcSRS
+                    ? oCtxt.m_poClipSrcReprojectedToSrcSRS.get()
+                    : m_poClipSrcOri);
+            if (poClipped == nullptr || poClipped->IsEmpty())
             {
-                poDstFeature = std::move(poFeature);
-                // From now on, poFeature is null !
-                poDstFeature->SetFDefnUnsafe(poDstFDefn);
-                poDstFeature->SetFID(nDesiredFID);
+                delete poDstGeometry;
+                delete poClipped;
+                return FeatureProcessingResult::DISCARDED;
             }
-            else
+
+            const int nDim = poDstGeometry->getDimension();
+            if (poClipped->getDimension() < nDim &&
+                wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
+                    wkbUnknown)
             {
-                /* Optimization to avoid duplicating the source geometry in the
-                 */
-                /* target feature : we steal it from the source feature for
-                 * now... */
-                OGRGeometry *poStolenGeometry = nullptr;
-                if (!bExplodeCollections && nSrcGeomFieldCount == 1 &&
-                    (nDstGeomFieldCount == 1 ||
-                     (nDstGeomFieldCount == 0 && m_poClipSrcOri)))
-                {
-                    poStolenGeometry = poFeature->StealGeometry();
-                }
-                else if (!bExplodeCollections && iRequestedSrcGeomField >= 0)
-                {
-                    poStolenGeometry =
-                        poFeature->StealGeometry(iRequestedSrcGeomField);
-                }
+                CPLDebug(
+                    "OGR2OGR",
+                    "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                    "as its intersection with -clipsrc is a %s "
+                    "whereas the input is a %s",
+                    nSrcFID, poSrcLayer->GetName(),
+                    OGRToOGCGeomType(poClipped->getGeometryType()),
+                    OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                delete poDstGeometry;
+                delete poClipped;
+                return FeatureProcessingResult::DISCARDED;
+            }
+
+            delete poDstGeometry;
+            poDstGeometry = poClipped;
+        }
+
+        // Each thread context owns its own copy of the transformations
+        OGRCoordinateTransformation *const poCT =
+            oCtxt.m_apoCT.empty() ? psInfo->m_apoCT[iGeom].get()
+                                  : oCtxt.m_apoCT[iGeom].get();
+        char **const papszTransformOptions =
+            psInfo->m_aosTransformOptions[iGeom].List();
+
+        if (poCT != nullptr || papszTransformOptions != nullptr)
+        {
+            OGRGeometry *poReprojectedGeom =
+                OGRGeometryFactory::transformWithOptions(
+                    poDstGeometry, poCT, papszTransformOptions,
+                    oCtxt.m_transformWithOptionsCache);
+            if (poReprojectedGeom == nullptr)
+                eResult = FeatureProcessingResult::REPROJECTION_FAILED;
+
+            delete poDstGeometry;
+            poDstGeometry = poReprojectedGeom;
+        }
+        else if (poOutputSRS != nullptr)
+        {
+            poDstGeometry->assignSpatialReference(poOutputSRS);
+        }
 
-                if (nDstGeomFieldCount == 0 && poStolenGeometry &&
-                    m_poClipSrcOri)
+        if (poDstGeometry != nullptr)
+        {
+            if (m_poClipDstOri)
+            {
+                auto poGeomSRS = poDstGeometry->getSpatialReference();
+                if (oCtxt.m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
                 {
-                    auto poGeomSRS = poStolenGeometry->getSpatialReference();
-                    if (m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
+                    std::lock_guard<std::mutex> oLock(m_oMutex);
+                    auto poClipDstSRS = m_poClipDstOri->getSpatialReference();
+                    if (poClipDstSRS && poGeomSRS &&
+                        !poClipDstSRS->IsSame(poGeomSRS))
                     {
-                        auto poClipSrcSRS =
-                            m_poClipSrcOri->getSpatialReference();
-                        if (poClipSrcSRS && poGeomSRS &&
-                            !poClipSrcSRS->IsSame(poGeomSRS))
-                        {
-                            // Transform clip geom to geometry SRS
-                            m_poClipSrcReprojectedToSrcSRS.reset(
-                                m_poClipSrcOri->clone());
-                            if (m_poClipSrcReprojectedToSrcSRS->transformTo(
-                                    poGeomSRS) != OGRERR_NONE)
-                            {
-                                delete poStolenGeometry;
-                                goto end_loop;
-                            }
-                            m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
-                        }
-                        else if (!poClipSrcSRS && poGeomSRS)
+                        // Transform clip geom to geometry SRS
+                        oCtxt.m_poClipDstReprojectedToDstSRS.reset(
+                            m_poClipDstOri->clone());
+                        if (oCtxt.m_poClipDstReprojectedToDstSRS->transformTo(
+                                poGeomSRS) != OGRERR_NONE)
                         {
-                            if (!m_bWarnedClipSrcSRS)
-                            {
-                                m_bWarnedClipSrcSRS = true;
-                                CPLError(
-                                    CE_Warning, CPLE_AppDefined,
-                                    "Clip source geometry has no attached SRS, "
-                                    "but the feature's geometry has one. "
-                                    "Assuming clip source geometry SRS is the "
-                                    "same as the feature's geometry");
-                            }
+                            delete poDstGeometry;
+                            return FeatureProcessingResult::DISCARDED;
                         }
+                        oCtxt.m_poClipDstReprojectedToDstSRS_SRS = poGeomSRS;
                     }
-                    OGRGeometry *poClipped = poStolenGeometry->Intersection(
-                        m_poClipSrcReprojectedToSrcSRS
-                            ? m_poClipSrcReprojectedToSrcSRS.get()
-                            : m_poClipSrcOri);
-                    delete poStolenGeometry;
-                    poStolenGeometry = nullptr;
-                    if (poClipped == nullptr || poClipped->IsEmpty())
-                    {
-                        delete poClipped;
-                        goto end_loop;
-                    }
-                    delete poClipped;
-                }
-
-                poDstFeature->Reset();
-                if (poDstFeature->SetFrom(poFeature.get(), panMap, TRUE) !=
-                    OGRERR_NONE)
-                {
-                    if (psOptions->nGroupTransactions)
+                    else if (!poClipDstSRS && poGeomSRS)
                     {
-                        if (psOptions->nLayerTransaction)
+                        if (!m_bWarnedClipDstSRS)
                         {
-                            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
-                            {
-                                OGRGeometryFactory::destroyGeometry(
-                                    poStolenGeometry);
-                                return false;
-                            }
+                            m_bWarnedClipDstSRS = true;
+                            CPLError(CE_Warning, CPLE_AppDefined,
+                                     "Clip destination geometry has no "
+                                     "attached SRS, but the feature's "
+                                     "geometry has one. Assuming clip "
+                                     "destination geometry SRS is the "
+                                     "same as the feature's geometry");
                         }
                     }
-
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Unable to translate feature " CPL_FRMT_GIB
-                             " from layer %s.",
-                             nSrcFID, poSrcLayer->GetName());
-
-                    OGRGeometryFactory::destroyGeometry(poStolenGeometry);
-                    return false;
                 }
-
-                /* ... and now we can attach the stolen geometry */
-                if (poStolenGeometry)
+                OGRGeometry *poClipped = poDstGeometry->Intersection(
+                    oCtxt.m_poClipDstReprojectedToDstSRS
+                        ? oCtxt.m_poClipDstReprojectedToDstSRS.get()
+                        : m_poClipDstOri);
+                if (poClipped == nullptr || poClipped->IsEmpty())
                 {
-                    poDstFeature->SetGeometryDirectly(poStolenGeometry);
+                    delete poDstGeometry;
+                    delete poClipped;
+                    return FeatureProcessingResult::DISCARDED;
                 }
 
-                if (!psInfo->m_oMapResolved.empty())
+                const int nDim = poDstGeometry->getDimension();
+                if (poClipped->getDimension() < nDim &&
+                    wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
+                                   ->GetType()) != wkbUnknown)
                 {
-                    for (const auto &kv : psInfo->m_oMapResolved)
-                    {
-                        const int nDstField = kv.first;
-                        const int nSrcField = kv.second.nSrcField;
-                        if (poFeature->IsFieldSetAndNotNull(nSrcField))
-                        {
-                            const auto poDomain = kv.second.poDomain;
-                            const auto &oMapKV =
-                                psInfo->m_oMapDomainToKV[poDomain];
-                            const auto iter = oMapKV.find(
-                                poFeature->GetFieldAsString(nSrcField));
-                            if (iter != oMapKV.end())
-                            {
-                                poDstFeature->SetField(nDstField,
-                                                       iter->second.c_str());
-                            }
-                        }
-                    }
+                    CPLDebug(
+                        "OGR2OGR",
+                        "Discarding feature " CPL_FRMT_GIB
+                        " of layer %s, "
+                        "as its intersection with -clipdst is a %s "
+                        "whereas the input is a %s",
+                        nSrcFID, poSrcLayer->GetName(),
+                        OGRToOGCGeomType(poClipped->getGeometryType()),
+                        OGRToOGCGeomType(
+                            poDstGeometry->getGeometryType()));
+                    delete poDstGeometry;
+                    delete poClipped;
+                    return FeatureProcessingResult::DISCARDED;
                 }
 
-                if (nDesiredFID != OGRNullFID)
-                    poDstFeature->SetFID(nDesiredFID);
+                delete poDstGeometry;
+                poDstGeometry = poClipped;
             }
 
-            if (psOptions->bEmptyStrAsNull)
+            if (m_bMakeValid)
             {
-                for (int i = 0; i < poDstFeature->GetFieldCount(); i++)
+                const bool bIsGeomCollection =
+                    wkbFlatten(poDstGeometry->getGeometryType()) ==
+                    wkbGeometryCollection;
+                OGRGeometry *poValidGeom = poDstGeometry->MakeValid();
+                delete poDstGeometry;
+                poDstGeometry = poValidGeom;
+                if (poDstGeometry == nullptr)
+                    return FeatureProcessingResult::DISCARDED;
+                if (!bIsGeomCollection)
                 {
-                    if (!poDstFeature->IsFieldSetAndNotNull(i))
-                        continue;
-                    auto fieldDef = poDstFeature->GetFieldDefnRef(i);
-                    if (fieldDef->GetType() != OGRFieldType::OFTString)
-                        continue;
-                    auto str = poDstFeature->GetFieldAsString(i);
-                    if (strcmp(str, "") == 0)
-                        poDstFeature->SetFieldNull(i);
+                    OGRGeometry *poCleanedGeom = OGRGeometryFactory::
+                        removeLowerDimensionSubGeoms(poDstGeometry);
+                    delete poDstGeometry;
+                    poDstGeometry = poCleanedGeom;
                 }
             }
 
-            /* Erase native data if asked explicitly */
-            if (!m_bNativeData)
+            if (m_eGType != GEOMTYPE_UNCHANGED)
+            {
+                poDstGeometry = OGRGeometryFactory::forceTo(
+                    poDstGeometry, static_cast<OGRwkbGeometryType>(m_eGType));
+            }
+            else if (m_eGeomTypeConversion == GTC_PROMOTE_TO_MULTI ||
+                     m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
+                     m_eGeomTypeConversion ==
+                         GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR ||
+                     m_eGeomTypeConversion == GTC_CONVERT_TO_CURVE)
             {
-                poDstFeature->SetNativeData(nullptr);
-                poDstFeature->SetNativeMediaType(nullptr);
+                OGRwkbGeometryType eTargetType =
+                    poDstGeometry->getGeometryType();
+                eTargetType = ConvertType(m_eGeomTypeConversion, eTargetType);
+                poDstGeometry =
+                    OGRGeometryFactory::forceTo(poDstGeometry, eTargetType);
             }
+        }
+
+        poDstFeature->SetGeomFieldDirectly(iGeom, poDstGeometry);
+    }
+
+    return eResult;
+}
 
-            for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
+/************************************************************************/
+/*                LayerTranslator::ProcessFeaturesJob()                 */
+/************************************************************************/
+
+void LayerTranslator::ProcessFeaturesJob(void *pData)
+{
+    const auto psJob = static_cast<FeatureProcessingJob *>(pData);
+    LayerTranslator *poThis = psJob->m_poTranslator;
+    TargetLayerInfo *psInfo = psJob->m_psInfo;
+    const auto poDstFDefn = psInfo->m_poDstLayer->GetLayerDefn();
+    for (size_t i = psJob->m_nStart; i < psJob->m_nEnd; ++i)
+    {
+        FeatureToTranslate &oFeature = (*psJob->m_paoFeatures)[i];
+        // Errors are emitted again in the calling thread, in feature order,
+        // so that its error handler gets them.
+        CPLInstallErrorHandlerAccumulator(oFeature.m_aoErrors);
+        std::unique_ptr<OGRGeometryCollection> poCollToExplode;
+        int iGeomCollToExplode = -1;
+        const int nIters = poThis->GetCollectionToExplode(
+            psInfo, oFeature.m_poSrcFeature.get(), poCollToExplode,
+            iGeomCollToExplode);
+        oFeature.m_nSrcFID = oFeature.m_poSrcFeature->GetFID();
+        oFeature.m_nDesiredFID =
+            GetDesiredFID(psInfo, oFeature.m_poSrcFeature.get());
+        for (int iPart = 0; iPart < nIters; ++iPart)
+        {
+            std::unique_ptr<OGRFeature> poDstFeature;
+            if (!psInfo->m_bCanAvoidSetFrom)
+                poDstFeature = cpl::make_unique<OGRFeature>(poDstFDefn);
+            const auto eResult = poThis->ProcessFeature(
+                psInfo, oFeature.m_poSrcFeature, poDstFeature,
+                poCollToExplode.get(), iGeomCollToExplode, oFeature.m_nSrcFID,
+                oFeature.m_nDesiredFID, psJob->m_poOutputSRS, *psJob->m_poCtxt,
+                psJob->m_psOptions);
+            oFeature.m_aeResults.push_back(eResult);
+            oFeature.m_apoDstFeatures.push_back(std::move(poDstFeature));
+            if (eResult == FeatureProcessingResult::TRANSLATION_FAILED ||
+                eResult == FeatureProcessingResult::REPROJECTION_FAILED)
             {
-                OGRGeometry *poDstGeometry;
+                break;
+            }
+        }
+        CPLUninstallErrorHandlerAccumulator();
+    }
+}
 
-                if (poCollToExplode && iGeom == iGeomCollToExplode)
-                {
-                    OGRGeometry *poPart = poCollToExplode->getGeometryRef(0);
-                    poCollToExplode->removeGeometry(0, FALSE);
-                    poDstGeometry = poPart;
-                    assert(poDstGeometry);
-                }
-                else
-                {
-                    poDstGeometry = poDstFeature->StealGeometry(iGeom);
-                    if (poDstGeometry == nullptr)
-                        continue;
-                }
+/************************************************************************/
+/*               LayerTranslator::SetupCTWithoutFeature()               */
+/************************************************************************/
 
-                // poFeature hasn't been moved if iSrcZField != -1
-                // cppcheck-suppress accessMoved
-                if (iSrcZField != -1 && poFeature != nullptr)
-                {
-                    SetZ(poDstGeometry,
-                         poFeature->GetFieldAsDouble(iSrcZField));
-                    /* This will correct the coordinate dimension to 3 */
-                    OGRGeometry *poDupGeometry = poDstGeometry->clone();
-                    delete poDstGeometry;
-                    poDstGeometry = poDupGeometry;
-                }
+/** Sets up the coordinate transformations before any feature is read, as
+ * needed by the batch translation modes. Returns false if they depend on
+ * the features. */
+bool LayerTranslator::SetupCTWithoutFeature(TargetLayerInfo *psInfo,
+                                            OGRSpatialReference *poOutputSRS,
+                                            bool &bSetupCTOK)
+{
+    if (!m_bTransform && !bSetupCTOK)
+    {
+        // Without reprojection, a transformation is only needed to
+        // apply GCPs or to swap axis, which requires a source SRS.
+        OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+        const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
+        bool bHasSrcSRS = m_poUserSourceSRS != nullptr;
+        for (int i = 0; !bHasSrcSRS && i < poSrcFDefn->GetGeomFieldCount();
+             ++i)
+        {
+            bHasSrcSRS =
+                poSrcFDefn->GetGeomFieldDefn(i)->GetSpatialRef() != nullptr;
+        }
+        if (m_poGCPCoordTrans == nullptr && !bHasSrcSRS && !m_bWrapDateline)
+        {
+            return true;
+        }
+        bSetupCTOK = SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
+                             m_osDateLineOffset, m_poUserSourceSRS, nullptr,
+                             poOutputSRS, m_poGCPCoordTrans, false);
+    }
+    return bSetupCTOK && !psInfo->m_bPerFeatureCT;
+}
 
-                if (m_nCoordDim == 2 || m_nCoordDim == 3)
-                {
-                    poDstGeometry->setCoordinateDimension(m_nCoordDim);
-                }
-                else if (m_nCoordDim == 4)
-                {
-                    poDstGeometry->set3D(TRUE);
-                    poDstGeometry->setMeasured(TRUE);
-                }
-                else if (m_nCoordDim == COORD_DIM_XYM)
-                {
-                    poDstGeometry->set3D(FALSE);
-                    poDstGeometry->setMeasured(TRUE);
-                }
-                else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
+/************************************************************************/
+/*               LayerTranslator::TranslateMultiThreaded()              */
+/************************************************************************/
+
+/** Translates a layer with a pipeline of three stages: source features are
+ * read by batches in a dedicated thread, processed in parallel by the
+ * global thread pool, and written in order in the calling thread.
+ */
+bool LayerTranslator::TranslateMultiThreaded(
+    TargetLayerInfo *psInfo, GIntBig nCountLayerFeatures,
+    GIntBig *pnReadFeatureCount, GIntBig &nTotalEventsDone,
+    GDALProgressFunc pfnProgress, void *pProgressArg,
+    GDALVectorTranslateOptions *psOptions, OGRSpatialReference *poOutputSRS,
+    std::vector<std::unique_ptr<FeatureProcessingContext>> &apoContexts)
+{
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+    const int nThreads = static_cast<int>(apoContexts.size());
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+    if (poJobQueue == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot create thread pool");
+        return false;
+    }
+
+    // Batches must be large enough to amortize the synchronization costs,
+    // and small enough to bound memory usage.
+    using Batch = std::vector<FeatureToTranslate>;
+    const size_t nBatchSize = static_cast<size_t>(256) * nThreads;
+    constexpr size_t MAX_QUEUED_BATCHES = 2;
+
+    GIntBig nRemainingToRead = m_nLimit;
+    bool bReadError = false;
+    // When called from the reader thread, paoErrors collects the errors
+    // emitted by GetNextFeature(), which are attached to the feature read.
+    const auto ReadBatch =
+        [poSrcLayer, nBatchSize, &nRemainingToRead, &bReadError](
+            Batch &oBatch,
+            std::vector<CPLErrorHandlerAccumulatorStruct> *paoErrors)
+    {
+        while (oBatch.size() < nBatchSize && nRemainingToRead != 0)
+        {
+            CPLErrorReset();
+            OGRFeature *poFeature = poSrcLayer->GetNextFeature();
+            if (poFeature == nullptr)
+            {
+                bReadError = CPLGetLastErrorType() == CE_Failure;
+                return false;
+            }
+            if (nRemainingToRead > 0)
+                --nRemainingToRead;
+            oBatch.emplace_back();
+            oBatch.back().m_poSrcFeature.reset(poFeature);
+            if (paoErrors && !paoErrors->empty())
+            {
+                oBatch.back().m_aoErrors = std::move(*paoErrors);
+                paoErrors->clear();
+            }
+        }
+        return nRemainingToRead != 0;
+    };
+
+    // Datasets are not thread-safe, so source features can only be read in
+    // a separate thread if the source and target datasets are different.
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::deque<std::unique_ptr<Batch>> apoReadBatches;
+    bool bReadFinished = false;
+    bool bStopReading = false;
+    std::thread oReaderThread;
+    // Errors of the reader thread not attached to a feature, that is
+    // emitted by the last GetNextFeature() call
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoReaderErrors;
+    const bool bUseReaderThread = m_poSrcDS != m_poODS;
+    if (bUseReaderThread)
+    {
+        oReaderThread = std::thread(
+            [&]()
+            {
+                std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+                CPLInstallErrorHandlerAccumulator(aoErrors);
+                bool bMore = true;
+                while (bMore)
                 {
-                    const OGRwkbGeometryType eDstLayerGeomType =
-                        poDstLayer->GetLayerDefn()
-                            ->GetGeomFieldDefn(iGeom)
-                            ->GetType();
-                    poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
-                    poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+                    auto poBatch = cpl::make_unique<Batch>();
+                    poBatch->reserve(nBatchSize);
+                    bMore = ReadBatch(*poBatch, &aoErrors);
+                    std::unique_lock<std::mutex> oLock(oMutex);
+                    oCV.wait(oLock,
+                             [&]()
+                             {
+                                 return bStopReading ||
+                                        apoReadBatches.size() <
+                                            MAX_QUEUED_BATCHES;
+                             });
+                    if (bStopReading)
+                        break;
+                    if (!poBatch->empty())
+                        apoReadBatches.push_back(std::move(poBatch));
+                    bReadFinished = !bMore;
+                    if (bReadFinished)
+                        aoReaderErrors = std::move(aoErrors);
+                    oCV.notify_all();
                 }
+                CPLUninstallErrorHandlerAccumulator();
+            });
+    }
+
+    const auto GetNextBatch = [&]()
+    {
+        std::unique_ptr<Batch> poBatch;
+        if (!bUseReaderThread)
+        {
+            if (!bReadFinished)
+            {
+                poBatch = cpl::make_unique<Batch>();
+                poBatch->reserve(nBatchSize);
+                bReadFinished = !ReadBatch(*poBatch, nullptr);
+                if (poBatch->empty())
+                    poBatch.reset();
+            }
+            return poBatch;
+        }
+        std::unique_lock<std::mutex> oLock(oMutex);
+        oCV.wait(oLock,
+                 [&]() { return bReadFinished || !apoReadBatches.empty(); });
+        if (!apoReadBatches.empty())
+        {
+            poBatch = std::move(apoReadBatches.front());
+            apoReadBatches.pop_front();
+            oCV.notify_all();
+        }
+        return poBatch;
+    };
+
+    std::vector<FeatureProcessingJob> asJobs(nThreads);
+    const auto SubmitBatch = [&](Batch &oBatch)
+    {
+        const size_t nChunkSize = (oBatch.size() + nThreads - 1) / nThreads;
+        for (int i = 0; i < nThreads; ++i)
+        {
+            FeatureProcessingJob &sJob = asJobs[i];
+            sJob.m_poTranslator = this;
+            sJob.m_psInfo = psInfo;
+            sJob.m_paoFeatures = &oBatch;
+            sJob.m_nStart = std::min(oBatch.size(), i * nChunkSize);
+            sJob.m_nEnd = std::min(oBatch.size(), sJob.m_nStart + nChunkSize);
+            sJob.m_poOutputSRS = poOutputSRS;
+            sJob.m_poCtxt = apoContexts[i].get();
+            sJob.m_psOptions = psOptions;
+            if (sJob.m_nStart < sJob.m_nEnd)
+                poJobQueue->SubmitJob(ProcessFeaturesJob, &sJob);
+        }
+    };
 
-                if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+    bool bRet = true;
+    // Set when an error must be returned without committing the current
+    // layer transaction, consistently with Translate()
+    bool bAbort = false;
+    int nFeaturesInTransaction = 0;
+    GIntBig nCount = 0; /* written + failed */
+    GIntBig nFeaturesWritten = 0;
+
+    auto poCurBatch = GetNextBatch();
+    if (poCurBatch)
+        SubmitBatch(*poCurBatch);
+    while (poCurBatch && bRet)
+    {
+        // Fetch the next batch while the current one is being processed,
+        // and process it while the current one is being written.
+        auto poNextBatch = GetNextBatch();
+        poJobQueue->WaitCompletion();
+        if (poNextBatch)
+            SubmitBatch(*poNextBatch);
+
+        for (auto &oFeature : *poCurBatch)
+        {
+            for (const auto &oError : oFeature.m_aoErrors)
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            psInfo->m_nFeaturesRead++;
+            const GIntBig nSrcFID = oFeature.m_nSrcFID;
+            const GIntBig nDesiredFID = oFeature.m_nDesiredFID;
+            for (size_t iPart = 0; bRet && iPart < oFeature.m_aeResults.size();
+                 ++iPart)
+            {
+                if (psOptions->nLayerTransaction &&
+                    ++nFeaturesInTransaction == psOptions->nGroupTransactions)
                 {
-                    if (m_dfGeomOpParam > 0)
-                        poDstGeometry->segmentize(m_dfGeomOpParam);
+                    if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
+                        poDstLayer->StartTransaction() == OGRERR_FAILURE)
+                    {
+                        bRet = false;
+                        bAbort = true;
+                        break;
+                    }
+                    nFeaturesInTransaction = 0;
                 }
-                else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+                else if (!psOptions->nLayerTransaction &&
+                         psOptions->nGroupTransactions >= 0 &&
+                         ++nTotalEventsDone >= psOptions->nGroupTransactions)
                 {
-                    if (m_dfGeomOpParam > 0)
+                    if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
+                        m_poODS->StartTransaction(
+                            psOptions->bForceTransaction) == OGRERR_FAILURE)
                     {
-                        OGRGeometry *poNewGeom =
-                            poDstGeometry->SimplifyPreserveTopology(
-                                m_dfGeomOpParam);
-                        if (poNewGeom)
-                        {
-                            delete poDstGeometry;
-                            poDstGeometry = poNewGeom;
-                        }
+                        bRet = false;
+                        bAbort = true;
+                        break;
                     }
+                    nTotalEventsDone = 0;
                 }
 
-                if (m_poClipSrcOri)
+                const FeatureProcessingResult eResult =
+                    oFeature.m_aeResults[iPart];
+                if (eResult == FeatureProcessingResult::DISCARDED)
+                    continue;
+                if (eResult != FeatureProcessingResult::OK)
                 {
-                    auto poGeomSRS = poDstGeometry->getSpatialReference();
-                    if (m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
+                    if (psOptions->nGroupTransactions &&
+                        psOptions->nLayerTransaction)
                     {
-                        auto poClipSrcSRS =
-                            m_poClipSrcOri->getSpatialReference();
-                        if (poClipSrcSRS && poGeomSRS &&
-                            !poClipSrcSRS->IsSame(poGeomSRS))
-                        {
-                            // Transform clip geom to geometry SRS
-                            m_poClipSrcReprojectedToSrcSRS.reset(
-                                m_poClipSrcOri->clone());
-                            if (m_poClipSrcReprojectedToSrcSRS->transformTo(
-                                    poGeomSRS) != OGRERR_NONE)
-                            {
-                                delete poDstGeometry;
-                                goto end_loop;
-                            }
-                            m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
-                        }
-                        else if (!poClipSrcSRS && poGeomSRS)
-                        {
-                            if (!m_bWarnedClipSrcSRS)
-                            {
-                                m_bWarnedClipSrcSRS = true;
-                                CPLError(
-                                    CE_Warning, CPLE_AppDefined,
-                                    "Clip source geometry has no attached SRS, "
-                                    "but the feature's geometry has one. "
-                                    "Assuming clip source geometry SRS is the "
-                                    "same as the feature's geometry");
-                            }
-                        }
+                        poDstLayer->CommitTransaction();
                     }
-                    OGRGeometry *poClipped = poDstGeometry->Intersection(
-                        m_poClipSrcReprojectedToSrcSRS
-                            ? m_poClipSrcReprojectedToSrcSRS.get()
-                            : m_poClipSrcOri);
-                    if (poClipped == nullptr || poClipped->IsEmpty())
+                    if (eResult == FeatureProcessingResult::TRANSLATION_FAILED)
                     {
-                        delete poDstGeometry;
-                        delete poClipped;
-                        goto end_loop;
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Unable to translate feature " CPL_FRMT_GIB
+                                 " from layer %s.",
+                                 nSrcFID, poSrcLayer->GetName());
                     }
+                    else
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Failed to reproject feature " CPL_FRMT_GIB
+                                 " (geometry probably out of source or "
+                                 "destination SRS).",
+                                 nSrcFID);
+                    }
+                    bRet = false;
+                    bAbort = true;
+                    break;
+                }
 
-                    const int nDim = poDstGeometry->getDimension();
-                    if (poClipped->getDimension() < nDim &&
-                        wkbFlatten(
-                            poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
-                            wkbUnknown)
+                OGRFeature *poDstFeature =
+                    oFeature.m_apoDstFeatures[iPart].get();
+                CPLErrorReset();
+                if ((psOptions->bUpsert
+                         ? poDstLayer->UpsertFeature(poDstFeature)
+                         : poDstLayer->CreateFeature(poDstFeature)) ==
+                    OGRERR_NONE)
+                {
+                    nFeaturesWritten++;
+                    if (nDesiredFID != OGRNullFID &&
+                        poDstFeature->GetFID() != nDesiredFID)
                     {
-                        CPLDebug(
-                            "OGR2OGR",
-                            "Discarding feature " CPL_FRMT_GIB " of layer %s, "
-                            "as its intersection with -clipsrc is a %s "
-                            "whereas the input is a %s",
-                            nSrcFID, poSrcLayer->GetName(),
-                            OGRToOGCGeomType(poClipped->getGeometryType()),
-                            OGRToOGCGeomType(poDstGeometry->getGeometryType()));
-                        delete poDstGeometry;
-                        delete poClipped;
-                        goto end_loop;
+                        CPLError(CE_Warning, CPLE_AppDefined,
+                                 "Feature id not preserved");
+                    }
+                }
+                else
+                {
+                    if (psOptions->nGroupTransactions &&
+                        psOptions->nLayerTransaction)
+                    {
+                        poDstLayer->RollbackTransaction();
                     }
 
-                    delete poDstGeometry;
-                    poDstGeometry = poClipped;
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Unable to write feature " CPL_FRMT_GIB
+                             " from layer %s.",
+                             nSrcFID, poSrcLayer->GetName());
+                    bRet = false;
+                    bAbort = true;
                 }
+            }
+            if (!bRet)
+                break;
+
+            /* Report progress */
+            nCount++;
+            if (pfnProgress &&
+                !pfnProgress(nCountLayerFeatures
+                                 ? nCount * 1.0 / nCountLayerFeatures
+                                 : 1.0,
+                             "", pProgressArg))
+            {
+                bRet = false;
+                break;
+            }
+
+            if (pnReadFeatureCount)
+                *pnReadFeatureCount = nCount;
+        }
+
+        poCurBatch = std::move(poNextBatch);
+    }
+
+    // Stop the pipeline
+    poJobQueue->WaitCompletion();
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        bStopReading = true;
+    }
+    oCV.notify_all();
+    if (oReaderThread.joinable())
+        oReaderThread.join();
+    for (const auto &oError : aoReaderErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+
+    if (bAbort)
+        return false;
+    if (bReadError)
+        bRet = false;
+
+    if (psOptions->nGroupTransactions)
+    {
+        if (psOptions->nLayerTransaction)
+        {
+            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
+                bRet = false;
+        }
+    }
+
+    CPLDebug("GDALVectorTranslate",
+             CPL_FRMT_GIB " features written in layer '%s' with %d threads",
+             nFeaturesWritten, poDstLayer->GetName(), nThreads);
+
+    return bRet;
+}
+
+/************************************************************************/
+/*               LayerTranslator::CanUseWriteArrowBatch()               */
+/************************************************************************/
+
+/** Returns whether the layer can be translated with GetArrowStream() and
+ * WriteArrowBatch(), that is when no option requires per-feature processing
+ * and fields map one-to-one between the source and target layers.
+ */
+bool LayerTranslator::CanUseWriteArrowBatch(
+    TargetLayerInfo *psInfo, GDALVectorTranslateOptions *psOptions) const
+{
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+
+    const char *pszUseArrowAPI =
+        CPLGetConfigOption("OGR2OGR_USE_ARROW_API", nullptr);
+    if (pszUseArrowAPI && !CPLTestBool(pszUseArrowAPI))
+        return false;
+    const bool bForce = pszUseArrowAPI != nullptr;
+    if (!bForce && !(poSrcLayer->TestCapability(OLCFastGetArrowStream) &&
+                     poDstLayer->TestCapability(OLCFastWriteArrowBatch)))
+    {
+        return false;
+    }
+
+    if (psOptions->bUpsert || psOptions->bSkipFailures ||
+        psOptions->bEmptyStrAsNull || m_nLimit >= 0 || m_bExplodeCollections ||
+        m_bMakeValid || m_bWrapDateline || m_eGeomOp != GEOMOP_NONE ||
+        m_poClipSrcOri != nullptr || m_poClipDstOri != nullptr ||
+        m_eGType != GEOMTYPE_UNCHANGED ||
+        m_eGeomTypeConversion != GTC_DEFAULT ||
+        m_nCoordDim != COORD_DIM_UNCHANGED || psInfo->m_iSrcZField >= 0 ||
+        psInfo->m_iSrcFIDField >= 0 || psInfo->m_iRequestedSrcGeomField >= 0 ||
+        !psInfo->m_oMapResolved.empty())
+    {
+        return false;
+    }
 
-                OGRCoordinateTransformation *const poCT =
-                    psInfo->m_apoCT[iGeom].get();
-                char **const papszTransformOptions =
-                    psInfo->m_aosTransformOptions[iGeom].List();
+    const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
+    const auto poDstFDefn = poDstLayer->GetLayerDefn();
+    int nMappedFields = 0;
+    for (int i = 0; i < poSrcFDefn->GetFieldCount(); ++i)
+    {
+        const auto poSrcFieldDefn = poSrcFDefn->GetFieldDefn(i);
+        const int iDstField = psInfo->m_anMap[i];
+        if (iDstField < 0)
+        {
+            // Unmapped fields must not be returned by GetArrowStream()
+            if (!poSrcFieldDefn->IsIgnored())
+                return false;
+            continue;
+        }
+        const auto poDstFieldDefn = poDstFDefn->GetFieldDefn(iDstField);
+        if (strcmp(poSrcFieldDefn->GetNameRef(),
+                   poDstFieldDefn->GetNameRef()) != 0 ||
+            poSrcFieldDefn->GetType() != poDstFieldDefn->GetType() ||
+            poSrcFieldDefn->GetSubType() != poDstFieldDefn->GetSubType())
+        {
+            return false;
+        }
+        // The time zone of DateTime fields is lost by the default
+        // implementation of GetArrowStream()
+        if (!bForce && poSrcFieldDefn->GetType() == OFTDateTime)
+            return false;
+        ++nMappedFields;
+    }
+    if (nMappedFields != poDstFDefn->GetFieldCount())
+        return false;
 
-                if (poCT != nullptr || papszTransformOptions != nullptr)
+    const int nSrcGeomFieldCount = poSrcFDefn->GetGeomFieldCount();
+    if (nSrcGeomFieldCount != poDstFDefn->GetGeomFieldCount())
+        return false;
+    for (int i = 0; i < nSrcGeomFieldCount; ++i)
+    {
+        const auto poSrcGeomFieldDefn = poSrcFDefn->GetGeomFieldDefn(i);
+        if (poSrcGeomFieldDefn->IsIgnored())
+            return false;
+        if (nSrcGeomFieldCount > 1 &&
+            strcmp(poSrcGeomFieldDefn->GetNameRef(),
+                   poDstFDefn->GetGeomFieldDefn(i)->GetNameRef()) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                   LayerTranslator::TranslateArrow()                  */
+/************************************************************************/
+
+/** Translates a layer by transferring batches of features obtained with
+ * GetArrowStream() to WriteArrowBatch(). Coordinate transformation, if any,
+ * is directly applied on the WKB geometry columns.
+ */
+bool LayerTranslator::TranslateArrow(TargetLayerInfo *psInfo,
+                                     GIntBig nCountLayerFeatures,
+                                     GIntBig *pnReadFeatureCount,
+                                     GIntBig &nTotalEventsDone,
+                                     GDALProgressFunc pfnProgress,
+                                     void *pProgressArg,
+                                     GDALVectorTranslateOptions *psOptions)
+{
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+    const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
+    const int nGeomFieldCount = poSrcFDefn->GetGeomFieldCount();
+
+    const char *pszSrcFIDColumn = poSrcLayer->GetFIDColumn();
+    const std::string osFIDName =
+        pszSrcFIDColumn[0] != '\0' ? pszSrcFIDColumn : "OGC_FID";
+
+    CPLStringList aosStreamOptions;
+    aosStreamOptions.SetNameValue("INCLUDE_FID",
+                                  psInfo->m_bPreserveFID ? "YES" : "NO");
+    CPLStringList aosWriteOptions;
+    if (psInfo->m_bPreserveFID)
+        aosWriteOptions.SetNameValue("FID", osFIDName.c_str());
+    if (nGeomFieldCount == 1)
+    {
+        const char *pszGeomName =
+            poSrcFDefn->GetGeomFieldDefn(0)->GetNameRef();
+        aosWriteOptions.SetNameValue(
+            "GEOMETRY_NAME", pszGeomName[0] ? pszGeomName : "wkb_geometry");
+    }
+
+    struct ArrowArrayStream stream;
+    if (!poSrcLayer->GetArrowStream(&stream, aosStreamOptions.List()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "GetArrowStream() failed on layer %s",
+                 poSrcLayer->GetName());
+        return false;
+    }
+
+    struct ArrowSchema schema;
+    if (stream.get_schema(&stream, &schema) != 0)
+    {
+        const char *pszErrMsg = stream.get_last_error(&stream);
+        CPLError(CE_Failure, CPLE_AppDefined, "get_schema() failed: %s",
+                 pszErrMsg ? pszErrMsg : "unknown error");
+        stream.release(&stream);
+        return false;
+    }
+
+    // Identify the geometry columns that must be reprojected
+    std::vector<std::pair<int, OGRCoordinateTransformation *>> aoGeomCT;
+    for (int iGeom = 0; iGeom < nGeomFieldCount; ++iGeom)
+    {
+        OGRCoordinateTransformation *poCT = psInfo->m_apoCT[iGeom].get();
+        if (poCT == nullptr)
+            continue;
+        const char *pszGeomName =
+            poSrcFDefn->GetGeomFieldDefn(iGeom)->GetNameRef();
+        if (pszGeomName[0] == '\0')
+            pszGeomName = "wkb_geometry";
+        int iCol = -1;
+        for (int64_t i = 0; i < schema.n_children; ++i)
+        {
+            if (schema.children[i]->name &&
+                strcmp(schema.children[i]->name, pszGeomName) == 0)
+            {
+                iCol = static_cast<int>(i);
+                break;
+            }
+        }
+        const char *pszFormat = iCol >= 0 ? schema.children[iCol]->format : "";
+        if (strcmp(pszFormat, "z") != 0 && strcmp(pszFormat, "Z") != 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot find binary geometry column %s in Arrow stream",
+                     pszGeomName);
+            schema.release(&schema);
+            stream.release(&stream);
+            return false;
+        }
+        aoGeomCT.emplace_back(iCol, poCT);
+    }
+
+    // Working structures used to substitute reprojected geometry columns to
+    // the ones of the source array
+    std::vector<struct ArrowArray *> apoChildren;
+    std::vector<struct ArrowArray> asGeomArrays(aoGeomCT.size());
+    std::vector<std::array<const void *, 3>> aapGeomBuffers(aoGeomCT.size());
+    std::vector<std::vector<GByte>> aabyWKB(aoGeomCT.size());
+    OGRWKBTransformCache oWKBTransformCache;
+
+    bool bRet = true;
+    GIntBig nCount = 0;
+    GIntBig nFeaturesInTransaction = 0;
+    CPLErrorReset();
+    while (true)
+    {
+        struct ArrowArray array;
+        if (stream.get_next(&stream, &array) != 0)
+        {
+            const char *pszErrMsg = stream.get_last_error(&stream);
+            CPLError(CE_Failure, CPLE_AppDefined, "get_next() failed: %s",
+                     pszErrMsg ? pszErrMsg : "unknown error");
+            bRet = false;
+            break;
+        }
+        if (array.release == nullptr)
+            break;
+
+        struct ArrowArray *psArrayToWrite = &array;
+        struct ArrowArray sReprojectedArray;
+        if (!aoGeomCT.empty())
+        {
+            sReprojectedArray = array;
+            apoChildren.assign(array.children,
+                               array.children + array.n_children);
+            sReprojectedArray.children = apoChildren.data();
+            for (size_t k = 0; bRet && k < aoGeomCT.size(); ++k)
+            {
+                const int iCol = aoGeomCT[k].first;
+                const struct ArrowArray *psGeomArray = array.children[iCol];
+                const bool bLargeBinary =
+                    schema.children[iCol]->format[0] == 'Z';
+                const uint8_t *pabyValidity =
+                    static_cast<const uint8_t *>(psGeomArray->buffers[0]);
+                const int64_t nStart = psGeomArray->offset + array.offset;
+                const auto GetOffset = [psGeomArray, bLargeBinary](int64_t i)
                 {
-                    OGRGeometry *poReprojectedGeom =
-                        OGRGeometryFactory::transformWithOptions(
-                            poDstGeometry, poCT, papszTransformOptions,
-                            m_transformWithOptionsCache);
-                    if (poReprojectedGeom == nullptr)
+                    return bLargeBinary
+                               ? static_cast<size_t>(
+                                     static_cast<const int64_t *>(
+                                         psGeomArray->buffers[1])[i])
+                               : static_cast<size_t>(
+                                     static_cast<const int32_t *>(
+                                         psGeomArray->buffers[1])[i]);
+                };
+
+                const GByte *pabyData =
+                    static_cast<const GByte *>(psGeomArray->buffers[2]);
+                auto &abyWKB = aabyWKB[k];
+                abyWKB.assign(pabyData,
+                              pabyData + GetOffset(nStart + array.length));
+                for (int64_t iRow = 0; iRow < array.length; ++iRow)
+                {
+                    const int64_t i = nStart + iRow;
+                    if (pabyValidity && psGeomArray->null_count != 0 &&
+                        (pabyValidity[i / 8] & (1 << (i % 8))) == 0)
+                    {
+                        continue;
+                    }
+                    const size_t nOffset = GetOffset(i);
+                    const size_t nSize = GetOffset(i + 1) - nOffset;
+                    if (nSize > 0 &&
+                        !OGRWKBTransform(abyWKB.data() + nOffset, nSize,
+                                         aoGeomCT[k].second,
+                                         oWKBTransformCache))
                     {
-                        if (psOptions->nGroupTransactions)
-                        {
-                            if (psOptions->nLayerTransaction)
-                            {
-                                if (poDstLayer->CommitTransaction() !=
-                                        OGRERR_NONE &&
-                                    !psOptions->bSkipFailures)
-                                {
-                                    delete poDstGeometry;
-                                    return false;
-                                }
-                            }
-                        }
-
                         CPLError(CE_Failure, CPLE_AppDefined,
                                  "Failed to reproject feature " CPL_FRMT_GIB
                                  " (geometry probably out of source or "
                                  "destination SRS).",
-                                 nSrcFID);
-                        if (!psOptions->bSkipFailures)
-                        {
-                            delete poDstGeometry;
-                            return false;
-                        }
+                                 static_cast<GIntBig>(nCount + iRow));
+                        bRet = false;
+                        break;
                     }
+                }
 
-                    delete poDstGeometry;
-                    poDstGeometry = poReprojectedGeom;
+                asGeomArrays[k] = *psGeomArray;
+                aapGeomBuffers[k] = {psGeomArray->buffers[0],
+                                     psGeomArray->buffers[1], abyWKB.data()};
+                asGeomArrays[k].buffers = aapGeomBuffers[k].data();
+                apoChildren[iCol] = &asGeomArrays[k];
+            }
+            psArrayToWrite = &sReprojectedArray;
+        }
+
+        const int64_t nBatchLength = array.length;
+        if (bRet && !poDstLayer->WriteArrowBatch(&schema, psArrayToWrite,
+                                                 aosWriteOptions.List()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unable to write batch of features from layer %s.",
+                     poSrcLayer->GetName());
+            bRet = false;
+        }
+        // The array might have been moved by WriteArrowBatch()
+        if (array.release)
+            array.release(&array);
+        if (!bRet)
+        {
+            if (psOptions->nGroupTransactions && psOptions->nLayerTransaction)
+                poDstLayer->RollbackTransaction();
+            break;
+        }
+
+        psInfo->m_nFeaturesRead += nBatchLength;
+        nCount += nBatchLength;
+
+        if (psOptions->nGroupTransactions > 0)
+        {
+            if (psOptions->nLayerTransaction)
+            {
+                nFeaturesInTransaction += nBatchLength;
+                if (nFeaturesInTransaction >= psOptions->nGroupTransactions)
+                {
+                    if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
+                        poDstLayer->StartTransaction() == OGRERR_FAILURE)
+                    {
+                        bRet = false;
+                        break;
+                    }
+                    nFeaturesInTransaction = 0;
                 }
-                else if (poOutputSRS != nullptr)
+            }
+            else
+            {
+                nTotalEventsDone += nBatchLength;
+                if (nTotalEventsDone >= psOptions->nGroupTransactions)
                 {
-                    poDstGeometry->assignSpatialReference(poOutputSRS);
+                    if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
+                        m_poODS->StartTransaction(
+                            psOptions->bForceTransaction) == OGRERR_FAILURE)
+                    {
+                        bRet = false;
+                        break;
+                    }
+                    nTotalEventsDone = 0;
                 }
+            }
+        }
+
+        /* Report progress */
+        if (pfnProgress &&
+            !pfnProgress(nCountLayerFeatures
+                             ? std::min(1.0, nCount * 1.0 / nCountLayerFeatures)
+                             : 1.0,
+                         "", pProgressArg))
+        {
+            bRet = false;
+            break;
+        }
+
+        if (pnReadFeatureCount)
+            *pnReadFeatureCount = nCount;
+    }
+
+    schema.release(&schema);
+    stream.release(&stream);
+
+    if (bRet && psOptions->nGroupTransactions && psOptions->nLayerTransaction)
+    {
+        if (poDstLayer->CommitTransaction() != OGRERR_NONE)
+            bRet = false;
+    }
+
+    CPLDebug("GDALVectorTranslate",
+             CPL_FRMT_GIB " features written in layer '%s' with the Arrow API",
+             nCount, poDstLayer->GetName());
+
+    return bRet;
+}
+
+/************************************************************************/
+/*                     LayerTranslator::Translate()                     */
+/************************************************************************/
+
+int LayerTranslator::Translate(OGRFeature *poFeatureIn, TargetLayerInfo *psInfo,
+                               GIntBig nCountLayerFeatures,
+                               GIntBig *pnReadFeatureCount,
+                               GIntBig &nTotalEventsDone,
+                               GDALProgressFunc pfnProgress, void *pProgressArg,
+                               GDALVectorTranslateOptions *psOptions)
+{
+    OGRSpatialReference *poOutputSRS = m_poOutputSRS;
+
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+    const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
+    const auto poDstFDefn = poDstLayer->GetLayerDefn();
+    const int nSrcGeomFieldCount = poSrcFDefn->GetGeomFieldCount();
+    const int iRequestedSrcGeomField = psInfo->m_iRequestedSrcGeomField;
+
+    if (poOutputSRS == nullptr && !m_bNullifyOutputSRS)
+    {
+        if (nSrcGeomFieldCount == 1)
+        {
+            poOutputSRS = poSrcLayer->GetSpatialRef();
+        }
+        else if (iRequestedSrcGeomField > 0)
+        {
+            poOutputSRS = poSrcLayer->GetLayerDefn()
+                              ->GetGeomFieldDefn(iRequestedSrcGeomField)
+                              ->GetSpatialRef();
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Transfer features.                                              */
+    /* -------------------------------------------------------------------- */
+    if (psOptions->nGroupTransactions)
+    {
+        if (psOptions->nLayerTransaction)
+        {
+            if (poDstLayer->StartTransaction() == OGRERR_FAILURE)
+            {
+                delete poFeatureIn;
+                return false;
+            }
+        }
+    }
+
+    std::unique_ptr<OGRFeature> poFeature;
+    std::unique_ptr<OGRFeature> poDstFeature(new OGRFeature(poDstFDefn));
+    int nFeaturesInTransaction = 0;
+    GIntBig nCount = 0; /* written + failed */
+    GIntBig nFeaturesWritten = 0;
+
+    bool bRet = true;
+    CPLErrorReset();
+
+    bool bSetupCTOK = false;
+    if (m_bTransform && psInfo->m_nFeaturesRead == 0 &&
+        !psInfo->m_bPerFeatureCT)
+    {
+        bSetupCTOK = SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
+                             m_osDateLineOffset, m_poUserSourceSRS, nullptr,
+                             poOutputSRS, m_poGCPCoordTrans, false);
+    }
+
+    if (poFeatureIn == nullptr && psOptions->nFIDToFetch == OGRNullFID &&
+        psInfo->m_nFeaturesRead == 0)
+    {
+        /* ---------------------------------------------------------------- */
+        /*      Use the Arrow batch interface if no per-feature processing  */
+        /*      is needed.                                                  */
+        /* ---------------------------------------------------------------- */
+        if (CanUseWriteArrowBatch(psInfo, psOptions) &&
+            SetupCTWithoutFeature(psInfo, poOutputSRS, bSetupCTOK) &&
+            std::all_of(psInfo->m_aosTransformOptions.begin(),
+                        psInfo->m_aosTransformOptions.end(),
+                        [](const CPLStringList &aosOptions)
+                        { return aosOptions.empty(); }))
+        {
+            return TranslateArrow(psInfo, nCountLayerFeatures,
+                                  pnReadFeatureCount, nTotalEventsDone,
+                                  pfnProgress, pProgressArg, psOptions);
+        }
 
-                if (poDstGeometry != nullptr)
+        /* ---------------------------------------------------------------- */
+        /*      Otherwise process features in several threads if asked.     */
+        /* ---------------------------------------------------------------- */
+        const int nThreads = GetNumThreads(psOptions);
+        if (nThreads > 1 && !psOptions->bSkipFailures &&
+            SetupCTWithoutFeature(psInfo, poOutputSRS, bSetupCTOK))
+        {
+            std::vector<std::unique_ptr<FeatureProcessingContext>> apoContexts;
+            bool bCanCloneCT = true;
+            for (int i = 0; bCanCloneCT && i < nThreads; ++i)
+            {
+                auto poCtxt = cpl::make_unique<FeatureProcessingContext>();
+                for (const auto &poCT : psInfo->m_apoCT)
                 {
-                    if (m_poClipDstOri)
+                    poCtxt->m_apoCT.emplace_back(poCT ? poCT->Clone()
+                                                      : nullptr);
+                    if (poCT && !poCtxt->m_apoCT.back())
                     {
-                        auto poGeomSRS = poDstGeometry->getSpatialReference();
-                        if (m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
-                        {
-                            auto poClipDstSRS =
-                                m_poClipDstOri->getSpatialReference();
-                            if (poClipDstSRS && poGeomSRS &&
-                                !poClipDstSRS->IsSame(poGeomSRS))
-                            {
-                                // Transform clip geom to geometry SRS
-                                m_poClipDstReprojectedToDstSRS.reset(
-                                    m_poClipDstOri->clone());
-                                if (m_poClipDstReprojectedToDstSRS->transformTo(
-                                        poGeomSRS) != OGRERR_NONE)
-                                {
-                                    delete poDstGeometry;
-                                    goto end_loop;
-                                }
-                                m_poClipDstReprojectedToDstSRS_SRS = poGeomSRS;
-                            }
-                            else if (!poClipDstSRS && poGeomSRS)
-                            {
-                                if (!m_bWarnedClipDstSRS)
-                                {
-                                    m_bWarnedClipDstSRS = true;
-                                    CPLError(CE_Warning, CPLE_AppDefined,
-                                             "Clip destination geometry has no "
-                                             "attached SRS, but the feature's "
-                                             "geometry has one. Assuming clip "
-                                             "destination geometry SRS is the "
-                                             "same as the feature's geometry");
-                                }
-                            }
-                        }
-                        OGRGeometry *poClipped = poDstGeometry->Intersection(
-                            m_poClipDstReprojectedToDstSRS
-                                ? m_poClipDstReprojectedToDstSRS.get()
-                                : m_poClipDstOri);
-                        if (poClipped == nullptr || poClipped->IsEmpty())
-                        {
-                            delete poDstGeometry;
-                            delete poClipped;
-                            goto end_loop;
-                        }
+                        CPLDebug("GDALVectorTranslate",
+                                 "Coordinate transformation cannot be "
+                                 "cloned. Using a single thread");
+                        bCanCloneCT = false;
+                        break;
+                    }
+                }
+                apoContexts.emplace_back(std::move(poCtxt));
+            }
+            if (bCanCloneCT)
+            {
+                return TranslateMultiThreaded(
+                    psInfo, nCountLayerFeatures, pnReadFeatureCount,
+                    nTotalEventsDone, pfnProgress, pProgressArg, psOptions,
+                    poOutputSRS, apoContexts);
+            }
+        }
+    }
 
-                        const int nDim = poDstGeometry->getDimension();
-                        if (poClipped->getDimension() < nDim &&
-                            wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
-                                           ->GetType()) != wkbUnknown)
-                        {
-                            CPLDebug(
-                                "OGR2OGR",
-                                "Discarding feature " CPL_FRMT_GIB
-                                " of layer %s, "
-                                "as its intersection with -clipdst is a %s "
-                                "whereas the input is a %s",
-                                nSrcFID, poSrcLayer->GetName(),
-                                OGRToOGCGeomType(poClipped->getGeometryType()),
-                                OGRToOGCGeomType(
-                                    poDstGeometry->getGeometryType()));
-                            delete poDstGeometry;
-                            delete poClipped;
-                            goto end_loop;
-                        }
+    while (true)
+    {
+        if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
+        {
+            break;
+        }
 
-                        delete poDstGeometry;
-                        poDstGeometry = poClipped;
-                    }
+        if (poFeatureIn != nullptr)
+            poFeature.reset(poFeatureIn);
+        else if (psOptions->nFIDToFetch != OGRNullFID)
+            poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
+        else
+            poFeature.reset(poSrcLayer->GetNextFeature());
+
+        if (poFeature == nullptr)
+        {
+            if (CPLGetLastErrorType() == CE_Failure)
+            {
+                bRet = false;
+            }
+            break;
+        }
+
+        if (!bSetupCTOK &&
+            (psInfo->m_nFeaturesRead == 0 || psInfo->m_bPerFeatureCT))
+        {
+            if (!SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
+                         m_osDateLineOffset, m_poUserSourceSRS, poFeature.get(),
+                         poOutputSRS, m_poGCPCoordTrans, true))
+            {
+                return false;
+            }
+        }
+
+        psInfo->m_nFeaturesRead++;
 
-                    if (m_bMakeValid)
+        std::unique_ptr<OGRGeometryCollection> poCollToExplode;
+        int iGeomCollToExplode = -1;
+        const int nIters = GetCollectionToExplode(
+            psInfo, poFeature.get(), poCollToExplode, iGeomCollToExplode);
+
+        const GIntBig nSrcFID = poFeature->GetFID();
+        const GIntBig nDesiredFID = GetDesiredFID(psInfo, poFeature.get());
+
+        for (int iPart = 0; iPart < nIters; iPart++)
+        {
+            if (psOptions->nLayerTransaction &&
+                ++nFeaturesInTransaction == psOptions->nGroupTransactions)
+            {
+                if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
+                    poDstLayer->StartTransaction() == OGRERR_FAILURE)
+                {
+                    return false;
+                }
+                nFeaturesInTransaction = 0;
+            }
+            else if (!psOptions->nLayerTransaction &&
+                     psOptions->nGroupTransactions >= 0 &&
+                     ++nTotalEventsDone >= psOptions->nGroupTransactions)
+            {
+                if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
+                    m_poODS->StartTransaction(psOptions->bForceTransaction) ==
+                        OGRERR_FAILURE)
+                {
+                    return false;
+                }
+                nTotalEventsDone = 0;
+            }
+
+            CPLErrorReset();
+            const FeatureProcessingResult eResult = ProcessFeature(
+                psInfo, poFeature, poDstFeature, poCollToExplode.get(),
+                iGeomCollToExplode, nSrcFID, nDesiredFID, poOutputSRS,
+                m_oProcessingContext, psOptions);
+            if (eResult == FeatureProcessingResult::DISCARDED)
+            {
+                continue;
+            }
+            else if (eResult == FeatureProcessingResult::TRANSLATION_FAILED)
+            {
+                if (psOptions->nGroupTransactions)
+                {
+                    if (psOptions->nLayerTransaction)
                     {
-                        const bool bIsGeomCollection =
-                            wkbFlatten(poDstGeometry->getGeometryType()) ==
-                            wkbGeometryCollection;
-                        OGRGeometry *poValidGeom = poDstGeometry->MakeValid();
-                        delete poDstGeometry;
-                        poDstGeometry = poValidGeom;
-                        if (poDstGeometry == nullptr)
-                            goto end_loop;
-                        if (!bIsGeomCollection)
+                        if (poDstLayer->CommitTransaction() != OGRERR_NONE)
                         {
-                            OGRGeometry *poCleanedGeom = OGRGeometryFactory::
-                                removeLowerDimensionSubGeoms(poDstGeometry);
-                            delete poDstGeometry;
-                            poDstGeometry = poCleanedGeom;
+                            return false;
                         }
                     }
+                }
 
-                    if (eGType != GEOMTYPE_UNCHANGED)
-                    {
-                        poDstGeometry = OGRGeometryFactory::forceTo(
-                            poDstGeometry,
-                            static_cast<OGRwkbGeometryType>(eGType));
-                    }
-                    else if (m_eGeomTypeConversion == GTC_PROMOTE_TO_MULTI ||
-                             m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
-                             m_eGeomTypeConversion ==
-                                 GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR ||
-                             m_eGeomTypeConversion == GTC_CONVERT_TO_CURVE)
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Unable to translate feature " CPL_FRMT_GIB
+                         " from layer %s.",
+                         nSrcFID, poSrcLayer->GetName());
+                return false;
+            }
+            else if (eResult == FeatureProcessingResult::REPROJECTION_FAILED)
+            {
+                if (psOptions->nGroupTransactions)
+                {
+                    if (psOptions->nLayerTransaction)
                     {
-                        OGRwkbGeometryType eTargetType =
-                            poDstGeometry->getGeometryType();
-                        eTargetType =
-                            ConvertType(m_eGeomTypeConversion, eTargetType);
-                        poDstGeometry = OGRGeometryFactory::forceTo(
-                            poDstGeometry, eTargetType);
+                        if (poDstLayer->CommitTransaction() != OGRERR_NONE &&
+                            !psOptions->bSkipFailures)
+                        {
+                            return false;
+                        }
                     }
                 }
 
-                poDstFeature->SetGeomFieldDirectly(iGeom, poDstGeometry);
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Failed to reproject feature " CPL_FRMT_GIB
+                         " (geometry probably out of source or "
+                         "destination SRS).",
+                         nSrcFID);
+                if (!psOptions->bSkipFailures)
+                {
+                    return false;
+                }
             }
 
             CPLErrorReset();
@@ -5752,8 +6752,6 @@ int LayerTranslator::Translate(OGRFeature *poFeatureIn, TargetLayerInfo *psInfo,
                     }
                 }
             }
-
-        end_loop:;  // nothing
         }
 
         /* Report progress */
@@ -6595,6 +7593,14 @@ GDALVectorTranslateOptions *GDALVectorTranslateOptionsNew(
             CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
             psOptions->nLimit = CPLAtoGIntBig(papszArgv[++i]);
         }
+        else if (EQUAL(papszArgv[i], "-num_threads"))
+        {
+            CHECK_HAS_ENOUGH_ADDITIONAL_ARGS(1);
+            const char *pszNumThreads = papszArgv[++i];
+            psOptions->nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : std::max(1, atoi(pszNumThreads));
+        }
         else if (papszArgv[i][0] == '-')
         {
             CPLError(CE_Failure, CPLE_NotSupported, "Unknown option name '%s'",
@@ -584,6 +584,38 @@ TEST_F(test_gdal, GDALSwapWords_unaligned_buffers)
     GDALSwapWords(abyBuffer, 4, 2, 9);
 }
 
+// Test GDALSwapWords() on packed buffers, with and without SSSE3
+TEST_F(test_gdal, GDALSwapWords_packed)
+{
+    for (const char *pszUseSSSE3 : {"YES", "NO"})
+    {
+        CPLSetConfigOption("GDAL_USE_SSSE3", pszUseSSSE3);
+        for (int nWordSize : {2, 4, 8})
+        {
+            for (int nWordCount : {1, 15, 16, 17, 35, 100})
+            {
+                // Offset by one byte to test unaligned buffers
+                std::vector<GByte> abyBuffer(1 + nWordSize * nWordCount);
+                for (size_t i = 0; i < abyBuffer.size(); i++)
+                    abyBuffer[i] = static_cast<GByte>(i);
+                GDALSwapWords(abyBuffer.data() + 1, nWordSize, nWordCount,
+                              nWordSize);
+                EXPECT_EQ(abyBuffer[0], 0);
+                for (int i = 0; i < nWordCount; i++)
+                {
+                    for (int j = 0; j < nWordSize; j++)
+                    {
+                        EXPECT_EQ(abyBuffer[1 + i * nWordSize + j],
+                                  static_cast<GByte>(1 + i * nWordSize +
+                                                     nWordSize - 1 - j));
+                    }
+                }
+            }
+        }
+    }
+    CPLSetConfigOption("GDAL_USE_SSSE3", nullptr);
+}
+
 // Test ARE_REAL_EQUAL()
 TEST_F(test_gdal, ARE_REAL_EQUAL)
 {
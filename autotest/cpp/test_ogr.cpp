@@ -2219,6 +2219,97 @@ TEST_F(test_ogr, feature_defn_geomfields_iterator)
     EXPECT_EQ(i, oFDefn.GetGeomFieldCount());
 }
 
+// Test OGRFeatureQuery::EvaluateArrowArray()
+TEST_F(test_ogr, OGRFeatureQuery_EvaluateArrowArray)
+{
+    auto poDS = std::unique_ptr<GDALDataset>(
+        GetGDALDriverManager()->GetDriverByName("Memory")->Create(
+            "", 0, 0, 0, GDT_Unknown, nullptr));
+    auto poLayer = poDS->CreateLayer("test", nullptr, wkbNone);
+    {
+        OGRFieldDefn oFieldDefn("int32", OFTInteger);
+        poLayer->CreateField(&oFieldDefn);
+    }
+    {
+        OGRFieldDefn oFieldDefn("int64", OFTInteger64);
+        poLayer->CreateField(&oFieldDefn);
+    }
+    {
+        OGRFieldDefn oFieldDefn("float64", OFTReal);
+        poLayer->CreateField(&oFieldDefn);
+    }
+    {
+        OGRFieldDefn oFieldDefn("str", OFTString);
+        poLayer->CreateField(&oFieldDefn);
+    }
+    {
+        OGRFieldDefn oFieldDefn("bool", OFTInteger);
+        oFieldDefn.SetSubType(OFSTBoolean);
+        poLayer->CreateField(&oFieldDefn);
+    }
+    auto poFDefn = poLayer->GetLayerDefn();
+    for (int i = 0; i < 20; i++)
+    {
+        auto poFeature = std::unique_ptr<OGRFeature>(new OGRFeature(poFDefn));
+        if (i != 3)
+            poFeature->SetField("int32", i);
+        poFeature->SetField("int64", static_cast<GIntBig>(i) * 1000000000);
+        poFeature->SetField("float64", i * 0.5);
+        if (i % 5 != 0)
+            poFeature->SetField("str", CPLSPrintf("Val%02d", i));
+        poFeature->SetField("bool", i % 2);
+        ASSERT_EQ(poLayer->CreateFeature(poFeature.get()), OGRERR_NONE);
+    }
+
+    struct ArrowArrayStream stream;
+    ASSERT_TRUE(
+        OGR_L_GetArrowStream(OGRLayer::ToHandle(poLayer), &stream, nullptr));
+    struct ArrowSchema schema;
+    ASSERT_EQ(stream.get_schema(&stream, &schema), 0);
+    struct ArrowArray array;
+    ASSERT_EQ(stream.get_next(&stream, &array), 0);
+    ASSERT_EQ(array.length, 20);
+
+    const char *const apszFilters[] = {
+        "int32 > 10",
+        "int32 IN (1, 3, 5) OR str = 'val10'",
+        "int64 BETWEEN 2000000000 AND 6000000000 AND NOT bool",
+        "float64 >= 3.5 AND str IS NOT NULL",
+        "str > 'VAL12'",
+        "bool",
+    };
+    for (const char *pszFilter : apszFilters)
+    {
+        OGRFeatureQuery oQuery;
+        ASSERT_EQ(oQuery.Compile(poLayer, pszFilter), OGRERR_NONE);
+        std::vector<bool> abRetain;
+        ASSERT_TRUE(oQuery.EvaluateArrowArray(&schema, &array, abRetain))
+            << pszFilter;
+        ASSERT_EQ(abRetain.size(), 20U);
+        for (int i = 0; i < 20; i++)
+        {
+            auto poFeature =
+                std::unique_ptr<OGRFeature>(poLayer->GetFeature(i));
+            ASSERT_TRUE(poFeature != nullptr);
+            EXPECT_EQ(abRetain[i],
+                      CPL_TO_BOOL(oQuery.Evaluate(poFeature.get())))
+                << pszFilter << " " << i;
+        }
+    }
+
+    // Expressions not handled by EvaluateArrowArray()
+    {
+        OGRFeatureQuery oQuery;
+        ASSERT_EQ(oQuery.Compile(poLayer, "str LIKE 'val1%'"), OGRERR_NONE);
+        std::vector<bool> abRetain;
+        EXPECT_FALSE(oQuery.EvaluateArrowArray(&schema, &array, abRetain));
+    }
+
+    array.release(&array);
+    schema.release(&schema);
+    stream.release(&stream);
+}
+
 // Test GDALDataset QueryLoggerFunc callback
 TEST_F(test_ogr, GDALDatasetSetQueryLoggerFunc)
 {
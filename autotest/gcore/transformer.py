@@ -500,6 +500,82 @@ def test_transformer_9():
     gdal.Unlink("/vsimem/dem.tif")
 
 
+###############################################################################
+# Test RPC DEM window optimization (points not on a single line)
+
+
+def test_transformer_rpc_dem_window_optim():
+
+    ds = gdal.Open("data/rpc.vrt")
+
+    ds_dem = gdal.GetDriverByName("GTiff").Create(
+        "/vsimem/dem.tif", 100, 100, 1, gdal.GDT_Byte
+    )
+    sr = osr.SpatialReference()
+    sr.ImportFromEPSG(4326)
+    ds_dem.SetProjection(sr.ExportToWkt())
+    ds_dem.SetGeoTransform(
+        [
+            125.647968621436,
+            1.2111052640051412e-05,
+            0,
+            39.869926216038,
+            0,
+            -8.6569068979969188e-06,
+        ]
+    )
+    import random
+
+    random.seed(0)
+    data = "".join([chr(40 + int(10 * random.random())) for _ in range(100 * 100)])
+    ds_dem.GetRasterBand(1).WriteRaster(0, 0, 100, 100, data)
+    ds_dem = None
+
+    points = [
+        (
+            125.647968621436 + i * 1.2111052640051412e-05 * 9.7,
+            39.869926216038 - j * 8.6569068979969188e-06 * 9.3,
+        )
+        for j in range(11)
+        for i in range(11)
+    ]
+    # Partly outside of the DEM
+    points.append((125.647968621436 - 1e-5, 39.869926216038 + 1e-5))
+
+    for method in ["near", "bilinear", "cubic"]:
+        tr = gdal.Transformer(
+            ds,
+            None,
+            [
+                "METHOD=RPC",
+                "RPC_DEM=/vsimem/dem.tif",
+                "RPC_DEMINTERPOLATION=%s" % method,
+            ],
+        )
+
+        (pnt_optimized, success_optimized) = tr.TransformPoints(1, points)
+        with gdaltest.config_option("GDAL_RPC_DEM_OPTIM", "NO"):
+            (pnt, success) = tr.TransformPoints(1, points)
+
+        assert success_optimized == success, method
+        assert pnt_optimized == pnt, method
+
+        # Subsets of the points, for which the DEM window loaded by a
+        # previous call is reused
+        for subset in (points[20:60], points[60:], points[:30]):
+            (pnt_subset, success_subset) = tr.TransformPoints(1, subset)
+            with gdaltest.config_option("GDAL_RPC_DEM_OPTIM", "NO"):
+                assert tr.TransformPoints(1, subset) == (pnt_subset, success_subset)
+
+        # Compare the 2-point-at-a-time evaluation with the single point one
+        for k in range(4):
+            (success, pnt) = tr.TransformPoint(1, points[k][0], points[k][1], 0)
+            assert success, method
+            assert pnt == pnt_optimized[k], method
+
+    gdal.Unlink("/vsimem/dem.tif")
+
+
 ###############################################################################
 # Test RPC DEM transform from geoid height to ellipsoidal height
 
@@ -1027,6 +1103,40 @@ def test_transformer_tps_precision():
     assert maxDiffResult < 1e-3, "at least one transformation exceeds the error bound"
 
 
+###############################################################################
+# Test that the multi-threaded solve and point evaluation of the thin plate
+# splines transformer give the same results as the single-threaded ones.
+
+
+def test_transformer_tps_multithreaded():
+
+    ds = gdal.Open("data/gcps_2115.vrt")
+    gcps = ds.GetGCPs()
+    min_x = min(gcp.GCPPixel for gcp in gcps)
+    max_x = max(gcp.GCPPixel for gcp in gcps)
+    min_y = min(gcp.GCPLine for gcp in gcps)
+    max_y = max(gcp.GCPLine for gcp in gcps)
+    # Enough points for them to be split between several threads
+    points = [
+        (min_x + (max_x - min_x) * i / 150.0, min_y + (max_y - min_y) * j / 150.0)
+        for j in range(150)
+        for i in range(150)
+    ]
+
+    res = []
+    for num_threads in (1, 4):
+        tr = gdal.Transformer(
+            ds, None, ["METHOD=GCP_TPS", "NUM_THREADS=%d" % num_threads]
+        )
+        assert tr, "tps transformation could not be computed"
+        res.append(tr.TransformPoints(0, points))
+        res.append(tr.TransformPoints(1, res[-1][0]))
+
+    assert res[2] == res[0]
+    assert res[3] == res[1]
+    assert all(res[0][1])
+
+
 ###############################################################################
 def test_transformer_image_no_srs():
 
@@ -28,6 +28,8 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
+import os
+import sys
 import time
 
 import gdaltest
@@ -1093,6 +1095,278 @@ def test_vsicurl_GDAL_HTTP_HEADERS():
     assert statres.size == 3
 
 
+###############################################################################
+# Test CPL_VSIL_CURL_PERSISTENT_CACHE_DIR
+
+
+def test_vsicurl_persistent_cache(tmp_path):
+
+    if gdaltest.webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    url = (
+        "/vsicurl/http://localhost:%d/test_vsicurl_persistent_cache.bin"
+        % gdaltest.webserver_port
+    )
+
+    def read(handler):
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(url, "rb")
+            assert f
+            data = gdal.VSIFReadL(1, 3, f)
+            gdal.VSIFCloseL(f)
+        return data
+
+    with gdaltest.config_options(
+        {
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+            "CPL_VSIL_CURL_PERSISTENT_CACHE_DIR": str(tmp_path),
+        }
+    ):
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_vsicurl_persistent_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"etag1"'},
+        )
+        handler.add(
+            "GET",
+            "/test_vsicurl_persistent_cache.bin",
+            206,
+            {"Content-Range": "bytes 0-2/3"},
+            "foo",
+            expected_headers={"Range": "bytes=0-2"},
+        )
+        assert read(handler) == b"foo"
+        entries = list(tmp_path.glob("*/*.gdalvcc"))
+        assert len(entries) == 1
+        # The URL is not stored in clear in the entry
+        assert b"test_vsicurl_persistent_cache" not in open(entries[0], "rb").read()
+        if sys.platform != "win32":
+            assert (os.stat(entries[0].parent).st_mode & 0o777) == 0o700
+
+        # Simulate a new process: only the persistent cache is available
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_vsicurl_persistent_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"etag1"'},
+        )
+        assert read(handler) == b"foo"
+
+        # Remote file has changed: the cached content must not be used
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_vsicurl_persistent_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"etag2"'},
+        )
+        handler.add(
+            "GET",
+            "/test_vsicurl_persistent_cache.bin",
+            206,
+            {"Content-Range": "bytes 0-2/3"},
+            "bar",
+            expected_headers={"Range": "bytes=0-2"},
+        )
+        assert read(handler) == b"bar"
+        assert len(list(tmp_path.glob("*/*.gdalvcc"))) == 2
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that CPL_VSIL_CURL_PERSISTENT_CACHE_DIR entries survive the renewal
+# of the signature of pre-signed URLs, and removal of stale temporary files
+
+
+def test_vsicurl_persistent_cache_signed_url(tmp_path):
+
+    if gdaltest.webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    path = "/test_vsicurl_persistent_cache_signed_url.bin?foo=bar&X-Goog-Signature="
+
+    def read(signature, with_get):
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD", path + signature, 200, {"Content-Length": "3", "ETag": '"etag1"'}
+        )
+        if with_get:
+            handler.add(
+                "GET",
+                path + signature,
+                206,
+                {"Content-Range": "bytes 0-2/3"},
+                "foo",
+                expected_headers={"Range": "bytes=0-2"},
+            )
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(
+                "/vsicurl/http://localhost:%d%s%s"
+                % (gdaltest.webserver_port, path, signature),
+                "rb",
+            )
+            assert f
+            data = gdal.VSIFReadL(1, 3, f)
+            gdal.VSIFCloseL(f)
+        gdal.VSICurlClearCache()
+        return data
+
+    stale_tmp = tmp_path / "00" / "0000.gdalvcc.1.1.tmp"
+    stale_tmp.parent.mkdir()
+    stale_tmp.write_bytes(b"x")
+    os.utime(stale_tmp, (0, 0))
+
+    with gdaltest.config_options(
+        {
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+            "CPL_VSIL_CURL_PERSISTENT_CACHE_DIR": str(tmp_path),
+        }
+    ):
+        # Small enough for the directory to be scanned, and the new entry
+        # to be evicted
+        with gdaltest.config_option("CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE", "10"):
+            assert read("sig1", with_get=True) == b"foo"
+        assert not stale_tmp.exists()
+        assert len(list(tmp_path.glob("*/*.gdalvcc"))) == 0
+
+        assert read("sig1", with_get=True) == b"foo"
+        entries = list(tmp_path.glob("*/*.gdalvcc"))
+        assert len(entries) == 1
+        assert b"sig1" not in open(entries[0], "rb").read()
+
+        # Same file with a renewed signature: served from the cache
+        assert read("sig2", with_get=False) == b"foo"
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_READ_AHEAD
+
+
+def test_vsicurl_read_ahead():
+
+    if gdaltest.webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    content = bytes([i % 251 for i in range(8 * 16384)])
+
+    def add_get(handler, start, end):
+        handler.add(
+            "GET",
+            "/test_vsicurl_read_ahead.bin",
+            206,
+            {"Content-Range": "bytes %d-%d/%d" % (start, end, len(content))},
+            content[start : end + 1],
+            expected_headers={"Range": "bytes=%d-%d" % (start, end)},
+        )
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_vsicurl_read_ahead.bin",
+        200,
+        {"Content-Length": "%d" % len(content)},
+    )
+    add_get(handler, 0, 16383)
+    add_get(handler, 16384, 49151)
+    # Fetched in the background after the sequential read is detected
+    add_get(handler, 49152, 114687)
+    add_get(handler, 114688, 131071)
+
+    with gdaltest.config_options(
+        {
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+            "CPL_VSIL_CURL_READ_AHEAD": "YES",
+        }
+    ):
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(
+                "/vsicurl/http://localhost:%d/test_vsicurl_read_ahead.bin"
+                % gdaltest.webserver_port,
+                "rb",
+            )
+            assert f
+            assert gdal.VSIFReadL(1, 16384, f) == content[0:16384]
+            assert gdal.VSIFReadL(1, 16384, f) == content[16384:32768]
+            assert gdal.VSIFReadL(1, 16384, f) == content[32768:49152]
+            assert gdal.VSIFReadL(1, 65536, f) == content[49152:114688]
+            assert gdal.VSIFReadL(1, 16384, f) == content[114688:]
+            gdal.VSIFCloseL(f)
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that large reads are split into parallel range requests
+
+
+def test_vsicurl_parallel_read():
+
+    if gdaltest.webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    content = bytes([i % 251 for i in range(8 * 16384)])
+
+    def method(request):
+        # Requests may arrive in any order
+        start, end = [int(x) for x in request.headers["Range"][6:].split("-")]
+        request.protocol_version = "HTTP/1.1"
+        request.send_response(206)
+        request.send_header(
+            "Content-Range", "bytes %d-%d/%d" % (start, end, len(content))
+        )
+        request.send_header("Content-Length", end - start + 1)
+        request.send_header("Connection", "close")
+        request.end_headers()
+        request.wfile.write(content[start : end + 1])
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_vsicurl_parallel_read.bin",
+        200,
+        {"Content-Length": "%d" % len(content)},
+    )
+    handler.add("GET", "/test_vsicurl_parallel_read.bin", custom_method=method)
+    handler.add("GET", "/test_vsicurl_parallel_read.bin", custom_method=method)
+
+    with gdaltest.config_options(
+        {
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+            "CPL_VSIL_CURL_PARALLEL_READ_MIN_SIZE": "65536",
+            "CPL_VSIL_CURL_PARALLEL_READ_COUNT": "2",
+        }
+    ):
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(
+                "/vsicurl/http://localhost:%d/test_vsicurl_parallel_read.bin"
+                % gdaltest.webserver_port,
+                "rb",
+            )
+            assert f
+            gdal.VSIFSeekL(f, 1000, 0)
+            assert gdal.VSIFReadL(1, 100000, f) == content[1000:101000]
+            gdal.VSIFCloseL(f)
+
+    gdal.VSICurlClearCache()
+
+
 ###############################################################################
 
 
@@ -404,3 +404,74 @@ def test_ehdr_approx_stats_flag():
     ds = None
 
     gdal.GetDriverByName("EHDR").Delete(tmpfile)
+
+
+###############################################################################
+# Test reading through a memory mapping of the file, against the regular
+# code path
+
+
+@pytest.mark.parametrize("layout", ["BIL", "BIP", "BSQ"])
+@pytest.mark.parametrize("byteorder", ["I", "M"])
+def test_ehdr_read_mmap(layout, byteorder):
+
+    xsize, ysize, nbands = 13, 7, 3
+
+    def value(b, y, x):
+        return ((b * ysize + y) * xsize + x) * 397 % 65536 - 32768
+
+    if layout == "BSQ":
+        order = [
+            (b, y, x) for b in range(nbands) for y in range(ysize) for x in range(xsize)
+        ]
+    elif layout == "BIL":
+        order = [
+            (b, y, x) for y in range(ysize) for b in range(nbands) for x in range(xsize)
+        ]
+    else:
+        order = [
+            (b, y, x) for y in range(ysize) for x in range(xsize) for b in range(nbands)
+        ]
+    fmt = ("<" if byteorder == "I" else ">") + "h" * len(order)
+
+    filename = "tmp/ehdr_read_mmap." + layout.lower()
+    with open(filename, "wb") as f:
+        f.write(struct.pack(fmt, *[value(*idx) for idx in order]))
+    with open("tmp/ehdr_read_mmap.hdr", "wt") as f:
+        f.write(
+            "NROWS %d\nNCOLS %d\nNBANDS %d\nNBITS 16\nPIXELTYPE SIGNEDINT\n"
+            "BYTEORDER %s\nLAYOUT %s\n" % (ysize, xsize, nbands, byteorder, layout)
+        )
+
+    def read_all():
+        ds = gdal.Open(filename)
+        res = [
+            ds.ReadRaster(),
+            ds.ReadRaster(buf_type=gdal.GDT_Float32),
+            ds.ReadRaster(
+                buf_pixel_space=2 * nbands,
+                buf_line_space=2 * nbands * xsize,
+                buf_band_space=2,
+            ),
+        ]
+        for i in range(nbands):
+            band = ds.GetRasterBand(i + 1)
+            res.append(band.ReadRaster())
+            res.append(band.ReadRaster(2, 1, 5, 4, buf_type=gdal.GDT_Int32))
+            res.append(band.ReadRaster(2, 1, 5, 4, buf_pixel_space=4))
+            res.append(band.ReadRaster(0, 0, xsize, ysize, 6, 3))
+        return res
+
+    try:
+        with gdaltest.config_option("GDAL_RAW_USE_MMAP", "YES"):
+            res_mmap = read_all()
+        with gdaltest.config_option("GDAL_RAW_USE_MMAP", "NO"):
+            res_no_mmap = read_all()
+        assert res_mmap == res_no_mmap
+
+        ds = gdal.Open(filename)
+        data = ds.GetRasterBand(2).ReadRaster(5, 3, 1, 1)
+        assert struct.unpack("h", data) == (value(1, 3, 5),)
+        ds = None
+    finally:
+        gdal.GetDriverByName("EHDR").Delete(filename)
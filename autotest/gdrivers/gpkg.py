@@ -4328,6 +4328,105 @@ def test_gpkg_sql_gdal_get_layer_pixel_value():
     gdal.Unlink(filename)
 
 
+###############################################################################
+# Test multi-threaded decoding of tiles
+
+
+@pytest.mark.parametrize("tile_format", ["PNG", "JPEG"])
+def test_gpkg_multithreaded_tile_decoding(tile_format):
+
+    if gdal.GetDriverByName(tile_format) is None:
+        pytest.skip(f"{tile_format} driver missing")
+
+    filename = "/vsimem/test_gpkg_multithreaded_tile_decoding.gpkg"
+    src_ds = gdal.Open("data/small_world.tif")
+    gdal.Translate(
+        filename,
+        src_ds,
+        format="GPKG",
+        creationOptions=["TILE_FORMAT=" + tile_format, "BLOCKSIZE=64"],
+    )
+
+    def get_data(options={}):
+        with gdaltest.config_options(options):
+            ds = gdal.Open(filename)
+            data = ds.ReadRaster()
+            band_data = ds.GetRasterBand(2).ReadRaster(30, 20, 300, 150)
+            cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+            ds = None
+        return data, band_data, cs
+
+    expected = get_data()
+    assert get_data({"GDAL_NUM_THREADS": "4"}) == expected
+    assert get_data({"GDAL_NUM_THREADS": "ALL_CPUS"}) == expected
+
+    gdal.Unlink(filename)
+
+
+###############################################################################
+# Test multi-threaded decoding of JPEG tiles with restart markers, that the
+# JPEG driver could also decode with the global thread pool
+
+
+def test_gpkg_multithreaded_tile_decoding_jpeg_restart_markers():
+
+    if gdal.GetDriverByName("JPEG") is None:
+        pytest.skip("JPEG driver missing")
+
+    jpeg_filename = "data/jpeg/restart_markers_rgb.jpg"
+    jpeg_ds = gdal.Open(jpeg_filename)
+    tile_xsize = jpeg_ds.RasterXSize
+    tile_ysize = jpeg_ds.RasterYSize
+    expected_tile = jpeg_ds.ReadRaster()
+    jpeg_ds = None
+
+    filename = "/vsimem/test_gpkg_multithreaded_tile_decoding_restart.gpkg"
+    src_ds = gdal.Translate(
+        "",
+        jpeg_filename,
+        format="MEM",
+        width=2 * tile_xsize,
+        height=2 * tile_ysize,
+        outputSRS="EPSG:32631",
+        outputBounds=[0, 2 * tile_ysize, 2 * tile_xsize, 0],
+    )
+    gdal.Translate(
+        filename,
+        src_ds,
+        format="GPKG",
+        creationOptions=[
+            "TILE_FORMAT=JPEG",
+            "RASTER_TABLE=tmp",
+            "BLOCKXSIZE=%d" % tile_xsize,
+            "BLOCKYSIZE=%d" % tile_ysize,
+        ],
+    )
+
+    # Replace all tiles with the JPEG file with restart markers
+    with open(jpeg_filename, "rb") as f:
+        jpeg_data = f.read()
+    ds = gdal.OpenEx(filename, gdal.OF_RASTER | gdal.OF_UPDATE)
+    ds.ExecuteSQL("UPDATE tmp SET tile_data = X'%s'" % jpeg_data.hex())
+    ds = None
+
+    def get_data(options={}):
+        with gdaltest.config_options(options):
+            ds = gdal.Open(filename)
+            data = ds.ReadRaster(band_list=[1, 2, 3])
+            tile = ds.ReadRaster(
+                tile_xsize, tile_ysize, tile_xsize, tile_ysize, band_list=[1, 2, 3]
+            )
+            ds = None
+        return data, tile
+
+    expected = get_data()
+    assert expected[1] == expected_tile
+    assert get_data({"GDAL_NUM_THREADS": "4"}) == expected
+    assert get_data({"GDAL_NUM_THREADS": "ALL_CPUS"}) == expected
+
+    gdal.Unlink(filename)
+
+
 ###############################################################################
 #
 
@@ -1958,6 +1958,40 @@ def test_grib_grib2_read_subgrids_reuse_bitmap():
     assert ds.GetRasterBand(2).Checksum() == 4563
 
 
+###############################################################################
+# Test decoding bands in parallel in dataset RasterIO()
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/grib/subgrids.grib2",
+        "data/grib/gfs.t06z.pgrb2.10p0.f010.grib2",
+        "data/grib/Sample_QuikSCAT.grb",
+    ],
+)
+def test_grib_read_multithreaded(filename):
+
+    ds = gdal.Open(filename)
+    expected_data = ds.ReadRaster()
+    expected_cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+    ds = None
+    ds = gdal.Open(filename)
+    expected_pixel = ds.ReadRaster(1, 1, 1, 1)
+    ds = None
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open(filename)
+        assert ds.ReadRaster() == expected_data
+        got_cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+        assert got_cs == expected_cs
+        ds = None
+
+        # Point series: all bands at a single pixel
+        ds = gdal.Open(filename)
+        assert ds.ReadRaster(1, 1, 1, 1) == expected_pixel
+
+
 ###############################################################################
 # Test reading and writing GRIBv2 with 0-360 longitudes
 # Fixes https://github.com/OSGeo/gdal/issues/4524
@@ -1535,6 +1535,34 @@ def test_jpeg_read_lossless_16bit():
         assert ds is None
 
 
+###############################################################################
+# Test multi-threaded decoding of JPEG files with restart markers
+
+
+@pytest.mark.parametrize(
+    "filename",
+    ["data/jpeg/restart_markers_rgb.jpg", "data/jpeg/restart_markers_gray.jpg"],
+)
+def test_jpeg_read_restart_markers_multithreaded(filename):
+
+    ds = gdal.Open(filename)
+    xsize = ds.RasterXSize
+    ysize = ds.RasterYSize
+    windows = [
+        (0, 0, xsize, ysize),
+        (3, 5, xsize - 7, ysize - 11),
+        (0, ysize // 2, xsize, ysize - ysize // 2),
+        (1, 1, 5, 3),
+    ]
+    expected = [ds.ReadRaster(*window) for window in windows]
+    ds = None
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open(filename)
+        for window, data in zip(windows, expected):
+            assert ds.ReadRaster(*window) == data, window
+
+
 ###############################################################################
 # Cleanup
 
@@ -615,6 +615,31 @@ def test_mbtiles_10():
     gdal.Unlink("/vsimem/mbtiles_10.mbtiles")
 
 
+###############################################################################
+# Test multi-threaded decoding of tiles
+
+
+def test_mbtiles_multithreaded_tile_decoding():
+
+    if gdaltest.mbtiles_drv is None:
+        pytest.skip()
+
+    if gdal.GetDriverByName("JPEG") is None:
+        pytest.skip()
+
+    def get_data(options={}):
+        with gdaltest.config_options(options):
+            ds = gdal.OpenEx(
+                "data/mbtiles/world_l1.mbtiles", open_options=["USE_BOUNDS=NO"]
+            )
+            data = ds.ReadRaster()
+            band_data = ds.GetRasterBand(1).ReadRaster(100, 50, 300, 400)
+            ds = None
+        return data, band_data
+
+    assert get_data({"GDAL_NUM_THREADS": "4"}) == get_data()
+
+
 ###############################################################################
 # Test opening a .mbtiles.sql file
 
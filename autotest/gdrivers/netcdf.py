@@ -6273,6 +6273,51 @@ def test_netcdf_read_lon_lat_indexed_irregularly_spaced():
     }
 
 
+###############################################################################
+# Test reading and writing with the per-dataset lock
+# (GDAL_NETCDF_THREAD_SAFE_LIBRARY=YES). Only single-threaded, as the libnetcdf
+# we are linked against is not necessarily thread-safe.
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/netcdf/byte_chunked_not_multiple.nc",
+        "data/netcdf/byte_with_valid_range.nc",
+        "data/netcdf/trmm.nc",
+    ],
+)
+def test_netcdf_per_dataset_lock(filename):
+
+    ds = gdal.Open(filename)
+    expected_cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+    ds = None
+
+    with gdaltest.config_option("GDAL_NETCDF_THREAD_SAFE_LIBRARY", "YES"):
+        ds = gdal.Open(filename)
+        got_cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+        ds = None
+    assert got_cs == expected_cs
+
+
+def test_netcdf_per_dataset_lock_write():
+
+    with gdaltest.config_option("GDAL_NETCDF_THREAD_SAFE_LIBRARY", "YES"):
+        src_ds = gdal.Open("../gcore/data/byte.tif")
+        ds = gdal.GetDriverByName("netCDF").CreateCopy(
+            "tmp/per_dataset_lock.nc", src_ds
+        )
+        ds.GetRasterBand(1).SetNoDataValue(1)
+        ds = None
+
+        ds = gdal.Open("tmp/per_dataset_lock.nc")
+        assert ds.GetRasterBand(1).Checksum() == 4672
+        assert ds.GetRasterBand(1).GetNoDataValue() == 1
+        ds = None
+
+    gdal.Unlink("tmp/per_dataset_lock.nc")
+
+
 def test_clean_tmp():
     # [KEEP THIS AS THE LAST TEST]
     # i.e. please do not add any tests after this one. Put new ones above.
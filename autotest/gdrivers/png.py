@@ -429,3 +429,77 @@ def test_png_whole_image_optim(options, nbands, xsize, ysize):
         )
 
     gdal.Unlink(filename)
+
+
+###############################################################################
+# Test decoding of scanlines in a background thread
+
+
+@pytest.mark.parametrize("nbands", [1, 3, 4])
+def test_png_read_decoding_thread(nbands):
+
+    filename = "/vsimem/test_png_read_decoding_thread.png"
+    xsize = 101
+    ysize = 300
+    src_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize, nbands)
+    src_ds.WriteRaster(
+        0,
+        0,
+        xsize,
+        ysize,
+        array.array("B", [(i * 7) % 251 for i in range(xsize * ysize * nbands)]),
+    )
+    gdal.GetDriverByName("PNG").CreateCopy(filename, src_ds)
+
+    options = {"GDAL_PNG_WHOLE_IMAGE_OPTIM": "NO", "GDAL_NUM_THREADS": "2"}
+    with gdaltest.config_options(options):
+        ds = gdal.Open(filename)
+        assert ds.ReadRaster() == src_ds.ReadRaster()
+        # Twice to test restarting decoding
+        assert ds.ReadRaster() == src_ds.ReadRaster()
+        assert ds.ReadRaster(
+            buf_pixel_space=nbands, buf_band_space=1
+        ) == src_ds.ReadRaster(buf_pixel_space=nbands, buf_band_space=1)
+        # Scanline access after the whole image has been decoded
+        assert ds.GetRasterBand(1).ReadRaster(
+            0, ysize // 2, xsize, 1
+        ) == src_ds.GetRasterBand(1).ReadRaster(0, ysize // 2, xsize, 1)
+        assert ds.ReadRaster() == src_ds.ReadRaster()
+
+    # Truncated file: errors of the decoding thread must be reported to the
+    # caller, as without it
+    f = gdal.VSIFOpenL(filename, "rb")
+    data = gdal.VSIFReadL(1, 100000, f)
+    gdal.VSIFCloseL(f)
+    truncated_filename = "/vsimem/test_png_read_decoding_thread_truncated.png"
+    f = gdal.VSIFOpenL(truncated_filename, "wb")
+    gdal.VSIFWriteL(data[0 : len(data) // 2], 1, len(data) // 2, f)
+    gdal.VSIFCloseL(f)
+
+    def read_truncated(num_threads):
+        got_msg = []
+
+        def my_handler(errorClass, errno, msg):
+            if errorClass != gdal.CE_Debug:
+                got_msg.append((errorClass, msg))
+
+        with gdaltest.config_options(
+            {"GDAL_PNG_WHOLE_IMAGE_OPTIM": "NO", "GDAL_NUM_THREADS": num_threads}
+        ):
+            ds = gdal.Open(truncated_filename)
+            gdal.PushErrorHandler(my_handler)
+            try:
+                data = ds.ReadRaster()
+            finally:
+                gdal.PopErrorHandler()
+        return data, got_msg
+
+    data_ref, msgs_ref = read_truncated("1")
+    data, msgs = read_truncated("2")
+    assert data_ref is None
+    assert data is None
+    assert msgs_ref
+    assert msgs == msgs_ref
+
+    gdal.Unlink(filename)
+    gdal.Unlink(truncated_filename)
@@ -3194,3 +3194,312 @@ def test_zarr_read_do_not_crash_on_invalid_byteswap_on_ascii_string():
 
     finally:
         gdal.RmdirRecursive("/vsimem/test.zarr")
+
+
+###############################################################################
+# Test multi-threaded writing of chunks, with and without sharding
+
+
+@pytest.mark.parametrize(
+    "format,compress,chunks_per_shard",
+    [
+        ("ZARR_V2", "NONE", None),
+        ("ZARR_V2", "ZLIB", None),
+        ("ZARR_V3", "ZLIB", None),
+        ("ZARR_V3", "NONE", "1,2,3"),
+        ("ZARR_V3", "ZLIB", "1,2,3"),
+    ],
+)
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_zarr_write_multithreaded_and_sharding(
+    format, compress, chunks_per_shard, num_threads
+):
+
+    filename = "/vsimem/test_zarr_write_multithreaded_and_sharding.zarr"
+    # Leave some chunks with only zero values, that are not written
+    data = array.array(
+        "H", [0 if (i // 1000) % 3 == 0 else i % 65536 for i in range(2 * 50 * 60)]
+    )
+    try:
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+                filename, options=["FORMAT=" + format]
+            )
+            rg = ds.GetRootGroup()
+            dim0 = rg.CreateDimension("dim0", None, None, 2)
+            dim1 = rg.CreateDimension("dim1", None, None, 50)
+            dim2 = rg.CreateDimension("dim2", None, None, 60)
+            options = ["BLOCKSIZE=1,8,8", "COMPRESS=" + compress]
+            if chunks_per_shard:
+                options.append("CHUNKS_PER_SHARD=" + chunks_per_shard)
+            ar = rg.CreateMDArray(
+                "test",
+                [dim0, dim1, dim2],
+                gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+                options,
+            )
+            assert ar.Write(data) == gdal.CE_None
+            # Read back while tiles might still be pending for writing
+            assert ar.Read() == data
+            ds = None
+
+        if chunks_per_shard:
+            j = json.loads(_read_file(filename + "/meta/root/test.array.json"))
+            assert j["storage_transformers"] == [
+                {
+                    "extension": "https://purl.org/zarr/spec/storage_transformers/sharding/1.0",
+                    "type": "indexed",
+                    "configuration": {"chunks_per_shard": [1, 2, 3]},
+                }
+            ]
+            # 7 chunks along dim1 and 8 along dim2: 4 x 3 shards per dim0
+            assert gdal.VSIStatL(filename + "/data/root/test/c0/2/0") is not None
+            assert gdal.VSIStatL(filename + "/data/root/test/c1/3/2") is not None
+            # Shard with only zero values
+            assert gdal.VSIStatL(filename + "/data/root/test/c0/0/0") is None
+
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER | gdal.OF_UPDATE)
+        rg = ds.GetRootGroup()
+        ar = rg.OpenMDArray("test")
+        assert ar.Read() == data
+
+        # Partial update of existing chunks and shards
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            assert (
+                ar.Write(
+                    array.array("H", [65535] * (10 * 20)),
+                    array_start_idx=[1, 5, 30],
+                    count=[1, 10, 20],
+                )
+                == gdal.CE_None
+            )
+            ds = None
+        for y in range(5, 15):
+            for x in range(30, 50):
+                data[1 * 50 * 60 + y * 60 + x] = 65535
+
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        rg = ds.GetRootGroup()
+        ar = rg.OpenMDArray("test")
+        assert ar.Read() == data
+        assert ar.Read(array_start_idx=[1, 5, 30], count=[1, 10, 20]) == array.array(
+            "H", [65535] * (10 * 20)
+        )
+
+    finally:
+        gdal.RmdirRecursive(filename)
+
+
+def _read_file(filename):
+    f = gdal.VSIFOpenL(filename, "rb")
+    assert f
+    data = gdal.VSIFReadL(1, 100000, f)
+    gdal.VSIFCloseL(f)
+    return data
+
+
+###############################################################################
+# Test reading a sharded Zarr V3 array written "by hand"
+
+
+def test_zarr_read_v3_sharding():
+
+    filename = "/vsimem/test_zarr_read_v3_sharding.zarr"
+    try:
+        gdal.FileFromMemBuffer(
+            filename + "/zarr.json",
+            json.dumps(
+                {
+                    "zarr_format": "https://purl.org/zarr/spec/protocol/core/3.0",
+                    "metadata_encoding": "https://purl.org/zarr/spec/protocol/core/3.0",
+                    "metadata_key_suffix": ".json",
+                    "extensions": [],
+                }
+            ),
+        )
+        gdal.FileFromMemBuffer(
+            filename + "/meta/root/test.array.json",
+            json.dumps(
+                {
+                    "shape": [3, 2],
+                    "data_type": "u1",
+                    "chunk_grid": {
+                        "type": "regular",
+                        "chunk_shape": [1, 1],
+                        "separator": "/",
+                    },
+                    "chunk_memory_layout": "C",
+                    "fill_value": 255,
+                    "extensions": [],
+                    "attributes": {},
+                    "storage_transformers": [
+                        {
+                            "extension": "https://purl.org/zarr/spec/storage_transformers/sharding/1.0",
+                            "type": "indexed",
+                            "configuration": {"chunks_per_shard": [2, 2]},
+                        }
+                    ],
+                }
+            ),
+        )
+        missing = 0xFFFFFFFFFFFFFFFF
+        # First shard: chunks (0,0), (1,1) stored in reverse order,
+        # (0,1) and (1,0) missing
+        gdal.FileFromMemBuffer(
+            filename + "/data/root/test/c0/0",
+            b"\x0B\x00"
+            + struct.pack("<QQ", 1, 1)
+            + struct.pack("<QQ", missing, missing)
+            + struct.pack("<QQ", missing, missing)
+            + struct.pack("<QQ", 0, 1),
+        )
+        # Second shard: only chunk (2,1) present. Entries for chunks beyond
+        # the array shape are missing
+        gdal.FileFromMemBuffer(
+            filename + "/data/root/test/c1/0",
+            b"\x15"
+            + struct.pack("<QQ", missing, missing)
+            + struct.pack("<QQ", 0, 1)
+            + struct.pack("<QQ", missing, missing)
+            + struct.pack("<QQ", missing, missing),
+        )
+
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        assert ds
+        rg = ds.GetRootGroup()
+        ar = rg.OpenMDArray("test")
+        assert ar
+        assert ar.Read() == array.array("B", [0, 255, 255, 11, 255, 21])
+
+        # Corrupted index
+        gdal.FileFromMemBuffer(
+            filename + "/data/root/test/c1/0",
+            b"\x15"
+            + struct.pack("<QQ", missing, missing)
+            + struct.pack("<QQ", 0, 2)
+            + struct.pack("<QQ", missing, missing)
+            + struct.pack("<QQ", missing, missing),
+        )
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        rg = ds.GetRootGroup()
+        ar = rg.OpenMDArray("test")
+        with gdaltest.error_handler():
+            assert ar.Read() is None
+
+    finally:
+        gdal.RmdirRecursive(filename)
+
+
+def test_zarr_create_chunks_per_shard_errors():
+
+    filename = "/vsimem/test_zarr_create_chunks_per_shard_errors.zarr"
+    try:
+        for format, chunks_per_shard in [
+            ("ZARR_V2", "1,1"),
+            ("ZARR_V3", "1"),
+            ("ZARR_V3", "1,0"),
+        ]:
+            ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+                filename, options=["FORMAT=" + format]
+            )
+            rg = ds.GetRootGroup()
+            dim0 = rg.CreateDimension("dim0", None, None, 2)
+            dim1 = rg.CreateDimension("dim1", None, None, 2)
+            with gdaltest.error_handler():
+                assert (
+                    rg.CreateMDArray(
+                        "test",
+                        [dim0, dim1],
+                        gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+                        ["CHUNKS_PER_SHARD=" + chunks_per_shard],
+                    )
+                    is None
+                )
+            ds = None
+            gdal.RmdirRecursive(filename)
+    finally:
+        gdal.RmdirRecursive(filename)
+
+
+###############################################################################
+# Test LIST_TILES open option
+
+
+@pytest.mark.parametrize("format", ["ZARR_V2", "ZARR_V3"])
+def test_zarr_read_list_tiles(format):
+
+    filename = "/vsimem/test_zarr_read_list_tiles.zarr"
+    try:
+        ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+            filename, options=["FORMAT=" + format]
+        )
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, 4)
+        dim1 = rg.CreateDimension("dim1", None, None, 6)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+            ["BLOCKSIZE=2,2"],
+        )
+        ar.SetNoDataValueDouble(255)
+        # Only write tiles (0, 1) and (1, 2)
+        assert (
+            ar.Write(b"\x01" * 4, array_start_idx=[0, 2], count=[2, 2]) == gdal.CE_None
+        )
+        assert (
+            ar.Write(b"\x02" * 4, array_start_idx=[2, 4], count=[2, 2]) == gdal.CE_None
+        )
+        ds = None
+
+        expected = b"\xff\xff\x01\x01\xff\xff" * 2 + b"\xff\xff\xff\xff\x02\x02" * 2
+        if format == "ZARR_V2":
+            existing_tile = filename + "/test/0.1"
+            missing_tile = filename + "/test/0.0"
+        else:
+            existing_tile = filename + "/data/root/test/c0/1"
+            missing_tile = filename + "/data/root/test/c0/0"
+
+        ds = gdal.OpenEx(
+            filename, gdal.OF_MULTIDIM_RASTER, open_options=["LIST_TILES=YES"]
+        )
+        rg = ds.GetRootGroup()
+        ar = rg.OpenMDArray("test")
+        assert ar.Read() == expected
+
+        # Create a tile after the listing has been done: it is ignored,
+        # which demonstrates that missing tiles are no longer probed.
+        gdal.FileFromMemBuffer(missing_tile, _read_file(existing_tile))
+        assert ar.Read() == expected
+        ds = None
+
+        ds = gdal.OpenEx(
+            filename, gdal.OF_MULTIDIM_RASTER, open_options=["LIST_TILES=YES"]
+        )
+        rg = ds.GetRootGroup()
+        ar = rg.OpenMDArray("test")
+        assert ar.Read() == b"\x01\x01" + expected[2:6] + b"\x01\x01" + expected[8:]
+        ds = None
+
+        # Update mode: the index must reflect the written tiles
+        ds = gdal.OpenEx(
+            filename,
+            gdal.OF_MULTIDIM_RASTER | gdal.OF_UPDATE,
+            open_options=["LIST_TILES=YES"],
+        )
+        rg = ds.GetRootGroup()
+        ar = rg.OpenMDArray("test")
+        ar.Read()
+        assert (
+            ar.Write(b"\x03" * 4, array_start_idx=[2, 0], count=[2, 2]) == gdal.CE_None
+        )
+        assert ar.Read(array_start_idx=[2, 0], count=[2, 2]) == b"\x03" * 4
+        assert (
+            ar.Write(b"\xff" * 4, array_start_idx=[0, 0], count=[2, 2]) == gdal.CE_None
+        )
+        assert ar.Read(array_start_idx=[0, 0], count=[2, 2]) == b"\xff" * 4
+        ds = None
+        assert gdal.VSIStatL(missing_tile) is None
+
+    finally:
+        gdal.RmdirRecursive(filename)
@@ -2784,3 +2784,86 @@ def test_ogr_csv_get_feature_count_and_attribute_filter():
     assert lyr.GetFeatureCount() == 0
     lyr.SetAttributeFilter(None)
     assert lyr.GetFeatureCount() == 2
+
+
+###############################################################################
+# Test the driver-specific implementation of the Arrow stream interface
+
+
+def test_ogr_csv_arrow_stream():
+    pytest.importorskip("osgeo.gdal_array")
+    numpy = pytest.importorskip("numpy")
+
+    filename = "/vsimem/test_ogr_csv_arrow_stream.csv"
+    content = "\n".join(
+        [
+            "int,int64,real,str,date,dt,bool,WKT",
+            '1,1234567890123,1.5,"foo, ""bar""",2022/01/02,2022-01-02 03:04:05,true,POINT (1 2)',
+            ",,,,,,,",
+            '-3,-5,"2,5",baz,invalid,,0,"LINESTRING (0 0,1 1)"',
+            "",
+            '4,5,6.5,"multi',
+            'line",2022-01-03,,false,POINT (3 4)',
+            "7,8,9.5,,,,,POINT (5 6)",
+            "8",
+        ]
+    )
+    gdal.FileFromMemBuffer(filename, b"\xef\xbb\xbf" + content.encode("UTF-8"))
+    gdal.FileFromMemBuffer(
+        filename + "t",
+        '"Integer","Integer64","Real","String","Date","DateTime","Integer(Boolean)","WKT"',
+    )
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+
+    def get_values():
+        stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=3"])
+        ret = {}
+        for batch in stream:
+            for k, v in batch.items():
+                ret.setdefault(k, []).extend(
+                    [
+                        bytes(x) if isinstance(x, numpy.ndarray) else x
+                        for x in v.tolist()
+                    ]
+                )
+        return ret
+
+    def check():
+        with gdaltest.error_handler():
+            got = get_values()
+            with gdaltest.config_option("OGR_CSV_STREAM_BASE_IMPL", "YES"):
+                expected = get_values()
+        assert got == expected
+        return got
+
+    got = check()
+    assert got["OGC_FID"] == [1, 2, 3, 4, 5, 6]
+    assert got["str"] == [b'foo, "bar"', b"", b"baz", b"multi\nline", b"", None]
+    assert got["real"][2] == 2.5
+
+    lyr.SetSpatialFilterRect(0, 0, 3.5, 4.5)
+    assert len(check()["OGC_FID"]) == 3
+    lyr.SetSpatialFilter(None)
+
+    lyr.SetIgnoredFields(["int"])
+    check()
+
+    lyr.SetIgnoredFields(["OGR_GEOMETRY"])
+    check()
+
+    lyr.SetIgnoredFields([])
+    lyr.SetAttributeFilter("1 = 1")
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+
+    ds = None
+
+    gdal.Unlink(filename)
+    gdal.Unlink(filename + "t")
+
+    # Time fields are not handled natively
+    ds = ogr.Open("data/csv/testcsvt.csv")
+    lyr = ds.GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
@@ -1133,3 +1133,65 @@ def test_ogr_flatgeobuf_arrow_stream_numpy():
     ds = None
 
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
+
+
+###############################################################################
+# Test coalesced reads of the features found by a spatial index search
+
+
+@pytest.mark.parametrize("max_gap_size", ["0", "1", "100", "65536"])
+def test_ogr_flatgeobuf_spatial_index_coalesced_reads(max_gap_size):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = "/vsimem/test_ogr_flatgeobuf_spatial_index_coalesced_reads.fgb"
+    ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbLineString)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        # Variable feature sizes to exercise the size estimate of the last
+        # feature of a range
+        f.SetField("str", "x" * (i % 37) * (1 + 50 * (i % 7 == 0)))
+        f.SetGeometry(
+            ogr.CreateGeometryFromWkt(
+                "LINESTRING (%d %d,%d %d)" % (i % 40, i // 40, i % 40 + 1, i // 40)
+            )
+        )
+        lyr.CreateFeature(f)
+    ds = None
+
+    def get_results(lyr):
+        lyr.SetSpatialFilterRect(3.5, 2.5, 25.5, 20.5)
+        res = [
+            (f.GetFID(), f.GetField("str"), f.GetGeometryRef().ExportToWkt())
+            for f in lyr
+        ]
+        lyr.ResetReading()
+        res_arrow = []
+        for batch in lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=7"]):
+            res_arrow += [
+                (fid, bytes(wkb))
+                for fid, wkb in zip(batch["OGC_FID"], batch["wkb_geometry"])
+            ]
+        lyr.SetSpatialFilter(None)
+        return res, res_arrow
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    with gdaltest.config_option("OGR_FLATGEOBUF_MAX_GAP_SIZE", "0"):
+        expected, expected_arrow = get_results(lyr)
+    assert len(expected) == 23 * 18
+    with gdaltest.config_option("OGR_FLATGEOBUF_MAX_GAP_SIZE", max_gap_size):
+        got, got_arrow = get_results(lyr)
+        assert got == expected
+        assert got_arrow == expected_arrow
+        # Check that iteration can be restarted in the middle of the results
+        lyr.SetSpatialFilterRect(3.5, 2.5, 25.5, 20.5)
+        for i in range(10):
+            lyr.GetNextFeature()
+        lyr.ResetReading()
+        assert [f.GetFID() for f in lyr] == [x[0] for x in expected]
+    ds = None
+
+    gdal.Unlink(filename)
@@ -4134,3 +4134,75 @@ def test_ogr_geojson_ogr2ogr_nln_with_input_dataset_having_name():
     assert ds.GetLayer(0).GetName() == "new_name"
     ds = None
     gdal.Unlink(filename)
+
+
+###############################################################################
+# Test the driver-specific implementation of the Arrow stream interface
+
+
+def test_ogr_geojson_arrow_stream():
+    pytest.importorskip("osgeo.gdal_array")
+    numpy = pytest.importorskip("numpy")
+
+    filename = "/vsimem/test_ogr_geojson_arrow_stream.geojson"
+    gdal.FileFromMemBuffer(
+        filename,
+        """{"type": "FeatureCollection", "features": [
+{"type": "Feature", "id": 10, "properties": {"int": 1, "int64": 1234567890123, "real": 1.5, "str": "foo", "bool": true, "date": "2022/01/02", "dt": "2022-01-02T03:04:05.678Z", "obj": {"a": [1, 2]}}, "geometry": {"type": "Point", "coordinates": [1, 2]}},
+{"type": "Feature", "id": 11, "properties": {"int": null, "str": null}, "geometry": null},
+{"type": "Feature", "id": 12, "properties": {"int": -3, "real": 2, "str": "bar", "bool": false, "date": "invalid"}, "geometry": {"type": "LineString", "coordinates": [[0, 0], [1, 1]]}},
+{"type": "Feature", "id": 13, "properties": {"int64": 5, "str": "baz"}, "geometry": {"type": "Point", "coordinates": [3, 4]}},
+{"type": "Feature", "id": 14, "properties": {}, "geometry": {"type": "Point", "coordinates": [5, 6]}}
+]}""",
+    )
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+
+    def get_values():
+        stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=2"])
+        ret = {}
+        for batch in stream:
+            for k, v in batch.items():
+                ret.setdefault(k, []).extend(
+                    [
+                        bytes(x) if isinstance(x, numpy.ndarray) else x
+                        for x in v.tolist()
+                    ]
+                )
+        return ret
+
+    def check():
+        got = get_values()
+        with gdaltest.config_option("OGR_GEOJSON_STREAM_BASE_IMPL", "YES"):
+            expected = get_values()
+        assert got == expected
+        return got
+
+    got = check()
+    assert got["OGC_FID"] == [10, 11, 12, 13, 14]
+    assert got["str"] == [b"foo", None, b"bar", b"baz", None]
+
+    lyr.SetSpatialFilterRect(0, 0, 3.5, 4.5)
+    assert check()["OGC_FID"] == [10, 12, 13]
+    lyr.SetSpatialFilter(None)
+
+    lyr.SetIgnoredFields(["int"])
+    check()
+
+    lyr.SetIgnoredFields(["OGR_GEOMETRY"])
+    check()
+
+    lyr.SetIgnoredFields([])
+    lyr.SetAttributeFilter("1 = 1")
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+
+    ds = None
+
+    # NATIVE_DATA is not handled natively
+    ds = gdal.OpenEx(filename, gdal.OF_VECTOR, open_options=["NATIVE_DATA=YES"])
+    assert ds.GetLayer(0).TestCapability(ogr.OLCFastGetArrowStream) == 0
+    ds = None
+
+    gdal.Unlink(filename)
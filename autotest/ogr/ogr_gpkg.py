@@ -7557,6 +7557,53 @@ def test_ogr_gpkg_arrow_stream_numpy():
     ogr.GetDriverByName("GPKG").DeleteDataSource("/vsimem/test.gpkg")
 
 
+###############################################################################
+# Test WriteArrowBatch()
+
+
+def test_ogr_gpkg_write_arrow_batch():
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("src", geom_type=ogr.wkbPoint)
+    src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    for i in range(10):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["str"] = "foo%d" % i
+        f["int"] = i
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        src_lyr.CreateFeature(f)
+
+    filename = "/vsimem/test_ogr_gpkg_write_arrow_batch.gpkg"
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    assert lyr.TestCapability(ogr.OLCFastWriteArrowBatch) == 0
+    for i in range(src_lyr.GetLayerDefn().GetFieldCount()):
+        lyr.CreateField(src_lyr.GetLayerDefn().GetFieldDefn(i))
+
+    stream = src_lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=4", "INCLUDE_FID=NO"])
+    schema = stream.GetSchema()
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        assert lyr.WriteArrowBatch(schema, array)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 10
+    src_lyr.ResetReading()
+    for src_f, f in zip(src_lyr, lyr):
+        assert f.GetFID() == src_f.GetFID() + 1
+        assert f["str"] == src_f["str"]
+        assert f["int"] == src_f["int"]
+        assert f.GetGeometryRef().ExportToWkt() == src_f.GetGeometryRef().ExportToWkt()
+    ds = None
+
+    gdal.Unlink(filename)
+
+
 ###############################################################################
 # Test opening a file in WAL mode on a read-only storage
 
@@ -28,6 +28,7 @@
 ###############################################################################
 
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -588,3 +589,129 @@ def test_ogr_join_23():
     ds.ReleaseResultSet(sql_lyr)
 
     ds = None
+
+
+###############################################################################
+# Test the hash join strategy, and its consistency with attribute filters
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        {},
+        {"OGR_SQL_HASH_JOIN_MIN_FEATURES": "1"},
+        {"OGR_SQL_HASH_JOIN_MIN_FEATURES": "1", "OGR_SQL_HASH_JOIN_MAX_MEMORY": "1"},
+        {"OGR_SQL_HASH_JOIN": "NO"},
+    ],
+)
+def test_ogr_join_hash_join(options):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("first")
+    lyr.CreateField(ogr.FieldDefn("int_key", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    for int_key, str_key in [(1, "a"), (2, "B"), (3, "c"), (None, None)]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_key"] = int_key
+        f["str_key"] = str_key
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second")
+    lyr.CreateField(ogr.FieldDefn("int_key", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for int_key, str_key, val in [
+        (2, "b", "first_2"),
+        (1, "A", "first_1"),
+        (2, "B", "second_2"),
+        (None, None, "null"),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_key"] = int_key
+        f["str_key"] = str_key
+        f["val"] = val
+        lyr.CreateFeature(f)
+
+    with gdaltest.config_options(options):
+        for key in ("int_key", "str_key"):
+            sql_lyr = ds.ExecuteSQL(
+                "SELECT first.%s, second.val FROM first "
+                "LEFT JOIN second ON first.%s = second.%s" % (key, key, key)
+            )
+            got = [f.GetField(1) for f in sql_lyr]
+            ds.ReleaseResultSet(sql_lyr)
+            assert got == ["first_1", "first_2", None, None], key
+
+
+###############################################################################
+# Test when the hash join strategy is used
+
+
+def _get_hash_join_messages(ds, sql, options):
+
+    messages = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass == gdal.CE_Debug and "hash table" in msg:
+            messages.append(msg)
+
+    with gdaltest.config_options(dict(options, CPL_DEBUG="ON")):
+        gdal.PushErrorHandler(my_handler)
+        try:
+            sql_lyr = ds.ExecuteSQL(sql, dialect="OGRSQL")
+            got = [f.GetField(1) for f in sql_lyr]
+            ds.ReleaseResultSet(sql_lyr)
+        finally:
+            gdal.PopErrorHandler()
+    return got, messages
+
+
+@pytest.mark.parametrize("driver_name", ["Memory", "GPKG"])
+def test_ogr_join_hash_join_min_features(driver_name):
+
+    drv = ogr.GetDriverByName(driver_name)
+    if drv is None:
+        pytest.skip(f"{driver_name} driver missing")
+
+    filename = "/vsimem/test_ogr_join_hash_join_min_features.gpkg"
+    ds = drv.CreateDataSource(filename)
+    lyr = ds.CreateLayer("first", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("key", ogr.OFTString))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["key"] = "k%d" % i
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("key", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["key"] = "k%d" % i
+        f["val"] = "v%d" % i
+        lyr.CreateFeature(f)
+
+    sql = (
+        "SELECT first.key, second.val FROM first "
+        "LEFT JOIN second ON first.key = second.key"
+    )
+    expected = ["v%d" % i for i in range(10)]
+
+    # Not enough primary features
+    got, messages = _get_hash_join_messages(ds, sql, {})
+    assert got == expected
+    assert messages == []
+
+    got, messages = _get_hash_join_messages(
+        ds, sql, {"OGR_SQL_HASH_JOIN_MIN_FEATURES": "5"}
+    )
+    assert got == expected
+    if driver_name == "GPKG":
+        # Attribute filters are translated by the driver
+        assert messages == []
+    else:
+        assert len(messages) == 1
+
+    ds = None
+    if driver_name == "GPKG":
+        gdal.Unlink(filename)
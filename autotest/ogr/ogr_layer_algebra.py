@@ -586,6 +586,74 @@ def test_algebra_erase():
     recreate_layer_C()
 
 
+###############################################################################
+# Test the multi-threaded implementation against the sequential one
+
+
+@pytest.mark.parametrize(
+    "method",
+    ["Intersection", "Union", "SymDifference", "Identity", "Update", "Clip", "Erase"],
+)
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_algebra_num_threads(method, num_threads):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+
+    input_lyr = ds.CreateLayer("input")
+    input_lyr.CreateField(ogr.FieldDefn("input_id", ogr.OFTInteger))
+    for i in range(400):
+        x = (i % 20) * 1.5
+        y = (i // 20) * 1.5
+        f = ogr.Feature(input_lyr.GetLayerDefn())
+        f["input_id"] = i
+        f.SetGeometryDirectly(
+            ogr.CreateGeometryFromWkt(
+                "POLYGON((%f %f,%f %f,%f %f,%f %f,%f %f))"
+                % (x, y, x, y + 2, x + 2, y + 2, x + 2, y, x, y)
+            )
+        )
+        input_lyr.CreateFeature(f)
+
+    method_lyr = ds.CreateLayer("method")
+    method_lyr.CreateField(ogr.FieldDefn("method_id", ogr.OFTInteger))
+    for i in range(150):
+        x = (i % 10) * 3.1 + 0.5
+        y = (i // 10) * 2.3 + 0.5
+        f = ogr.Feature(method_lyr.GetLayerDefn())
+        f["method_id"] = i
+        f.SetGeometryDirectly(
+            ogr.CreateGeometryFromWkt(
+                "POLYGON((%f %f,%f %f,%f %f,%f %f))"
+                % (x, y, x + 1, y + 3, x + 3, y, x, y)
+            )
+        )
+        method_lyr.CreateFeature(f)
+    # Features without geometry must be ignored
+    method_lyr.CreateFeature(ogr.Feature(method_lyr.GetLayerDefn()))
+
+    # Spatial filters must be honored
+    method_lyr.SetSpatialFilterRect(0, 0, 25, 25)
+
+    ref_lyr = ds.CreateLayer("ref")
+    assert getattr(input_lyr, method)(method_lyr, ref_lyr) == 0
+    assert ref_lyr.GetFeatureCount() > 0
+
+    lyr = ds.CreateLayer("result")
+    assert (
+        getattr(input_lyr, method)(
+            method_lyr, lyr, options=["NUM_THREADS=" + num_threads]
+        )
+        == 0
+    )
+
+    assert lyr.GetFeatureCount() == ref_lyr.GetFeatureCount()
+    for f_ref in ref_lyr:
+        f = lyr.GetNextFeature()
+        for i in range(f_ref.GetFieldCount()):
+            assert f.GetField(i) == f_ref.GetField(i)
+        assert f.GetGeometryRef().Equals(f_ref.GetGeometryRef())
+
+
 def test_algebra_cleanup():
 
     global ds, A, B, C, pointInB, D1, D2, empty
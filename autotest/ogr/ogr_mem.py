@@ -937,6 +937,117 @@ def test_ogr_mem_arrow_stream_pyarrow():
     assert len(arrays) == 2
 
 
+###############################################################################
+# Test OGRLayer::WriteArrowBatch() (generic implementation)
+
+
+def test_ogr_mem_write_arrow_batch():
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("src", geom_type=ogr.wkbPoint)
+    src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    src_lyr.CreateField(fld_defn)
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    src_lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    src_lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    src_lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    src_lyr.CreateField(ogr.FieldDefn("time", ogr.OFTTime))
+    src_lyr.CreateField(ogr.FieldDefn("datetime", ogr.OFTDateTime))
+    src_lyr.CreateField(ogr.FieldDefn("binary", ogr.OFTBinary))
+    src_lyr.CreateField(ogr.FieldDefn("intlist", ogr.OFTIntegerList))
+    src_lyr.CreateField(ogr.FieldDefn("int64list", ogr.OFTInteger64List))
+    src_lyr.CreateField(ogr.FieldDefn("reallist", ogr.OFTRealList))
+    src_lyr.CreateField(ogr.FieldDefn("strlist", ogr.OFTStringList))
+
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["str"] = "foo"
+    f["bool"] = True
+    f["int"] = -123
+    f["int64"] = 1234567890123
+    f["real"] = 1.25
+    f["date"] = "2022-05-31"
+    f["time"] = "12:34:56.789"
+    f["datetime"] = "1969-12-31T23:59:58.5"
+    f.SetFieldBinaryFromHexString("binary", "DEAD")
+    f["intlist"] = [1, -2]
+    f["int64list"] = [1234567890123, -1]
+    f["reallist"] = [1.5, -2.5]
+    f["strlist"] = ["a", "bc"]
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+    src_lyr.CreateFeature(f)
+
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    for i in range(src_lyr.GetLayerDefn().GetFieldCount()):
+        f.SetFieldNull(i)
+    src_lyr.CreateFeature(f)
+
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["str"] = ""
+    f["intlist"] = []
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (3 4)"))
+    f.SetFID(10)
+    for i in range(src_lyr.GetLayerDefn().GetFieldCount()):
+        if not f.IsFieldSet(i):
+            f.SetFieldNull(i)
+    src_lyr.CreateFeature(f)
+
+    dst_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    dst_lyr = dst_ds.CreateLayer("dst", geom_type=ogr.wkbPoint)
+    assert dst_lyr.TestCapability(ogr.OLCFastWriteArrowBatch) == 0
+    for i in range(src_lyr.GetLayerDefn().GetFieldCount()):
+        dst_lyr.CreateField(src_lyr.GetLayerDefn().GetFieldDefn(i))
+
+    stream = src_lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=2"])
+    schema = stream.GetSchema()
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        assert dst_lyr.WriteArrowBatch(schema, array)
+
+    assert dst_lyr.GetFeatureCount() == src_lyr.GetFeatureCount()
+    src_lyr.ResetReading()
+    for src_f, dst_f in zip(src_lyr, dst_lyr):
+        if not src_f.Equal(dst_f):
+            src_f.DumpReadable()
+            dst_f.DumpReadable()
+            pytest.fail()
+
+
+###############################################################################
+# Test OGRLayer::WriteArrowBatch() with columns not matching the layer
+
+
+def test_ogr_mem_write_arrow_batch_unknown_column():
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("src", geom_type=ogr.wkbPoint)
+    src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    src_lyr.CreateField(ogr.FieldDefn("unknown", ogr.OFTString))
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["str"] = "foo"
+    f["unknown"] = "bar"
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+    src_lyr.CreateFeature(f)
+
+    dst_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    dst_lyr = dst_ds.CreateLayer("dst", geom_type=ogr.wkbPoint)
+    dst_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+
+    stream = src_lyr.GetArrowStream(["INCLUDE_FID=NO"])
+    schema = stream.GetSchema()
+    array = stream.GetNextRecordBatch()
+    with gdaltest.error_handler():
+        assert dst_lyr.WriteArrowBatch(schema, array)
+    assert "unknown" in gdal.GetLastErrorMsg()
+
+    dst_f = dst_lyr.GetNextFeature()
+    assert dst_f["str"] == "foo"
+    assert dst_f.GetGeometryRef().ExportToWkt() == "POINT (1 2)"
+
+
 ###############################################################################
 # Test upserting a feature.
 
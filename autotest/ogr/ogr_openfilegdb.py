@@ -2478,6 +2478,91 @@ def test_ogr_openfilegdb_read_relationships():
     assert rel.GetRelatedTableType() == "media"
 
 
+###############################################################################
+# Test the driver-specific Arrow stream against the generic implementation
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "/vsizip/data/filegdb/testopenfilegdb.gdb.zip/testopenfilegdb.gdb",
+        "data/filegdb/curves.gdb",
+        "data/filegdb/Domains.gdb",
+        "data/filegdb/test_spatial_index.gdb.zip",
+    ],
+)
+def test_ogr_openfilegdb_arrow_stream(filename):
+    pytest.importorskip("osgeo.gdal_array")
+    numpy = pytest.importorskip("numpy")
+
+    def normalize(x):
+        if isinstance(x, numpy.ndarray):
+            return bytes(x)
+        if isinstance(x, float) and x != x:
+            return "nan"
+        return x
+
+    def get_values(lyr):
+        stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=3"])
+        ret = {}
+        for batch in stream:
+            for k, v in batch.items():
+                ret.setdefault(k, []).extend([normalize(x) for x in v.tolist()])
+        return ret
+
+    def check(lyr):
+        got = get_values(lyr)
+        with gdaltest.config_option("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "YES"):
+            expected = get_values(lyr)
+        assert got == expected, lyr.GetName()
+
+    ds = ogr.Open(filename)
+    for lyr in ds:
+        assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+        check(lyr)
+
+        if lyr.GetGeomType() != ogr.wkbNone:
+            minx, maxx, miny, maxy = lyr.GetExtent()
+            lyr.SetSpatialFilterRect(minx, miny, (minx + maxx) / 2, (miny + maxy) / 2)
+            check(lyr)
+            lyr.SetSpatialFilter(None)
+
+        if lyr.GetLayerDefn().GetFieldCount() > 0:
+            lyr.SetIgnoredFields([lyr.GetLayerDefn().GetFieldDefn(0).GetName()])
+            check(lyr)
+            lyr.SetIgnoredFields([])
+
+
+###############################################################################
+# Test that OLCFastGetArrowStream is not advertised when GetNextArrowArray()
+# uses the generic implementation
+
+
+def test_ogr_openfilegdb_arrow_stream_capability():
+
+    ds = ogr.Open("data/filegdb/curves.gdb")
+    lyr = ds.GetLayer(0)
+    assert lyr.GetGeomType() != ogr.wkbNone
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+
+    with gdaltest.config_option("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "YES"):
+        assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+
+    lyr.SetAttributeFilter("1 = 1")
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+    lyr.SetAttributeFilter(None)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+
+    minx, maxx, miny, maxy = lyr.GetExtent()
+    lyr.SetSpatialFilterRect(minx, miny, (minx + maxx) / 2, (miny + maxy) / 2)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+    lyr.SetIgnoredFields(["OGR_GEOMETRY"])
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+    lyr.SetSpatialFilter(None)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+
+
 ###############################################################################
 # Cleanup
 
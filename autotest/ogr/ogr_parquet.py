@@ -547,6 +547,66 @@ def test_ogr_parquet_write_from_another_dataset(use_vsi, row_group_size, fid):
         gdal.Unlink(outfilename)
 
 
+###############################################################################
+# Test WriteArrowBatch() fast path
+
+
+def test_ogr_parquet_write_arrow_batch():
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("src", geom_type=ogr.wkbPoint)
+    src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    src_lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    src_lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    for i in range(5):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        if i != 2:
+            f["str"] = "foo%d" % i
+            f["int64"] = i
+            f["real"] = i + 0.5
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        src_lyr.CreateFeature(f)
+
+    outfilename = "/vsimem/test_ogr_parquet_write_arrow_batch.parquet"
+    try:
+        ds = gdal.GetDriverByName("Parquet").Create(
+            outfilename, 0, 0, 0, gdal.GDT_Unknown
+        )
+        lyr = ds.CreateLayer(
+            "test", geom_type=ogr.wkbPoint, options=["ROW_GROUP_SIZE=2"]
+        )
+        assert lyr.TestCapability(ogr.OLCFastWriteArrowBatch) == 1
+        for i in range(src_lyr.GetLayerDefn().GetFieldCount()):
+            lyr.CreateField(src_lyr.GetLayerDefn().GetFieldDefn(i))
+
+        stream = src_lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=3"])
+        schema = stream.GetSchema()
+        while True:
+            array = stream.GetNextRecordBatch()
+            if array is None:
+                break
+            assert lyr.WriteArrowBatch(schema, array)
+        ds = None
+
+        ds = ogr.Open(outfilename)
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == 5
+        assert lyr.GetMetadataItem("NUM_ROW_GROUPS", "_PARQUET_") == "3"
+        assert lyr.GetExtent() == (0, 4, -4, 0)
+        for i, f in enumerate(lyr):
+            if i == 2:
+                assert f.IsFieldNull("str")
+                assert f.GetGeometryRef() is None
+            else:
+                assert f["str"] == "foo%d" % i
+                assert f["int64"] == i
+                assert f["real"] == i + 0.5
+                assert f.GetGeometryRef().ExportToWkt() == "POINT (%d %d)" % (i, -i)
+        ds = None
+    finally:
+        gdal.Unlink(outfilename)
+
+
 ###############################################################################
 # Test write support
 
@@ -5822,6 +5822,82 @@ def test_ogr_shape_alter_geom_field_defn():
     ogr.GetDriverByName("ESRI Shapefile").DeleteDataSource(outfilename)
 
 
+###############################################################################
+# Test the driver-specific Arrow stream against the generic implementation
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/poly.shp",
+        "data/shp/testpoly.shp",
+        "data/shp/gjpoint.shp",
+        "data/shp/gjmultipoint.shp",
+        "data/shp/gjline.shp",
+        "data/shp/gjmultiline.shp",
+        "data/shp/gjpoly.shp",
+        "data/shp/testpointzm.shp",
+        "data/shp/multipatch.shp",
+        "data/shp/facility_surface_dd.dbf",
+    ],
+)
+def test_ogr_shape_arrow_stream(filename):
+    pytest.importorskip("osgeo.gdal_array")
+    numpy = pytest.importorskip("numpy")
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+
+    def get_values():
+        stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=3"])
+        ret = {}
+        for batch in stream:
+            for k, v in batch.items():
+                ret.setdefault(k, []).extend(
+                    [
+                        bytes(x) if isinstance(x, numpy.ndarray) else x
+                        for x in v.tolist()
+                    ]
+                )
+        return ret
+
+    def check():
+        got = get_values()
+        with gdaltest.config_option("OGR_SHAPE_STREAM_BASE_IMPL", "YES"):
+            expected = get_values()
+        assert got == expected
+
+    check()
+
+    if lyr.GetGeomType() != ogr.wkbNone:
+        minx, maxx, miny, maxy = lyr.GetExtent()
+        lyr.SetSpatialFilterRect(minx, miny, (minx + maxx) / 2, (miny + maxy) / 2)
+        check()
+        lyr.SetSpatialFilter(None)
+
+    if lyr.GetLayerDefn().GetFieldCount() > 0:
+        lyr.SetIgnoredFields([lyr.GetLayerDefn().GetFieldDefn(0).GetName()])
+        check()
+
+    lyr.SetIgnoredFields(["OGR_GEOMETRY"])
+    check()
+
+    if lyr.GetGeomType() != ogr.wkbNone:
+        lyr.SetSpatialFilterRect(minx, miny, (minx + maxx) / 2, (miny + maxy) / 2)
+        assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+        check()
+        lyr.SetSpatialFilter(None)
+
+    lyr.SetIgnoredFields([])
+    with gdaltest.config_option("OGR_SHAPE_STREAM_BASE_IMPL", "YES"):
+        assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+
+    lyr.SetAttributeFilter("1 = 1")
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+
+
 ###############################################################################
 
 
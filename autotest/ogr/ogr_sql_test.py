@@ -1556,6 +1556,61 @@ def test_ogr_sql_48():
         ds.ReleaseResultSet(sql_lyr)
 
 
+###############################################################################
+# Test ORDER BY with a temporary file and with LIMIT / OFFSET
+
+
+@pytest.mark.parametrize(
+    "sql",
+    [
+        "SELECT * FROM test ORDER BY str_field, int_field DESC",
+        "SELECT * FROM test ORDER BY int_field",
+        "SELECT * FROM test ORDER BY FID",
+        "SELECT * FROM test ORDER BY str_field LIMIT 7",
+        "SELECT * FROM test ORDER BY int_field DESC LIMIT 5 OFFSET 100",
+        "SELECT * FROM test ORDER BY FID LIMIT 10",
+    ],
+)
+def test_ogr_sql_order_by_bounded_memory(sql):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetField(0, (i * 37) % 101)
+        if (i % 13) == 0:
+            f.SetFieldNull(1)
+        elif (i % 7) != 0:
+            f.SetField(1, "val%d" % ((i * 17) % 23))
+        lyr.CreateFeature(f)
+
+    def get_fids():
+        sql_lyr = ds.ExecuteSQL(sql)
+        try:
+            fids = [f.GetFID() for f in sql_lyr]
+            if len(fids) > 3:
+                sql_lyr.SetNextByIndex(3)
+                assert sql_lyr.GetNextFeature().GetFID() == fids[3]
+            return fids
+        finally:
+            ds.ReleaseResultSet(sql_lyr)
+
+    with gdaltest.config_option("OGR_SQL_ORDER_BY_MAX_MEMORY", "1000000000"):
+        expected_fids = get_fids()
+    assert len(expected_fids) > 0
+    if "LIMIT" not in sql:
+        assert len(expected_fids) == 1000
+
+    # Force the use of several runs in the temporary file
+    with gdaltest.config_option("OGR_SQL_ORDER_BY_MAX_MEMORY", "2000"):
+        assert get_fids() == expected_fids
+
+    with gdaltest.config_option("OGR_SQL_ORDER_BY_MAX_MEMORY", "1"):
+        assert get_fids() == expected_fids
+
+
 ###############################################################################
 # Test arithmetic expressions
 
@@ -1701,6 +1756,81 @@ def test_ogr_sql_attribute_filter_on_top_of_non_forward_where_clause(dialect):
         mem_ds.ReleaseResultSet(sql_lyr)
 
 
+###############################################################################
+# Test that the compiled evaluation of attribute filters gives the same
+# results as the generic one
+
+
+@pytest.mark.parametrize(
+    "where",
+    [
+        "int_field = 3",
+        "int_field <> 3",
+        "int_field < 3 OR int_field >= 7",
+        "NOT (int_field <= 3)",
+        "int_field BETWEEN 2 AND 5",
+        "int_field IN (1, 4, 8)",
+        "int_field IN (1, 4.5, 8)",
+        "int_field > 2.5",
+        "int64_field = 1234567890123",
+        "int64_field > int_field",
+        "real_field < 4.5",
+        "real_field = 3",
+        "real_field IN (1.5, 3)",
+        "str_field = 'VAL3'",
+        "str_field <> 'val3'",
+        "str_field > 'val4'",
+        "str_field IN ('val1', 'VAL2', 'other')",
+        "str_field BETWEEN 'val2' AND 'val5'",
+        "str_field IS NULL",
+        "NOT str_field IS NULL",
+        "int_field IS NULL OR str_field = 'val1'",
+        "bool_field",
+        "NOT bool_field",
+        "bool_field OR int_field = 1",
+        "bool_field AND int_field > 1",
+        "int_field = 1 OR bool_field",
+        "int_field + 1 = 3 AND str_field LIKE 'val%'",
+        "NOT (str_field LIKE 'val1%') OR real_field > 2",
+        "FID IN (0, 2, 4)",
+        "int_field = NULL",
+    ],
+)
+def test_ogr_sql_compiled_where(where):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64_field", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real_field", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    fld_defn = ogr.FieldDefn("bool_field", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i != 5:
+            f["int_field"] = i
+        f["int64_field"] = 1234567890123 if i == 1 else i * 2
+        if i != 6:
+            f["real_field"] = i * 0.75 + 1.5
+        if i % 4 == 3:
+            f.SetFieldNull("str_field")
+        elif i != 7:
+            f["str_field"] = "val%d" % i
+        if i != 8:
+            f["bool_field"] = i % 3 == 0
+        lyr.CreateFeature(f)
+
+    def get_fids():
+        assert lyr.SetAttributeFilter(where) == ogr.OGRERR_NONE
+        return [f.GetFID() for f in lyr]
+
+    with gdaltest.config_option("OGR_SQL_COMPILE_WHERE", "NO"):
+        expected_fids = get_fids()
+    assert get_fids() == expected_fids
+
+
 ###############################################################################
 
 
@@ -1502,3 +1502,243 @@ def test_ogr2ogr_lib_transaction_size(transaction_size):
     finally:
         ds = None
         gdal.Unlink("/vsimem/out.gpkg")
+
+
+###############################################################################
+# Test translation with the Arrow batch interface, with and without
+# reprojection
+
+
+@pytest.mark.parametrize("reproject", [False, True])
+@pytest.mark.parametrize("preserve_fid", [False, True])
+def test_ogr2ogr_lib_arrow_batch(reproject, preserve_fid):
+
+    srcDS = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    srcLayer = srcDS.CreateLayer("test", srs=srs)
+    srcLayer.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    srcLayer.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i, wkt in enumerate(
+        [
+            "POINT(2 49)",
+            None,
+            "LINESTRING Z (2 49 10,3 50 20)",
+            "MULTIPOLYGON(((2 49,2 50,3 50,2 49)),((3 49,3 48,4 48,3 49)))",
+            "GEOMETRYCOLLECTION(POINT(2 49),LINESTRING(2 49,3 50))",
+        ]
+    ):
+        f = ogr.Feature(srcLayer.GetLayerDefn())
+        f.SetFID(10 + i)
+        f["int"] = i
+        f["str"] = "foo%d" % i
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        srcLayer.CreateFeature(f)
+
+    def translate(use_arrow_api):
+        with gdaltest.config_option("OGR2OGR_USE_ARROW_API", use_arrow_api):
+            return gdal.VectorTranslate(
+                "",
+                srcDS,
+                format="Memory",
+                dstSRS="EPSG:32631" if reproject else None,
+                reproject=reproject,
+                options=["-preserve_fid"] if preserve_fid else [],
+            )
+
+    ds_ref = translate("NO")
+    ds = translate("YES")
+    assert ds is not None
+    lyr_ref = ds_ref.GetLayer(0)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == lyr_ref.GetFeatureCount()
+    for f_ref in lyr_ref:
+        f = lyr.GetNextFeature()
+        if preserve_fid:
+            assert f.GetFID() == f_ref.GetFID()
+        assert f["int"] == f_ref["int"]
+        assert f["str"] == f_ref["str"]
+        g_ref = f_ref.GetGeometryRef()
+        if g_ref is None:
+            assert f.GetGeometryRef() is None
+        else:
+            assert ogrtest.check_feature_geometry(f, g_ref) == 0
+
+
+###############################################################################
+# Test that an option requiring per-feature processing disables the Arrow
+# batch interface
+
+
+def test_ogr2ogr_lib_arrow_batch_not_used_with_limit():
+
+    srcDS = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srcLayer = srcDS.CreateLayer("test")
+    for i in range(3):
+        f = ogr.Feature(srcLayer.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(%d 49)" % i))
+        srcLayer.CreateFeature(f)
+
+    def translate(**kwargs):
+        got_msg = []
+
+        def my_handler(errorClass, errno, msg):
+            got_msg.append(msg)
+            return
+
+        with gdaltest.config_options(
+            {"OGR2OGR_USE_ARROW_API": "YES", "CPL_DEBUG": "ON"}
+        ):
+            gdal.PushErrorHandler(my_handler)
+            try:
+                ds = gdal.VectorTranslate("", srcDS, format="Memory", **kwargs)
+            finally:
+                gdal.PopErrorHandler()
+        used_arrow = any("with the Arrow API" in msg for msg in got_msg)
+        return ds, used_arrow
+
+    # Check that the debug message used to detect the path taken is emitted
+    ds, used_arrow = translate()
+    assert ds.GetLayer(0).GetFeatureCount() == 3
+    assert used_arrow
+
+    ds, used_arrow = translate(limit=2)
+    assert ds.GetLayer(0).GetFeatureCount() == 2
+    assert not used_arrow
+
+
+###############################################################################
+# Test multi-threaded processing of features
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        ["-t_srs", "EPSG:32631"],
+        ["-explodecollections", "-preserve_fid"],
+        ["-limit", "1234"],
+        ["-segmentize", "0.1"],
+    ],
+)
+def test_ogr2ogr_lib_num_threads(options):
+
+    srcDS = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    srcLayer = srcDS.CreateLayer("test", srs=srs)
+    srcLayer.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(5000):
+        f = ogr.Feature(srcLayer.GetLayerDefn())
+        f["id"] = i
+        x = 2 + (i % 100) * 0.01
+        y = 49 + (i // 100) * 0.01
+        if i % 3 == 0:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    "MULTIPOINT((%f %f),(%f %f))" % (x, y, x + 0.5, y + 0.5)
+                )
+            )
+        elif i % 3 == 1:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    "LINESTRING(%f %f,%f %f)" % (x, y, x + 0.5, y + 0.5)
+                )
+            )
+        srcLayer.CreateFeature(f)
+
+    ds_ref = gdal.VectorTranslate("", srcDS, format="Memory", options=options)
+    ds = gdal.VectorTranslate(
+        "", srcDS, format="Memory", options=options + ["-num_threads", "4"]
+    )
+    lyr_ref = ds_ref.GetLayer(0)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == lyr_ref.GetFeatureCount()
+    for f_ref in lyr_ref:
+        f = lyr.GetNextFeature()
+        assert f.GetFID() == f_ref.GetFID()
+        assert f["id"] == f_ref["id"]
+        g_ref = f_ref.GetGeometryRef()
+        if g_ref is None:
+            assert f.GetGeometryRef() is None
+        else:
+            assert f.GetGeometryRef().Equals(g_ref)
+
+
+###############################################################################
+# Test that a reprojection error is reported with multi-threaded processing
+
+
+def test_ogr2ogr_lib_num_threads_reprojection_error():
+
+    srcDS = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(32631)
+    srcLayer = srcDS.CreateLayer("test", srs=srs)
+    for i in range(10):
+        f = ogr.Feature(srcLayer.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(1e20 1e20)"))
+        srcLayer.CreateFeature(f)
+
+    with gdaltest.error_handler():
+        ds = gdal.VectorTranslate(
+            "",
+            srcDS,
+            format="Memory",
+            dstSRS="EPSG:4326",
+            reproject=True,
+            options=["-num_threads", "2"],
+        )
+    assert ds is None or ds.GetLayer(0).GetFeatureCount() == 0
+
+
+###############################################################################
+# Test that the errors emitted while processing features in worker threads
+# reach the error handler of the calling thread, in the same order as with
+# a single thread
+
+
+def test_ogr2ogr_lib_num_threads_errors_reported_to_caller():
+
+    srcDS = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(32631)
+    srcLayer = srcDS.CreateLayer("test", srs=srs)
+    for i in range(1000):
+        f = ogr.Feature(srcLayer.GetLayerDefn())
+        if i == 500:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(1e20 1e20)"))
+        else:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(500000 %d)" % i))
+        srcLayer.CreateFeature(f)
+
+    def translate(num_threads):
+        got_msg = []
+
+        def my_handler(errorClass, errno, msg):
+            if errorClass != gdal.CE_Debug:
+                got_msg.append((errorClass, msg))
+
+        gdal.PushErrorHandler(my_handler)
+        try:
+            ds = gdal.VectorTranslate(
+                "",
+                srcDS,
+                format="Memory",
+                dstSRS="EPSG:4326",
+                reproject=True,
+                options=["-num_threads", str(num_threads)],
+            )
+        finally:
+            gdal.PopErrorHandler()
+        return ds, got_msg
+
+    ds_ref, msgs_ref = translate(1)
+    ds, msgs = translate(2)
+    # The reprojection error emitted by the coordinate transformation, and
+    # then the one of ogr2ogr
+    assert len(msgs_ref) >= 2
+    assert msgs == msgs_ref
+    assert (ds is None) == (ds_ref is None)
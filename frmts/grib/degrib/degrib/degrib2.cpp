@@ -908,6 +908,8 @@ int ReadGrib2Record (VSILFILE *fp, sChar f_unit, double **Grib_Data,
                          * this is the second or later grid from the same
                          * GRIB message. */
    sInt4 iclean = 0;    /* 0 embed the missing values, 1 don't. */
+   unpk_g2ncep_state unpkState; /* State of the unpacker between the calls
+                                 * for the sub grids of this message. */
    int j;               /* Counter used to find the desired subgrid. */
    sInt4 kfildo = 5;    /* FORTRAN Unit number for diagnostic info. Ignored,
                          * unless library is compiled a particular way. */
@@ -1194,7 +1196,7 @@ int ReadGrib2Record (VSILFILE *fp, sChar f_unit, double **Grib_Data,
                   &(IS->ns[4]), IS->is[5], &(IS->ns[5]), IS->is[6],
                   &(IS->ns[6]), IS->is[7], &(IS->ns[7]), IS->ib, &ibitmap,
                   c_ipack, &(IS->nd5), &xmissp, &xmisss, &inew, &iclean,
-                  &l3264b, f_endMsg, jer, &ndjer, &kjer);
+                  &l3264b, f_endMsg, jer, &ndjer, &kjer, &unpkState);
 /*
       unpk_grib2 (&kfildo, (float *) (IS->iain), IS->iain, &(IS->nd2x3),
                   IS->idat, &(IS->nidat), IS->rdat, &(IS->nrdat), IS->is[0],
@@ -1428,6 +1430,8 @@ int ReadGrib2RecordFast (FILE *fp, sChar f_unit, double **Grib_Data,
                          * this is the second or later grid from the same
                          * GRIB message. */
    sInt4 iclean = 0;    /* 0 embed the missing values, 1 don't. */
+   unpk_g2ncep_state unpkState; /* State of the unpacker between the calls
+                                 * for the sub grids of this message. */
    int j;               /* Counter used to find the desired subgrid. */
    sInt4 kfildo = 5;    /* FORTRAN Unit number for diagnostic info. Ignored,
                          * unless library is compiled a particular way. */
@@ -1623,7 +1627,7 @@ int ReadGrib2RecordFast (FILE *fp, sChar f_unit, double **Grib_Data,
                   &(IS->ns[4]), IS->is[5], &(IS->ns[5]), IS->is[6],
                   &(IS->ns[6]), IS->is[7], &(IS->ns[7]), IS->ib, &ibitmap,
                   c_ipack, &(IS->nd5), &xmissp, &xmisss, &inew, &iclean,
-                  &l3264b, f_endMsg, jer, &ndjer, &kjer);
+                  &l3264b, f_endMsg, jer, &ndjer, &kjer, &unpkState);
 
 
       /*
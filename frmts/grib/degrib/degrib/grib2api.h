@@ -20,6 +20,14 @@ extern "C" {
 
 #include "type.h"
 
+/* State carried between the calls to unpk_g2ncep() that walk the sub grids
+ * of a same GRIB2 message. This used to be kept in static variables, which
+ * prevented unpacking messages from several threads at once. */
+typedef struct {
+   sInt4 subgNum;       /* The sub grid we read most recently. */
+   sInt4 numfields;     /* Number of sub grids in this message. */
+} unpk_g2ncep_state;
+
 void unpk_grib2 (sInt4 *kfildo, float *ain, sInt4 *iain, sInt4 *nd2x3,
                  sInt4 *idat, sInt4 *nidat, float *rdat, sInt4 *nrdat,
                  sInt4 *is0, sInt4 *ns0, sInt4 *is1, sInt4 *ns1, sInt4 *is2,
@@ -38,7 +46,8 @@ void unpk_g2ncep(sInt4 *kfildo, float *ain, sInt4 *iain, sInt4 *nd2x3,
                  sInt4 *ib, sInt4 *ibitmap, unsigned char *c_ipack,
                  sInt4 *nd5, float *xmissp, float *xmisss,
                  sInt4 *inew, sInt4 *iclean, sInt4 *l3264b,
-                 sInt4 *iendpk, sInt4 *jer, sInt4 *ndjer, sInt4 *kjer);
+                 sInt4 *iendpk, sInt4 *jer, sInt4 *ndjer, sInt4 *kjer,
+                 unpk_g2ncep_state *state);
 int C_pkGrib2 (unsigned char *cgrib, sInt4 *sec0, sInt4 *sec1,
                unsigned char *csec2, sInt4 lcsec2,
                sInt4 *igds, sInt4 *igdstmpl, sInt4 *ideflist,
@@ -458,9 +458,7 @@ int comunpack(unsigned char *cpack,g2int cpack_length,g2int lensec,g2int idrsnum
 //
       //printf("SAGT: %f %f %f\n",ref,bscale,dscale);
       if ( idrstmpl[6] == 0 ) {        // no missing values
-         for (n=0;n<ndpts;n++) {
-            fld[n]=(((g2float)ifld[n]*bscale)+ref)*dscale;
-         }
+         simunpack_scale(ifld,ndpts,ref,bscale,dscale,fld);
       }
       else if ( idrstmpl[6]==1 || idrstmpl[6]==2 ) {
          // missing values included
@@ -1,6 +1,11 @@
 #include "grib2.h"
 #include "limits.h"
 
+#if defined(__x86_64) || defined(_M_X64)
+#include <emmintrin.h>
+#define GBITS_USE_SSE2
+#endif
+
 int gbit(unsigned char *in,g2int *iout,g2int iskip,g2int nbyte)
 {
       return gbits(in,G2_UNKNOWN_SIZE,iout,iskip,nbyte,(g2int)0,(g2int)1);
@@ -17,6 +22,88 @@ void sbit(unsigned char *out,const g2int *in,g2int iskip,g2int nbyte)
 }
 
 
+/*          Fast path of gbits() for contiguous values (nskip = 0), when
+/          all the bytes holding them are known to be within the input.
+/          Byte aligned 8 and 16 bit values are expanded with SSE2 when
+/          available, other widths up to 25 bits are extracted from a 32-bit
+/          big endian window, without looping over the bytes of each value.
+/          Returns the number of values extracted, which may be less than n,
+/          as the window must not read past in_length.
+*/
+static g2int gbits_contiguous(const unsigned char *in,g2int in_length,
+                              g2int *iout,g2int iskip,g2int nbyte,g2int n)
+{
+      g2int i = 0;
+
+      if ( (iskip % 8) == 0 &&
+           (nbyte == 8 || nbyte == 16 || nbyte == 24 || nbyte == 32) ) {
+         const unsigned char *p = in + iskip / 8;
+         if (nbyte == 8) {
+#ifdef GBITS_USE_SSE2
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 16 <= n; i += 16) {
+               const __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+               const __m128i lo = _mm_unpacklo_epi8(v, zero);
+               const __m128i hi = _mm_unpackhi_epi8(v, zero);
+               _mm_storeu_si128((__m128i *)(iout + i),
+                                _mm_unpacklo_epi16(lo, zero));
+               _mm_storeu_si128((__m128i *)(iout + i + 4),
+                                _mm_unpackhi_epi16(lo, zero));
+               _mm_storeu_si128((__m128i *)(iout + i + 8),
+                                _mm_unpacklo_epi16(hi, zero));
+               _mm_storeu_si128((__m128i *)(iout + i + 12),
+                                _mm_unpackhi_epi16(hi, zero));
+            }
+#endif
+            for (; i < n; i++)
+               iout[i] = p[i];
+         }
+         else if (nbyte == 16) {
+#ifdef GBITS_USE_SSE2
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 8 <= n; i += 8) {
+               __m128i v = _mm_loadu_si128((const __m128i *)(p + 2 * i));
+               /* Values are big endian: swap the bytes of each word */
+               v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+               _mm_storeu_si128((__m128i *)(iout + i),
+                                _mm_unpacklo_epi16(v, zero));
+               _mm_storeu_si128((__m128i *)(iout + i + 4),
+                                _mm_unpackhi_epi16(v, zero));
+            }
+#endif
+            for (; i < n; i++)
+               iout[i] = (p[2 * i] << 8) | p[2 * i + 1];
+         }
+         else if (nbyte == 24) {
+            for (; i < n; i++)
+               iout[i] = (p[3 * i] << 16) | (p[3 * i + 1] << 8) |
+                         p[3 * i + 2];
+         }
+         else {
+            for (; i < n; i++)
+               iout[i] = (g2int)(((unsigned)p[4 * i] << 24) |
+                                 ((unsigned)p[4 * i + 1] << 16) |
+                                 ((unsigned)p[4 * i + 2] << 8) |
+                                 (unsigned)p[4 * i + 3]);
+         }
+         return n;
+      }
+
+      if (nbyte <= 25) {
+         g2int nbit = iskip;
+         for (; i < n; i++, nbit += nbyte) {
+            const unsigned char *p = in + nbit / 8;
+            unsigned w;
+            if (nbit / 8 + 4 > in_length)
+               break;
+            w = ((unsigned)p[0] << 24) | ((unsigned)p[1] << 16) |
+                ((unsigned)p[2] << 8) | (unsigned)p[3];
+            iout[i] = (g2int)((w << (nbit % 8)) >> (32 - nbyte));
+         }
+      }
+      return i;
+}
+
 int gbits(unsigned char *in,g2int in_length,g2int *iout,g2int iskip,g2int nbyte,g2int nskip,
            g2int n)
 /*          Get bits - unpack bits:  Extract arbitrary size values from a
@@ -33,14 +120,23 @@ int gbits(unsigned char *in,g2int in_length,g2int *iout,g2int iskip,g2int nbyte,
 {
       g2int i,tbit,bitcnt,ibit,itmp;
       g2int nbit,l_index;
+      g2int nfast = 0;
       static const g2int ones[]={1,3,7,15,31,63,127,255};
 
-//     nbit is the start position of the field in bits
-      nbit = iskip;
       if( n> 0 && (nbyte + nskip > INT_MAX / n ||
                    iskip > INT_MAX - n*(nbyte + nskip)) )
           return -1;
-      for (i=0;i<n;i++) {
+
+      if( nskip == 0 && n > 0 && nbyte > 0 && nbyte <= 32 &&
+          in_length != G2_UNKNOWN_SIZE &&
+          (iskip + n*nbyte - 1) / 8 < in_length )
+      {
+          nfast = gbits_contiguous(in,in_length,iout,iskip,nbyte,n);
+      }
+
+//     nbit is the start position of the field in bits
+      nbit = iskip + nfast*(nbyte + nskip);
+      for (i=nfast;i<n;i++) {
          bitcnt = nbyte;
          l_index=nbit/8;
          ibit=nbit%8;
@@ -59,6 +59,7 @@
 #define seekgb gdal_seekgb
 #define simpack gdal_simpack
 #define simunpack gdal_simunpack
+#define simunpack_scale gdal_simunpack_scale
 #define specpack gdal_specpack
 #define specunpack gdal_specunpack
 #define templatesdrs gdal_templatesdrs
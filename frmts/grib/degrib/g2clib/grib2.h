@@ -262,6 +262,8 @@ g2int g2_unpack6(unsigned char *cgrib,g2int cgrib_length,g2int *iofst,g2int ngpt
 g2int g2_unpack7(unsigned char *cgrib,g2int cgrib_length,g2int *iofst,g2int igdsnum,g2int *igdstmpl,
                g2int idrsnum,g2int *idrstmpl,g2int ndpts,g2float **fld);
 g2int simunpack(unsigned char *,g2int cpack_length,g2int *, g2int,g2float *);
+void simunpack_scale(const g2int *ifld,g2int ndpts,g2float ref,
+                     g2float bscale,g2float dscale,g2float *fld);
 int comunpack(unsigned char *,g2int cpack_length,g2int,g2int,g2int *,g2int,g2float *);
 g2int specunpack(unsigned char *,g2int *,g2int,g2int,g2int, g2int, g2float *);
 g2int jpcunpack(unsigned char *,g2int,g2int *,g2int, g2float **);
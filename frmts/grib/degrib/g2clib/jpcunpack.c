@@ -72,9 +72,7 @@ g2int jpcunpack(unsigned char *cpack,g2int len,g2int *idrstmpl,g2int ndpts,
              free(ifld);
              return -1;
          }
-         for (j=0;j<ndpts;j++) {
-           (*fld)[j]=(((g2float)ifld[j]*bscale)+ref)*dscale;
-         }
+         simunpack_scale(ifld,ndpts,ref,bscale,dscale,*fld);
          free(ifld);
       }
       else {
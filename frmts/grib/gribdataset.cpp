@@ -53,6 +53,7 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
 #include "degrib/degrib/degrib2.h"
 #include "degrib/degrib/inventory.h"
 #include "degrib/degrib/meta.h"
@@ -67,6 +68,7 @@ CPL_C_END
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_spatialref.h"
 #include "memdataset.h"
 
@@ -855,45 +857,60 @@ CPLErr GRIBRasterBand::LoadData()
             m_Grib_MetaData = nullptr;
         }
         ReadGribData(poGDS->fp, start, subgNum, &m_Grib_Data, &m_Grib_MetaData);
-        if (!m_Grib_Data)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined, "Out of memory.");
-            if (m_Grib_MetaData != nullptr)
-            {
-                MetaFree(m_Grib_MetaData);
-                delete m_Grib_MetaData;
-                m_Grib_MetaData = nullptr;
-            }
-            return CE_Failure;
-        }
+        return CheckLoadedData();
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                          CheckLoadedData()                           */
+/************************************************************************/
+
+// Validates the data freshly loaded in m_Grib_Data / m_Grib_MetaData, and
+// accounts for it in the dataset cache size.
+CPLErr GRIBRasterBand::CheckLoadedData()
+{
+    GRIBDataset *poGDS = static_cast<GRIBDataset *>(poDS);
 
-        // Check the band matches the dataset as a whole, size wise. (#3246)
-        nGribDataXSize = m_Grib_MetaData->gds.Nx;
-        nGribDataYSize = m_Grib_MetaData->gds.Ny;
-        if (nGribDataXSize <= 0 || nGribDataYSize <= 0)
+    if (!m_Grib_Data)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Out of memory.");
+        if (m_Grib_MetaData != nullptr)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Band %d of GRIB dataset is %dx%d.", nBand, nGribDataXSize,
-                     nGribDataYSize);
             MetaFree(m_Grib_MetaData);
             delete m_Grib_MetaData;
             m_Grib_MetaData = nullptr;
-            return CE_Failure;
         }
+        return CE_Failure;
+    }
 
-        poGDS->nCachedBytes += static_cast<GIntBig>(nGribDataXSize) *
-                               nGribDataYSize * sizeof(double);
-        poGDS->poLastUsedBand = this;
+    // Check the band matches the dataset as a whole, size wise. (#3246)
+    nGribDataXSize = m_Grib_MetaData->gds.Nx;
+    nGribDataYSize = m_Grib_MetaData->gds.Ny;
+    if (nGribDataXSize <= 0 || nGribDataYSize <= 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Band %d of GRIB dataset is %dx%d.", nBand, nGribDataXSize,
+                 nGribDataYSize);
+        MetaFree(m_Grib_MetaData);
+        delete m_Grib_MetaData;
+        m_Grib_MetaData = nullptr;
+        return CE_Failure;
+    }
 
-        if (nGribDataXSize != nRasterXSize || nGribDataYSize != nRasterYSize)
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Band %d of GRIB dataset is %dx%d, while the first band "
-                     "and dataset is %dx%d.  Georeferencing of band %d may "
-                     "be incorrect, and data access may be incomplete.",
-                     nBand, nGribDataXSize, nGribDataYSize, nRasterXSize,
-                     nRasterYSize, nBand);
-        }
+    poGDS->nCachedBytes += static_cast<GIntBig>(nGribDataXSize) *
+                           nGribDataYSize * sizeof(double);
+    poGDS->poLastUsedBand = this;
+
+    if (nGribDataXSize != nRasterXSize || nGribDataYSize != nRasterYSize)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Band %d of GRIB dataset is %dx%d, while the first band "
+                 "and dataset is %dx%d.  Georeferencing of band %d may "
+                 "be incorrect, and data access may be incomplete.",
+                 nBand, nGribDataXSize, nGribDataYSize, nRasterXSize,
+                 nRasterYSize, nBand);
     }
 
     return CE_None;
@@ -1295,6 +1312,147 @@ CPLErr GRIBDataset::GetGeoTransform(double *padfTransform)
     return CE_None;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GRIBDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                              int nXSize, int nYSize, void *pData,
+                              int nBufXSize, int nBufYSize,
+                              GDALDataType eBufType, int nBandCount,
+                              int *panBandMap, GSpacing nPixelSpace,
+                              GSpacing nLineSpace, GSpacing nBandSpace,
+                              GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nBandCount > 1)
+        LoadBandsMultiThreaded(nBandCount, panBandMap);
+
+    return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nBandCount, panBandMap, nPixelSpace,
+                                     nLineSpace, nBandSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                       LoadBandsMultiThreaded()                       */
+/************************************************************************/
+
+// Decode concurrently, on the global thread pool, the messages of the
+// requested bands that are not cached yet, so that LoadData() finds them.
+// This is a best effort: bands that are not handled here, or whose
+// decoding emits an error or a warning, are loaded by LoadData() as usual.
+void GRIBDataset::LoadBandsMultiThreaded(int nBandCount, const int *panBandMap)
+{
+    if (bCacheOnlyOneBand)
+        return;
+
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads =
+        std::min(128, EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                       : atoi(pszNumThreads));
+    if (nThreads <= 1)
+        return;
+
+    struct BandJob
+    {
+        const char *pszFilename = nullptr;
+        GRIBRasterBand *poBand = nullptr;
+        double *padfData = nullptr;
+        grib_MetaData *psMetaData = nullptr;
+        bool bOK = false;
+    };
+
+    // Only load bands that fit in the cache, otherwise we would switch
+    // to the "one-band-at-a-time" strategy.
+    const GIntBig nBandBytes =
+        static_cast<GIntBig>(nRasterXSize) * nRasterYSize * sizeof(double);
+    GIntBig nNewCachedBytes = nCachedBytes;
+    std::vector<BandJob> asJobs;
+    std::set<int> oSetBands;
+    for (int i = 0; i < nBandCount; ++i)
+    {
+        auto poBand =
+            cpl::down_cast<GRIBRasterBand *>(GetRasterBand(panBandMap[i]));
+        if (poBand->m_Grib_Data != nullptr ||
+            !oSetBands.insert(panBandMap[i]).second)
+        {
+            continue;
+        }
+        if (nNewCachedBytes + nBandBytes > nCachedBytesThreshold)
+            break;
+        nNewCachedBytes += nBandBytes;
+        BandJob sJob;
+        sJob.pszFilename = GetDescription();
+        sJob.poBand = poBand;
+        asJobs.push_back(sJob);
+    }
+    if (asJobs.size() < 2)
+        return;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (poThreadPool == nullptr)
+        return;
+
+    const auto JobFunc = [](void *pData)
+    {
+        BandJob *psJob = static_cast<BandJob *>(pData);
+        // Each job uses its own file handle, as the dataset one is not
+        // thread-safe.
+        VSILFILE *fp = VSIFOpenL(psJob->pszFilename, "rb");
+        if (fp == nullptr)
+            return;
+        // Errors and warnings are silenced here, and the band is left
+        // for LoadData() to emit them again in the calling thread.
+        CPLPushErrorHandler(CPLQuietErrorHandler);
+        const auto nErrorCounter = CPLGetErrorCounter();
+        GRIBRasterBand::ReadGribData(fp, psJob->poBand->start,
+                                     psJob->poBand->subgNum, &psJob->padfData,
+                                     &psJob->psMetaData);
+        psJob->bOK = psJob->padfData != nullptr &&
+                     psJob->psMetaData != nullptr &&
+                     psJob->psMetaData->gds.Nx > 0 &&
+                     psJob->psMetaData->gds.Ny > 0 &&
+                     CPLGetErrorCounter() == nErrorCounter;
+        CPLPopErrorHandler();
+        VSIFCloseL(fp);
+    };
+
+    CPLDebug("GRIB", "Decoding %d bands with up to %d threads",
+             static_cast<int>(asJobs.size()), nThreads);
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (auto &sJob : asJobs)
+    {
+        if (!poJobQueue->SubmitJob(JobFunc, &sJob))
+            break;
+    }
+    poJobQueue->WaitCompletion();
+
+    for (auto &sJob : asJobs)
+    {
+        GRIBRasterBand *poBand = sJob.poBand;
+        if (sJob.bOK)
+        {
+            if (poBand->m_Grib_MetaData != nullptr)
+            {
+                MetaFree(poBand->m_Grib_MetaData);
+                delete poBand->m_Grib_MetaData;
+            }
+            poBand->m_Grib_Data = sJob.padfData;
+            poBand->m_Grib_MetaData = sJob.psMetaData;
+            CPL_IGNORE_RET_VAL(poBand->CheckLoadedData());
+        }
+        else
+        {
+            free(sJob.padfData);
+            if (sJob.psMetaData != nullptr)
+            {
+                MetaFree(sJob.psMetaData);
+                delete sJob.psMetaData;
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                            Identify()                                */
 /************************************************************************/
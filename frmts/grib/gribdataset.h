@@ -110,8 +110,16 @@ class GRIBDataset final : public GDALPamDataset
         return m_poRootGroup;
     }
 
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount, int *panBandMap,
+                     GSpacing nPixelSpace, GSpacing nLineSpace,
+                     GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
   private:
     void SetGribMetaData(grib_MetaData *meta);
+    void LoadBandsMultiThreaded(int nBandCount, const int *panBandMap);
     static GDALDataset *OpenMultiDim(GDALOpenInfo *);
     static std::unique_ptr<gdal::grib::InventoryWrapper>
     Inventory(VSILFILE *, GDALOpenInfo *);
@@ -167,6 +175,7 @@ class GRIBRasterBand final : public GDALPamRasterBand
 
   private:
     CPLErr LoadData();
+    CPLErr CheckLoadedData();
     void FindNoDataGrib2(bool bSeekToStart = true);
     void FindMetaData();
     // Heuristic search for the start of the message
@@ -47,7 +47,9 @@
 #include <setjmp.h>
 
 #include <algorithm>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "gdalorienteddataset.h"
 
@@ -60,10 +62,12 @@
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gdalexif.h"
 CPL_C_START
 #ifdef LIBJPEG_12_PATH
@@ -2536,6 +2540,411 @@ const GDAL_GCP *JPGDatasetCommon::GetGCPs()
     return pasGCPList;
 }
 
+/************************************************************************/
+/*                         BuildRestartIndex()                          */
+/************************************************************************/
+
+// Parse the header of a baseline or extended sequential single-scan JPEG
+// stream with restart markers, and record the offsets of the entropy-coded
+// data of groups of restart intervals that start at a MCU row boundary.
+// Each such group can be decoded independently, as a standalone JPEG stream
+// made of the original header (with a patched image height), the group data
+// and an EOI marker.
+bool JPGDatasetCommon::BuildRestartIndex()
+{
+    if (m_bHasBuiltRestartIndex)
+        return !m_anRestartGroupOffsets.empty();
+    m_bHasBuiltRestartIndex = true;
+
+    VSILFILE *fp = VSIFOpenL(GetDescription(), "rb");
+    if (fp == nullptr)
+        return false;
+
+    std::vector<GByte> abyHeader;
+    size_t nHeightPos = 0;
+    int nWidth = 0;
+    int nHeight = 0;
+    int nComponents = 0;
+    int nMaxH = 1;
+    int nMaxV = 1;
+    int nRestartInterval = 0;
+    bool bOK = false;
+    GByte abyMarker[4] = {0, 0, 0, 0};
+    if (VSIFReadL(abyMarker, 2, 1, fp) == 1 && abyMarker[0] == 0xFF &&
+        abyMarker[1] == 0xD8)
+    {
+        abyHeader.insert(abyHeader.end(), abyMarker, abyMarker + 2);
+        while (VSIFReadL(abyMarker, 4, 1, fp) == 1 && abyMarker[0] == 0xFF)
+        {
+            const int nMarker = abyMarker[1];
+            const int nLength = abyMarker[2] * 256 + abyMarker[3];
+            if (nLength < 2)
+                break;
+            // Drop APPn segments other than JFIF and Adobe ones, as well as
+            // comments, as they do not affect decoding.
+            if ((nMarker >= 0xE1 && nMarker <= 0xEF && nMarker != 0xEE) ||
+                nMarker == 0xFE)
+            {
+                if (VSIFSeekL(fp, VSIFTellL(fp) + nLength - 2, SEEK_SET) != 0)
+                    break;
+                continue;
+            }
+            const size_t nSegmentStart = abyHeader.size();
+            abyHeader.insert(abyHeader.end(), abyMarker, abyMarker + 4);
+            abyHeader.resize(nSegmentStart + 2 + nLength);
+            const GByte *pabyPayload = abyHeader.data() + nSegmentStart + 4;
+            if (VSIFReadL(abyHeader.data() + nSegmentStart + 4, nLength - 2, 1,
+                          fp) != 1)
+                break;
+            if (nMarker == 0xC0 || nMarker == 0xC1)
+            {
+                // Only 8-bit samples are handled by JPGDataset::Open()
+                if (nComponents != 0 || nLength < 8 || pabyPayload[0] != 8)
+                    break;
+                nHeightPos = nSegmentStart + 5;
+                nHeight = pabyPayload[1] * 256 + pabyPayload[2];
+                nWidth = pabyPayload[3] * 256 + pabyPayload[4];
+                nComponents = pabyPayload[5];
+                if (nComponents == 0 || nLength != 8 + 3 * nComponents)
+                    break;
+                for (int i = 0; i < nComponents; ++i)
+                {
+                    nMaxH = std::max(nMaxH, pabyPayload[7 + 3 * i] >> 4);
+                    nMaxV = std::max(nMaxV, pabyPayload[7 + 3 * i] & 0xF);
+                }
+            }
+            else if ((nMarker >= 0xC2 && nMarker <= 0xCF && nMarker != 0xC4 &&
+                      nMarker != 0xC8 && nMarker != 0xCC))
+            {
+                // Progressive, lossless, hierarchical or arithmetic coding
+                break;
+            }
+            else if (nMarker == 0xDD)
+            {
+                if (nLength != 4)
+                    break;
+                nRestartInterval = pabyPayload[0] * 256 + pabyPayload[1];
+            }
+            else if (nMarker == 0xDA)
+            {
+                // Only a single scan with all components is supported
+                bOK = nComponents > 0 && pabyPayload[0] == nComponents &&
+                      nWidth > 0 && nHeight > 0 && nRestartInterval > 0;
+                break;
+            }
+        }
+    }
+    if (!bOK)
+    {
+        VSIFCloseL(fp);
+        return false;
+    }
+
+    // With vertical chroma subsampling, libjpeg fancy upsampling blends
+    // chroma rows across group boundaries, so decoding groups independently
+    // would not give the same result.
+    if (nComponents > 1 && nMaxV > 1)
+    {
+        VSIFCloseL(fp);
+        return false;
+    }
+
+    // Number of MCU rows in a group, such that a group is made of a whole
+    // number of restart intervals.
+    const int nMCUWidth = (nComponents == 1) ? 8 : 8 * nMaxH;
+    const int nMCUHeight = 8;
+    const GUIntBig nMCUsPerRow = DIV_ROUND_UP(nWidth, nMCUWidth);
+    const GUIntBig nMCURows = DIV_ROUND_UP(nHeight, nMCUHeight);
+    GUIntBig nGCD = nMCUsPerRow;
+    for (GUIntBig nOther = nRestartInterval; nOther != 0;)
+    {
+        const GUIntBig nTmp = nGCD % nOther;
+        nGCD = nOther;
+        nOther = nTmp;
+    }
+    const GUIntBig nGroupMCURows = nRestartInterval / nGCD;
+    const GUIntBig nIntervalsPerGroup = nMCUsPerRow / nGCD;
+    const GUIntBig nIntervals =
+        DIV_ROUND_UP(nMCUsPerRow * nMCURows, nRestartInterval);
+    if (2 * nGroupMCURows > nMCURows)
+    {
+        VSIFCloseL(fp);
+        return false;
+    }
+
+    // Scan the entropy-coded data for restart markers.
+    std::vector<vsi_l_offset> anGroupOffsets;
+    anGroupOffsets.push_back(VSIFTellL(fp));
+    std::vector<GByte> abyBuffer(1024 * 1024);
+    vsi_l_offset nBufferOffset = anGroupOffsets[0];
+    GUIntBig nRestartMarkers = 0;
+    bool bPrevIsFF = false;
+    bool bEOI = false;
+    bOK = true;
+    while (bOK && !bEOI)
+    {
+        const size_t nRead =
+            VSIFReadL(abyBuffer.data(), 1, abyBuffer.size(), fp);
+        if (nRead == 0)
+            break;
+        size_t i = 0;
+        while (i < nRead)
+        {
+            if (!bPrevIsFF)
+            {
+                const void *pFF =
+                    memchr(abyBuffer.data() + i, 0xFF, nRead - i);
+                if (pFF == nullptr)
+                    break;
+                i = static_cast<const GByte *>(pFF) - abyBuffer.data() + 1;
+                bPrevIsFF = true;
+                continue;
+            }
+            const GByte byVal = abyBuffer[i];
+            if (byVal >= 0xD0 && byVal <= 0xD7)
+            {
+                if (byVal - 0xD0 != static_cast<int>(nRestartMarkers % 8))
+                {
+                    bOK = false;
+                    break;
+                }
+                ++nRestartMarkers;
+                if ((nRestartMarkers % nIntervalsPerGroup) == 0)
+                    anGroupOffsets.push_back(nBufferOffset + i + 1);
+            }
+            else if (byVal == 0xD9)
+            {
+                anGroupOffsets.push_back(nBufferOffset + i - 1);
+                bEOI = true;
+                break;
+            }
+            else if (byVal != 0x00 && byVal != 0xFF)
+            {
+                // Unexpected marker
+                bOK = false;
+                break;
+            }
+            bPrevIsFF = (byVal == 0xFF);
+            ++i;
+        }
+        nBufferOffset += nRead;
+    }
+    VSIFCloseL(fp);
+
+    // The end of the last group must be the EOI marker, not a restart marker.
+    if (!bOK || !bEOI || nRestartMarkers + 1 != nIntervals ||
+        anGroupOffsets.size() !=
+            2 + (nIntervals - 1) / nIntervalsPerGroup)
+    {
+        return false;
+    }
+
+    m_abyRestartHeader = std::move(abyHeader);
+    m_nRestartHeaderHeightPos = nHeightPos;
+    m_nRestartGroupHeight = static_cast<int>(nGroupMCURows) * nMCUHeight;
+    m_anRestartGroupOffsets = std::move(anGroupOffsets);
+    return true;
+}
+
+/************************************************************************/
+/*                   ReadRestartGroupsMultiThreaded()                   */
+/************************************************************************/
+
+// Decode concurrently, on the global thread pool, the groups of restart
+// intervals intersecting the requested window. Returns false if this is
+// not possible, or if any error or warning is emitted, in which case the
+// regular code path must be used.
+bool JPGDatasetCommon::ReadRestartGroupsMultiThreaded(
+    int nThreads, int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+    GDALDataType eBufType, int nBandCount, int *panBandMap,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace)
+{
+    if (!BuildRestartIndex())
+        return false;
+
+    const int nGroups = static_cast<int>(m_anRestartGroupOffsets.size()) - 1;
+    const int nFirstGroup = nYOff / m_nRestartGroupHeight;
+    const int nEndGroup =
+        std::min(nGroups, DIV_ROUND_UP(nYOff + nYSize, m_nRestartGroupHeight));
+    if (nEndGroup - nFirstGroup < 2)
+        return false;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (poThreadPool == nullptr)
+        return false;
+
+    struct ChunkJob
+    {
+        JPGDatasetCommon *poDS = nullptr;
+        int nFirstGroup = 0;
+        int nEndGroup = 0;
+        int nXOff = 0;
+        int nYOff = 0;
+        int nXSize = 0;
+        int nYSize = 0;
+        GByte *pabyData = nullptr;
+        GDALDataType eBufType = GDT_Byte;
+        int nBandCount = 0;
+        int *panBandMap = nullptr;
+        GSpacing nPixelSpace = 0;
+        GSpacing nLineSpace = 0;
+        GSpacing nBandSpace = 0;
+        bool bOK = false;
+    };
+
+    // Two chunks per thread, to balance the load.
+    const int nChunks = std::min(nEndGroup - nFirstGroup, 2 * nThreads);
+    std::vector<ChunkJob> asJobs(nChunks);
+    for (int i = 0; i < nChunks; ++i)
+    {
+        ChunkJob &sJob = asJobs[i];
+        sJob.poDS = this;
+        sJob.nFirstGroup =
+            nFirstGroup +
+            static_cast<int>(static_cast<GIntBig>(nEndGroup - nFirstGroup) *
+                             i / nChunks);
+        sJob.nEndGroup =
+            nFirstGroup +
+            static_cast<int>(static_cast<GIntBig>(nEndGroup - nFirstGroup) *
+                             (i + 1) / nChunks);
+        sJob.nXOff = nXOff;
+        sJob.nYOff = nYOff;
+        sJob.nXSize = nXSize;
+        sJob.nYSize = nYSize;
+        sJob.pabyData = static_cast<GByte *>(pData);
+        sJob.eBufType = eBufType;
+        sJob.nBandCount = nBandCount;
+        sJob.panBandMap = panBandMap;
+        sJob.nPixelSpace = nPixelSpace;
+        sJob.nLineSpace = nLineSpace;
+        sJob.nBandSpace = nBandSpace;
+    }
+
+    const auto JobFunc = [](void *pJobData)
+    {
+        ChunkJob *psJob = static_cast<ChunkJob *>(pJobData);
+        const JPGDatasetCommon *poDS = psJob->poDS;
+        const auto &anOffsets = poDS->m_anRestartGroupOffsets;
+        const int nGroups = static_cast<int>(anOffsets.size()) - 1;
+
+        // Rows of the chunk, and of the requested window within it.
+        const int nChunkYOff = psJob->nFirstGroup * poDS->m_nRestartGroupHeight;
+        const int nChunkHeight =
+            std::min(poDS->nRasterYSize,
+                     psJob->nEndGroup * poDS->m_nRestartGroupHeight) -
+            nChunkYOff;
+        const int nReqYOff = std::max(psJob->nYOff, nChunkYOff);
+        const int nReqYEnd = std::min(psJob->nYOff + psJob->nYSize,
+                                      nChunkYOff + nChunkHeight);
+
+        // Entropy-coded data, excluding the restart marker that follows it.
+        const vsi_l_offset nDataStart = anOffsets[psJob->nFirstGroup];
+        const vsi_l_offset nDataEnd = (psJob->nEndGroup < nGroups)
+                                          ? anOffsets[psJob->nEndGroup] - 2
+                                          : anOffsets[nGroups];
+        const vsi_l_offset nDataSize = nDataEnd - nDataStart;
+        const size_t nHeaderSize = poDS->m_abyRestartHeader.size();
+        if (nDataSize > std::numeric_limits<size_t>::max() - nHeaderSize - 2)
+            return;
+
+        // Errors and warnings are silenced here, and the whole request is
+        // processed again by the regular code path to emit them.
+        CPLPushErrorHandler(CPLQuietErrorHandler);
+        const auto nErrorCounter = CPLGetErrorCounter();
+
+        GByte *pabyStream = static_cast<GByte *>(VSI_MALLOC_VERBOSE(
+            nHeaderSize + static_cast<size_t>(nDataSize) + 2));
+        VSILFILE *fp = pabyStream ? VSIFOpenL(poDS->GetDescription(), "rb")
+                                  : nullptr;
+        bool bOK = fp != nullptr && VSIFSeekL(fp, nDataStart, SEEK_SET) == 0 &&
+                   VSIFReadL(pabyStream + nHeaderSize, 1,
+                             static_cast<size_t>(nDataSize),
+                             fp) == static_cast<size_t>(nDataSize);
+        if (fp)
+            VSIFCloseL(fp);
+        if (bOK)
+        {
+            memcpy(pabyStream, poDS->m_abyRestartHeader.data(), nHeaderSize);
+            pabyStream[poDS->m_nRestartHeaderHeightPos] =
+                static_cast<GByte>(nChunkHeight >> 8);
+            pabyStream[poDS->m_nRestartHeaderHeightPos + 1] =
+                static_cast<GByte>(nChunkHeight & 0xFF);
+
+            // Renumber restart markers so that the first one is RST0.
+            GByte *pabyData = pabyStream + nHeaderSize;
+            const size_t nSize = static_cast<size_t>(nDataSize);
+            int nRestartMarkers = 0;
+            for (size_t i = 0; i + 1 < nSize; ++i)
+            {
+                if (pabyData[i] == 0xFF && pabyData[i + 1] >= 0xD0 &&
+                    pabyData[i + 1] <= 0xD7)
+                {
+                    pabyData[i + 1] =
+                        static_cast<GByte>(0xD0 + (nRestartMarkers % 8));
+                    ++nRestartMarkers;
+                    ++i;
+                }
+            }
+            pabyData[nSize] = 0xFF;
+            pabyData[nSize + 1] = 0xD9;
+
+            const CPLString osTmpFilename(
+                CPLSPrintf("/vsimem/jpeg_restart_%p.jpg", psJob));
+            VSIFCloseL(VSIFileFromMemBuffer(osTmpFilename, pabyStream,
+                                            nSize + nHeaderSize + 2, TRUE));
+            pabyStream = nullptr;
+
+            // Do not recurse into the multi-threaded path from the chunk.
+            CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", "1", false);
+            JPGDatasetOpenArgs sArgs;
+            sArgs.pszFilename = osTmpFilename.c_str();
+            sArgs.fpLin = nullptr;
+            sArgs.papszSiblingFiles = nullptr;
+            sArgs.nScaleFactor = 1;
+            sArgs.bDoPAMInitialize = false;
+            sArgs.bUseInternalOverviews = false;
+            sArgs.bIsLossless = false;
+            std::unique_ptr<GDALDataset> poChunkDS(JPGDataset::Open(&sArgs));
+            bOK = poChunkDS != nullptr &&
+                  poChunkDS->GetRasterXSize() == poDS->nRasterXSize &&
+                  poChunkDS->GetRasterYSize() == nChunkHeight &&
+                  poChunkDS->GetRasterCount() == poDS->nBands &&
+                  poChunkDS->RasterIO(
+                      GF_Read, psJob->nXOff, nReqYOff - nChunkYOff,
+                      psJob->nXSize, nReqYEnd - nReqYOff,
+                      psJob->pabyData +
+                          (nReqYOff - psJob->nYOff) * psJob->nLineSpace,
+                      psJob->nXSize, nReqYEnd - nReqYOff, psJob->eBufType,
+                      psJob->nBandCount, psJob->panBandMap,
+                      psJob->nPixelSpace, psJob->nLineSpace,
+                      psJob->nBandSpace, nullptr) == CE_None;
+            poChunkDS.reset();
+            VSIUnlink(osTmpFilename);
+        }
+        VSIFree(pabyStream);
+
+        psJob->bOK = bOK && CPLGetErrorCounter() == nErrorCounter;
+        CPLPopErrorHandler();
+    };
+
+    CPLDebug("JPEG", "Decoding %d groups of MCU rows in %d chunks",
+             nEndGroup - nFirstGroup, nChunks);
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (auto &sJob : asJobs)
+    {
+        if (!poJobQueue->SubmitJob(JobFunc, &sJob))
+            return false;
+    }
+    poJobQueue->WaitCompletion();
+
+    for (const auto &sJob : asJobs)
+    {
+        if (!sJob.bOK)
+            return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /*                                                                      */
@@ -2559,6 +2968,23 @@ CPLErr JPGDatasetCommon::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         return CE_Failure;
     }
 
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize &&
+        nScaleFactor == 1 && !bIsSubfile && pData != nullptr)
+    {
+        const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        const int nThreads =
+            std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                              ? CPLGetNumCPUs()
+                              : atoi(pszNumThreads));
+        if (nThreads > 1 &&
+            ReadRestartGroupsMultiThreaded(
+                nThreads, nXOff, nYOff, nXSize, nYSize, pData, eBufType,
+                nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace))
+        {
+            return CE_None;
+        }
+    }
+
 #ifndef JPEG_LIB_MK1
     if ((eRWFlag == GF_Read) && (nBandCount == 3) && (nBands == 3) &&
         (nXOff == 0) && (nYOff == 0) && (nXSize == nBufXSize) &&
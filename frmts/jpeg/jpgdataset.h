@@ -241,6 +241,21 @@ class JPGDatasetCommon CPL_NON_FINAL : public GDALPamDataset
 
     bool bIsSubfile;
     bool bHasTriedLoadWorldFileOrTab;
+
+    // Index of groups of MCU rows delimited by restart markers, that can
+    // be decoded independently.
+    bool m_bHasBuiltRestartIndex = false;
+    std::vector<GByte> m_abyRestartHeader{};
+    size_t m_nRestartHeaderHeightPos = 0;
+    int m_nRestartGroupHeight = 0;
+    std::vector<vsi_l_offset> m_anRestartGroupOffsets{};
+    bool BuildRestartIndex();
+    bool ReadRestartGroupsMultiThreaded(int nThreads, int nXOff, int nYOff,
+                                        int nXSize, int nYSize, void *pData,
+                                        GDALDataType eBufType, int nBandCount,
+                                        int *panBandMap, GSpacing nPixelSpace,
+                                        GSpacing nLineSpace,
+                                        GSpacing nBandSpace);
     void LoadWorldFileOrTab();
     CPLString osWldFilename;
 
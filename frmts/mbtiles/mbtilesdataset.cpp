@@ -135,6 +135,14 @@ class MBTilesDataset final : public GDALPamDataset,
                                    void *pProgressData,
                                    CSLConstList papszOptions) override;
 
+    virtual CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                             int nXSize, int nYSize, void *pData, int nBufXSize,
+                             int nBufYSize, GDALDataType eBufType,
+                             int nBandCount, int *panBandMap,
+                             GSpacing nPixelSpace, GSpacing nLineSpace,
+                             GSpacing nBandSpace,
+                             GDALRasterIOExtraArg *psExtraArg) override;
+
     virtual int GetLayerCount() override
     {
         return static_cast<int>(m_apoLayers.size());
@@ -1017,6 +1025,31 @@ CPLErr MBTilesDataset::IFlushCacheWithErrCode(bool bAtClosing)
     return eErr;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr MBTilesDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                 int nXSize, int nYSize, void *pData,
+                                 int nBufXSize, int nBufYSize,
+                                 GDALDataType eBufType, int nBandCount,
+                                 int *panBandMap, GSpacing nPixelSpace,
+                                 GSpacing nLineSpace, GSpacing nBandSpace,
+                                 GDALRasterIOExtraArg *psExtraArg)
+
+{
+    if (eRWFlag == GF_Read)
+    {
+        PreloadTilesMultiThreaded(nXOff, nYOff, nXSize, nYSize, nBufXSize,
+                                  nBufYSize);
+    }
+
+    return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nBandCount, panBandMap, nPixelSpace,
+                                     nLineSpace, nBandSpace, psExtraArg);
+}
+
 /************************************************************************/
 /*                         ICanIWriteBlock()                            */
 /************************************************************************/
@@ -1231,7 +1231,7 @@ double netCDFRasterBand::GetOffset(int *pbSuccess)
 /************************************************************************/
 CPLErr netCDFRasterBand::SetOffset(double dfNewOffset)
 {
-    CPLMutexHolderD(&hNCMutex);
+    CPLMutexHolderD(static_cast<netCDFDataset *>(poDS)->GetMutex());
 
     // Write value if in update mode.
     if (poDS->GetAccess() == GA_Update)
@@ -1281,7 +1281,7 @@ double netCDFRasterBand::GetScale(int *pbSuccess)
 /************************************************************************/
 CPLErr netCDFRasterBand::SetScale(double dfNewScale)
 {
-    CPLMutexHolderD(&hNCMutex);
+    CPLMutexHolderD(static_cast<netCDFDataset *>(poDS)->GetMutex());
 
     // Write value if in update mode.
     if (poDS->GetAccess() == GA_Update)
@@ -1335,7 +1335,7 @@ const char *netCDFRasterBand::GetUnitType()
 CPLErr netCDFRasterBand::SetUnitType(const char *pszNewValue)
 
 {
-    CPLMutexHolderD(&hNCMutex);
+    CPLMutexHolderD(static_cast<netCDFDataset *>(poDS)->GetMutex());
 
     const std::string osUnitType = (pszNewValue != nullptr ? pszNewValue : "");
 
@@ -1449,7 +1449,7 @@ uint64_t netCDFRasterBand::GetNoDataValueAsUInt64(int *pbSuccess)
 CPLErr netCDFRasterBand::SetNoDataValue(double dfNoData)
 
 {
-    CPLMutexHolderD(&hNCMutex);
+    CPLMutexHolderD(static_cast<netCDFDataset *>(poDS)->GetMutex());
 
     // If already set to new value, don't do anything.
     if (m_bNoDataSet && CPLIsEqual(dfNoData, m_dfNoDataValue))
@@ -1575,7 +1575,7 @@ void netCDFRasterBand::SetNoDataValueNoUpdate(double dfNoData)
 CPLErr netCDFRasterBand::SetNoDataValueAsInt64(int64_t nNoData)
 
 {
-    CPLMutexHolderD(&hNCMutex);
+    CPLMutexHolderD(static_cast<netCDFDataset *>(poDS)->GetMutex());
 
     // If already set to new value, don't do anything.
     if (m_bNoDataSetAsInt64 && nNoData == m_nNodataValueInt64)
@@ -1661,7 +1661,7 @@ void netCDFRasterBand::SetNoDataValueNoUpdate(int64_t nNoData)
 CPLErr netCDFRasterBand::SetNoDataValueAsUInt64(uint64_t nNoData)
 
 {
-    CPLMutexHolderD(&hNCMutex);
+    CPLMutexHolderD(static_cast<netCDFDataset *>(poDS)->GetMutex());
 
     // If already set to new value, don't do anything.
     if (m_bNoDataSetAsUInt64 && nNoData == m_nNodataValueUInt64)
@@ -1748,7 +1748,7 @@ void netCDFRasterBand::SetNoDataValueNoUpdate(uint64_t nNoData)
 CPLErr netCDFRasterBand::DeleteNoDataValue()
 
 {
-    CPLMutexHolderD(&hNCMutex);
+    CPLMutexHolderD(static_cast<netCDFDataset *>(poDS)->GetMutex());
 
     if (!bNoDataSet)
         return CE_None;
@@ -2304,8 +2304,17 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
              edge[nBandXPos], nYChunkSize, ((netCDFDataset *)poDS)->bBottomUp);
 #endif
 
+    auto poGDS = static_cast<netCDFDataset *>(poDS);
+
+    // Only the libnetcdf calls are done under the lock. Post-processing of
+    // the decoded values (nodata, valid range, longitude wrapping) and row
+    // re-arrangement are done once it has been released, so that other
+    // threads can read meanwhile.
     int nd = 0;
-    nc_inq_varndims(cdfid, nZId, &nd);
+    {
+        CPLMutexHolderD(poGDS->GetMutex());
+        nc_inq_varndims(cdfid, nZId, &nd);
+    }
     if (nd == 3)
     {
         start[panBandZPos[0]] = nLevel;  // z
@@ -2345,9 +2354,6 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
         }
     }
 
-    // Make sure we are in data mode.
-    static_cast<netCDFDataset *>(poDS)->SetDefineMode(false);
-
     // If this block is not a full block in the x axis, we need to
     // re-arrange the data because partial blocks are not arranged the
     // same way in netcdf and gdal, so we first we read the netcdf data at
@@ -2363,157 +2369,158 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
 
     // Read data according to type.
     int status;
-    if (eDataType == GDT_Byte)
     {
-        if (bSignedData)
+        CPLMutexHolderD(poGDS->GetMutex());
+
+        // Make sure we are in data mode.
+        poGDS->SetDefineMode(false);
+
+        if (eDataType == GDT_Byte)
+        {
+            if (bSignedData)
+            {
+                status =
+                    nc_get_vara_schar(cdfid, nZId, start, edge,
+                                      static_cast<signed char *>(pImageNC));
+            }
+            else
+            {
+                status =
+                    nc_get_vara_uchar(cdfid, nZId, start, edge,
+                                      static_cast<unsigned char *>(pImageNC));
+            }
+        }
+        else if (eDataType == GDT_Int8)
         {
             status = nc_get_vara_schar(cdfid, nZId, start, edge,
                                        static_cast<signed char *>(pImageNC));
-            if (status == NC_NOERR)
-                CheckData<signed char>(pImage, pImageNC, edge[nBandXPos],
-                                       nYChunkSize, false);
         }
-        else
+        else if (nc_datatype == NC_SHORT)
         {
-            status = nc_get_vara_uchar(cdfid, nZId, start, edge,
-                                       static_cast<unsigned char *>(pImageNC));
-            if (status == NC_NOERR)
-                CheckData<unsigned char>(pImage, pImageNC, edge[nBandXPos],
-                                         nYChunkSize, false);
+            status = nc_get_vara_short(cdfid, nZId, start, edge,
+                                       static_cast<short *>(pImageNC));
         }
+        else if (eDataType == GDT_Int32)
+        {
+#if SIZEOF_UNSIGNED_LONG == 4
+            status = nc_get_vara_long(cdfid, nZId, start, edge,
+                                      static_cast<long *>(pImageNC));
+#else
+            status = nc_get_vara_int(cdfid, nZId, start, edge,
+                                     static_cast<int *>(pImageNC));
+#endif
+        }
+        else if (eDataType == GDT_Float32)
+        {
+            status = nc_get_vara_float(cdfid, nZId, start, edge,
+                                       static_cast<float *>(pImageNC));
+        }
+        else if (eDataType == GDT_Float64)
+        {
+            status = nc_get_vara_double(cdfid, nZId, start, edge,
+                                        static_cast<double *>(pImageNC));
+        }
+#ifdef NETCDF_HAS_NC4
+        else if (eDataType == GDT_UInt16)
+        {
+            status =
+                nc_get_vara_ushort(cdfid, nZId, start, edge,
+                                   static_cast<unsigned short *>(pImageNC));
+        }
+        else if (eDataType == GDT_UInt32)
+        {
+            status = nc_get_vara_uint(cdfid, nZId, start, edge,
+                                      static_cast<unsigned int *>(pImageNC));
+        }
+        else if (eDataType == GDT_Int64)
+        {
+            status = nc_get_vara_longlong(cdfid, nZId, start, edge,
+                                          static_cast<long long *>(pImageNC));
+        }
+        else if (eDataType == GDT_UInt64)
+        {
+            status = nc_get_vara_ulonglong(
+                cdfid, nZId, start, edge,
+                static_cast<unsigned long long *>(pImageNC));
+        }
+        else if (eDataType == GDT_CInt16 || eDataType == GDT_CInt32 ||
+                 eDataType == GDT_CFloat32 || eDataType == GDT_CFloat64)
+        {
+            status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
+        }
+#endif
+        else
+            status = NC_EBADTYPE;
+    }
+
+    if (status != NC_NOERR)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "netCDF chunk fetch failed: #%d (%s)", status,
+                 nc_strerror(status));
+        return false;
+    }
+
+    const size_t nXChunkSize = edge[nBandXPos];
+    if (eDataType == GDT_Byte)
+    {
+        if (bSignedData)
+            CheckData<signed char>(pImage, pImageNC, nXChunkSize, nYChunkSize,
+                                   false);
+        else
+            CheckData<unsigned char>(pImage, pImageNC, nXChunkSize,
+                                     nYChunkSize, false);
     }
     else if (eDataType == GDT_Int8)
     {
-        status = nc_get_vara_schar(cdfid, nZId, start, edge,
-                                   static_cast<signed char *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<signed char>(pImage, pImageNC, edge[nBandXPos],
-                                   nYChunkSize, false);
+        CheckData<signed char>(pImage, pImageNC, nXChunkSize, nYChunkSize,
+                               false);
     }
     else if (nc_datatype == NC_SHORT)
     {
-        status = nc_get_vara_short(cdfid, nZId, start, edge,
-                                   static_cast<short *>(pImageNC));
-        if (status == NC_NOERR)
-        {
-            if (eDataType == GDT_Int16)
-            {
-                CheckData<GInt16>(pImage, pImageNC, edge[nBandXPos],
-                                  nYChunkSize, false);
-            }
-            else
-            {
-                CheckData<GUInt16>(pImage, pImageNC, edge[nBandXPos],
-                                   nYChunkSize, false);
-            }
-        }
+        if (eDataType == GDT_Int16)
+            CheckData<GInt16>(pImage, pImageNC, nXChunkSize, nYChunkSize,
+                              false);
+        else
+            CheckData<GUInt16>(pImage, pImageNC, nXChunkSize, nYChunkSize,
+                               false);
     }
     else if (eDataType == GDT_Int32)
     {
 #if SIZEOF_UNSIGNED_LONG == 4
-        status = nc_get_vara_long(cdfid, nZId, start, edge,
-                                  static_cast<long *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<long>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                            false);
+        CheckData<long>(pImage, pImageNC, nXChunkSize, nYChunkSize, false);
 #else
-        status = nc_get_vara_int(cdfid, nZId, start, edge,
-                                 static_cast<int *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<int>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                           false);
+        CheckData<int>(pImage, pImageNC, nXChunkSize, nYChunkSize, false);
 #endif
     }
     else if (eDataType == GDT_Float32)
-    {
-        status = nc_get_vara_float(cdfid, nZId, start, edge,
-                                   static_cast<float *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<float>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                             true);
-    }
+        CheckData<float>(pImage, pImageNC, nXChunkSize, nYChunkSize, true);
     else if (eDataType == GDT_Float64)
-    {
-        status = nc_get_vara_double(cdfid, nZId, start, edge,
-                                    static_cast<double *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<double>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                              true);
-    }
+        CheckData<double>(pImage, pImageNC, nXChunkSize, nYChunkSize, true);
 #ifdef NETCDF_HAS_NC4
     else if (eDataType == GDT_UInt16)
-    {
-        status = nc_get_vara_ushort(cdfid, nZId, start, edge,
-                                    static_cast<unsigned short *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<unsigned short>(pImage, pImageNC, edge[nBandXPos],
-                                      nYChunkSize, false);
-    }
+        CheckData<unsigned short>(pImage, pImageNC, nXChunkSize, nYChunkSize,
+                                  false);
     else if (eDataType == GDT_UInt32)
-    {
-        status = nc_get_vara_uint(cdfid, nZId, start, edge,
-                                  static_cast<unsigned int *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<unsigned int>(pImage, pImageNC, edge[nBandXPos],
-                                    nYChunkSize, false);
-    }
+        CheckData<unsigned int>(pImage, pImageNC, nXChunkSize, nYChunkSize,
+                                false);
     else if (eDataType == GDT_Int64)
-    {
-        status = nc_get_vara_longlong(cdfid, nZId, start, edge,
-                                      static_cast<long long *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<std::int64_t>(pImage, pImageNC, edge[nBandXPos],
-                                    nYChunkSize, false);
-    }
+        CheckData<std::int64_t>(pImage, pImageNC, nXChunkSize, nYChunkSize,
+                                false);
     else if (eDataType == GDT_UInt64)
-    {
-        status =
-            nc_get_vara_ulonglong(cdfid, nZId, start, edge,
-                                  static_cast<unsigned long long *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<std::uint64_t>(pImage, pImageNC, edge[nBandXPos],
-                                     nYChunkSize, false);
-    }
+        CheckData<std::uint64_t>(pImage, pImageNC, nXChunkSize, nYChunkSize,
+                                 false);
     else if (eDataType == GDT_CInt16)
-    {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
-        if (status == NC_NOERR)
-            CheckDataCpx<short>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                                false);
-    }
+        CheckDataCpx<short>(pImage, pImageNC, nXChunkSize, nYChunkSize, false);
     else if (eDataType == GDT_CInt32)
-    {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
-        if (status == NC_NOERR)
-            CheckDataCpx<int>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                              false);
-    }
+        CheckDataCpx<int>(pImage, pImageNC, nXChunkSize, nYChunkSize, false);
     else if (eDataType == GDT_CFloat32)
-    {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
-        if (status == NC_NOERR)
-            CheckDataCpx<float>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                                false);
-    }
+        CheckDataCpx<float>(pImage, pImageNC, nXChunkSize, nYChunkSize, false);
     else if (eDataType == GDT_CFloat64)
-    {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
-        if (status == NC_NOERR)
-            CheckDataCpx<double>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                                 false);
-    }
-
+        CheckDataCpx<double>(pImage, pImageNC, nXChunkSize, nYChunkSize,
+                             false);
 #endif
-    else
-        status = NC_EBADTYPE;
 
-    if (status != NC_NOERR)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "netCDF chunk fetch failed: #%d (%s)", status,
-                 nc_strerror(status));
-        return false;
-    }
     return true;
 }
 
@@ -2525,8 +2532,6 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                                     void *pImage)
 
 {
-    CPLMutexHolderD(&hNCMutex);
-
     // Locate X, Y and Z position in the array.
 
     size_t xstart = nBlockXOff * nBlockXSize;
@@ -2641,7 +2646,7 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
 CPLErr netCDFRasterBand::IWriteBlock(CPL_UNUSED int nBlockXOff, int nBlockYOff,
                                      void *pImage)
 {
-    CPLMutexHolderD(&hNCMutex);
+    CPLMutexHolderD(static_cast<netCDFDataset *>(poDS)->GetMutex());
 
 #ifdef NCDF_DEBUG
     if (nBlockYOff == 0 || (nBlockYOff == nRasterYSize - 1))
@@ -2854,6 +2859,9 @@ netCDFDataset::netCDFDataset()
 {
     m_oSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
 
+    m_bPerDatasetLock = CPLTestBool(
+        CPLGetConfigOption("GDAL_NETCDF_THREAD_SAFE_LIBRARY", "NO"));
+
     // Projection/GT.
     m_adfGeoTransform[0] = 0.0;
     m_adfGeoTransform[1] = 1.0;
@@ -2875,6 +2883,23 @@ netCDFDataset::~netCDFDataset()
 
 {
     netCDFDataset::Close();
+
+    if (m_hMutex)
+        CPLDestroyMutex(m_hMutex);
+}
+
+/************************************************************************/
+/*                              GetMutex()                              */
+/************************************************************************/
+
+// Returns the mutex to hold while calling into libnetcdf on behalf of this
+// dataset. libnetcdf offers no way of querying whether it (and the HDF5
+// library below it) has been built thread-safe, hence the per-dataset lock
+// is opt-in. Opening, creating and closing datasets always use hNCMutex, as
+// they also touch the process-wide map of shared netCDF handles.
+CPLMutex **netCDFDataset::GetMutex()
+{
+    return m_bPerDatasetLock ? &m_hMutex : &hNCMutex;
 }
 
 /************************************************************************/
@@ -5179,7 +5204,7 @@ void netCDFDataset::SetSpatialRefNoUpdate(const OGRSpatialReference *poSRS)
 
 CPLErr netCDFDataset::SetSpatialRef(const OGRSpatialReference *poSRS)
 {
-    CPLMutexHolderD(&hNCMutex);
+    CPLMutexHolderD(GetMutex());
 
     if (GetAccess() != GA_Update || m_bHasProjection)
     {
@@ -5222,7 +5247,7 @@ void netCDFDataset::SetGeoTransformNoUpdate(double *padfTransform)
 
 CPLErr netCDFDataset::SetGeoTransform(double *padfTransform)
 {
-    CPLMutexHolderD(&hNCMutex);
+    CPLMutexHolderD(GetMutex());
 
     if (GetAccess() != GA_Update || m_bHasGeoTransform)
     {
@@ -865,6 +865,14 @@ class netCDFDataset final : public GDALPamDataset
 
     std::unique_ptr<ChunkCacheType> poChunkCache;
 
+    // Set when GDAL_NETCDF_THREAD_SAFE_LIBRARY=YES at opening time: calls
+    // into libnetcdf for this dataset are then only serialized by m_hMutex,
+    // instead of the process-wide hNCMutex.
+    bool m_bPerDatasetLock = false;
+    CPLMutex *m_hMutex = nullptr;
+
+    CPLMutex **GetMutex();
+
     static double rint(double);
 
     double FetchCopyParam(const char *pszGridMappingValue, const char *pszParam,
@@ -41,6 +41,7 @@
 
 #include "pngdataset.h"
 
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
@@ -49,7 +50,10 @@
 #include <csetjmp>
 
 #include <algorithm>
+#include <condition_variable>
 #include <limits>
+#include <mutex>
+#include <thread>
 
 // Note: Callers must provide blocks in increasing Y order.
 // Disclaimer (E. Rouault): this code is not production ready at all. A lot of
@@ -1062,93 +1066,88 @@ CPLErr PNGDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         else
 #endif  // ENABLE_WHOLE_IMAGE_OPTIMIZATION
 
-            // Pixel interleaved case.
-            if (nBandSpace == 1)
+        {
+            const bool bCanUseDeinterleave =
+                (nBands == 3 || nBands == 4) && nPixelSpace == 1 &&
+                nBandSpace ==
+                    static_cast<GSpacing>(nRasterXSize) * nRasterYSize;
+
+            const auto CopyScanline = [=](int y, const GByte *pabyScanline)
             {
-                for (int y = 0; y < nYSize; ++y)
+                GByte *pabyDest = static_cast<GByte *>(pData) + y * nLineSpace;
+                if (nBandSpace == 1)
                 {
-                    CPLErr tmpError = LoadScanline(y);
-                    if (tmpError != CE_None)
-                        return tmpError;
-                    const GByte *pabyScanline =
-                        pabyBuffer + (y - nBufferStartLine) * nBands * nXSize;
+                    // Pixel interleaved case.
                     if (nPixelSpace == nBandSpace * nBandCount)
                     {
-                        memcpy(&(reinterpret_cast<GByte *>(
-                                   pData)[(y * nLineSpace)]),
-                               pabyScanline, nBandCount * nXSize);
+                        memcpy(pabyDest, pabyScanline, nBandCount * nXSize);
                     }
                     else
                     {
                         for (int x = 0; x < nXSize; ++x)
                         {
-                            memcpy(
-                                &(reinterpret_cast<GByte *>(
-                                    pData)[(y * nLineSpace) +
-                                           (x * nPixelSpace)]),
-                                (const GByte *)&(pabyScanline[x * nBandCount]),
-                                nBandCount);
+                            memcpy(pabyDest + x * nPixelSpace,
+                                   pabyScanline + x * nBandCount, nBandCount);
                         }
                     }
                 }
-                return CE_None;
-            }
-            else
-            {
-                const bool bCanUseDeinterleave =
-                    (nBands == 3 || nBands == 4) && nPixelSpace == 1 &&
-                    nBandSpace ==
-                        static_cast<GSpacing>(nRasterXSize) * nRasterYSize;
-
-                for (int y = 0; y < nYSize; ++y)
+                else if (bCanUseDeinterleave)
                 {
-                    CPLErr tmpError = LoadScanline(y);
-                    if (tmpError != CE_None)
-                        return tmpError;
-                    const GByte *pabyScanline =
-                        pabyBuffer + (y - nBufferStartLine) * nBands * nXSize;
-                    GByte *pabyDest =
-                        static_cast<GByte *>(pData) + y * nLineSpace;
-                    if (bCanUseDeinterleave)
+                    // Cache friendly way for typical band interleaved case.
+                    void *apDestBuffers[4];
+                    apDestBuffers[0] = pabyDest;
+                    apDestBuffers[1] = pabyDest + nBandSpace;
+                    apDestBuffers[2] = pabyDest + 2 * nBandSpace;
+                    apDestBuffers[3] = pabyDest + 3 * nBandSpace;
+                    GDALDeinterleave(pabyScanline, GDT_Byte, nBands,
+                                     apDestBuffers, GDT_Byte, nRasterXSize);
+                }
+                else if (nPixelSpace <= nBands && nBandSpace > nBands)
+                {
+                    // Cache friendly way for typical band interleaved case.
+                    for (int iBand = 0; iBand < nBands; iBand++)
                     {
-                        // Cache friendly way for typical band interleaved case.
-                        void *apDestBuffers[4];
-                        apDestBuffers[0] = pabyDest;
-                        apDestBuffers[1] = pabyDest + nBandSpace;
-                        apDestBuffers[2] = pabyDest + 2 * nBandSpace;
-                        apDestBuffers[3] = pabyDest + 3 * nBandSpace;
-                        GDALDeinterleave(pabyScanline, GDT_Byte, nBands,
-                                         apDestBuffers, GDT_Byte, nRasterXSize);
+                        GByte *pabyDest2 = pabyDest + iBand * nBandSpace;
+                        const GByte *pabyScanline2 = pabyScanline + iBand;
+                        GDALCopyWords(pabyScanline2, GDT_Byte, nBands,
+                                      pabyDest2, GDT_Byte,
+                                      static_cast<int>(nPixelSpace), nXSize);
                     }
-                    else if (nPixelSpace <= nBands && nBandSpace > nBands)
+                }
+                else
+                {
+                    // Generic method
+                    for (int x = 0; x < nXSize; ++x)
                     {
-                        // Cache friendly way for typical band interleaved case.
                         for (int iBand = 0; iBand < nBands; iBand++)
                         {
-                            GByte *pabyDest2 = pabyDest + iBand * nBandSpace;
-                            const GByte *pabyScanline2 = pabyScanline + iBand;
-                            GDALCopyWords(pabyScanline2, GDT_Byte, nBands,
-                                          pabyDest2, GDT_Byte,
-                                          static_cast<int>(nPixelSpace),
-                                          nXSize);
-                        }
-                    }
-                    else
-                    {
-                        // Generic method
-                        for (int x = 0; x < nXSize; ++x)
-                        {
-                            for (int iBand = 0; iBand < nBands; iBand++)
-                            {
-                                pabyDest[(x * nPixelSpace) +
-                                         iBand * nBandSpace] =
-                                    pabyScanline[x * nBands + iBand];
-                            }
+                            pabyDest[(x * nPixelSpace) + iBand * nBandSpace] =
+                                pabyScanline[x * nBands + iBand];
                         }
                     }
                 }
-                return CE_None;
+            };
+
+            const char *pszNumThreads =
+                CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+            const int nThreads =
+                EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszNumThreads);
+            if (!bInterlaced && nThreads > 1 && nYSize > 1)
+            {
+                return LoadScanlinesWithDecodingThread(CopyScanline);
+            }
+
+            for (int y = 0; y < nYSize; ++y)
+            {
+                CPLErr tmpError = LoadScanline(y);
+                if (tmpError != CE_None)
+                    return tmpError;
+                CopyScanline(y, pabyBuffer + (y - nBufferStartLine) * nBands *
+                                                 nXSize);
             }
+            return CE_None;
+        }
     }
 
     return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
@@ -1500,6 +1499,141 @@ CPLErr PNGDataset::LoadScanline(int nLine)
     return CE_None;
 }
 
+/************************************************************************/
+/*                  LoadScanlinesWithDecodingThread()                   */
+/************************************************************************/
+
+// Decode all the scanlines of a non-interlaced image in a background
+// thread, up to MAX_LINES_AHEAD lines ahead of the calling thread that gets
+// them in order through oScanlineFunc, so that the inflating and unfiltering
+// of the next lines by libpng overlap with the processing of the current
+// one.
+CPLErr PNGDataset::LoadScanlinesWithDecodingThread(
+    const std::function<void(int, const GByte *)> &oScanlineFunc)
+{
+    CPLAssert(!bInterlaced);
+
+    const int nPixelOffset =
+        (nBitDepth == 16) ? 2 * GetRasterCount() : GetRasterCount();
+    const size_t nLineSize = static_cast<size_t>(nPixelOffset) * nRasterXSize;
+
+    // Ring of decoded lines.
+    constexpr int MAX_LINES_AHEAD = 64;
+    const int nRingLines = std::min(nRasterYSize, MAX_LINES_AHEAD);
+    std::vector<GByte> abyRing;
+    try
+    {
+        abyRing.resize(nLineSize * nRingLines);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffer for decoded lines");
+        return CE_Failure;
+    }
+
+    if (nLastLineRead != -1)
+    {
+        Restart();
+    }
+
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    int nDecodedLines = 0;
+    int nConsumedLines = 0;
+    bool bDecodingError = false;
+    bool bStop = false;
+    // Errors and warnings of libpng in the decoding thread, emitted again
+    // in the calling thread.
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+
+    std::thread oDecodingThread(
+        [&]()
+        {
+            CPLInstallErrorHandlerAccumulator(aoErrors);
+            for (int iLine = 0; iLine < nRasterYSize; ++iLine)
+            {
+                {
+                    std::unique_lock<std::mutex> oLock(oMutex);
+                    oCV.wait(oLock,
+                             [&]
+                             {
+                                 return bStop ||
+                                        iLine - nConsumedLines < nRingLines;
+                             });
+                    if (bStop)
+                        break;
+                }
+
+                png_bytep row =
+                    abyRing.data() + (iLine % nRingLines) * nLineSize;
+                const bool bOK = safe_png_read_rows(hPNG, row, sSetJmpContext);
+#ifdef CPL_LSB
+                // 16-bit PNG data is stored in MSB format.
+                if (bOK && nBitDepth == 16)
+                    GDALSwapWords(row, 2, nRasterXSize * nBands, 2);
+#endif
+                {
+                    std::lock_guard<std::mutex> oLock(oMutex);
+                    if (bOK)
+                        nDecodedLines = iLine + 1;
+                    else
+                        bDecodingError = true;
+                }
+                oCV.notify_one();
+                if (!bOK)
+                    break;
+            }
+            CPLUninstallErrorHandlerAccumulator();
+        });
+
+    int iLine = 0;
+    for (; iLine < nRasterYSize; ++iLine)
+    {
+        {
+            std::unique_lock<std::mutex> oLock(oMutex);
+            oCV.wait(oLock,
+                     [&] { return bDecodingError || nDecodedLines > iLine; });
+            if (nDecodedLines <= iLine)
+                break;
+        }
+
+        oScanlineFunc(iLine,
+                      abyRing.data() + (iLine % nRingLines) * nLineSize);
+
+        {
+            std::lock_guard<std::mutex> oLock(oMutex);
+            nConsumedLines = iLine + 1;
+        }
+        oCV.notify_one();
+    }
+
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        bStop = true;
+    }
+    oCV.notify_one();
+    oDecodingThread.join();
+
+    nLastLineRead = nDecodedLines - 1;
+
+    for (const auto &oError : aoErrors)
+    {
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+    if (iLine < nRasterYSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Error while reading row %d%s",
+                 iLine,
+                 !aoErrors.empty()
+                     ? CPLSPrintf(": %s", aoErrors.back().msg.c_str())
+                     : "");
+        return CE_Failure;
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                          CollectMetadata()                           */
 /*                                                                      */
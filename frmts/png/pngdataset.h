@@ -60,6 +60,7 @@
 #include <csetjmp>
 
 #include <algorithm>
+#include <functional>
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4611)
@@ -117,6 +118,8 @@ class PNGDataset final : public GDALPamDataset
     void CollectXMPMetadata();
 
     CPLErr LoadScanline(int);
+    CPLErr LoadScanlinesWithDecodingThread(
+        const std::function<void(int, const GByte *)> &oScanlineFunc);
     CPLErr LoadInterlacedChunk(int);
     void Restart();
 
@@ -311,14 +311,39 @@ CPLErr WEBPDataset::Uncompress()
     if (pabyCompressed == nullptr)
         return CE_Failure;
     VSIFReadL(pabyCompressed, 1, nSize, fpImage);
-    uint8_t *pRet;
+    uint8_t *pRet = nullptr;
+    bool bDecoded = false;
 
-    if (nBands == 4)
+#if WEBP_DECODER_ABI_VERSION >= 0x0002
+    // libwebp can run the in-loop filtering of lossy images in a separate
+    // thread, pipelined with the decoding of the macroblock rows.
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    WebPDecoderConfig sConfig;
+    if (nThreads > 1 && WebPInitDecoderConfig(&sConfig))
+    {
+        sConfig.options.use_threads = 1;
+        sConfig.output.colorspace = (nBands == 4) ? MODE_RGBA : MODE_RGB;
+        sConfig.output.is_external_memory = 1;
+        sConfig.output.u.RGBA.rgba = static_cast<uint8_t *>(pabyUncompressed);
+        sConfig.output.u.RGBA.stride = nRasterXSize * nBands;
+        sConfig.output.u.RGBA.size =
+            static_cast<size_t>(nRasterXSize) * nRasterYSize * nBands;
+        if (WebPDecode(pabyCompressed, nSize, &sConfig) == VP8_STATUS_OK)
+            pRet = static_cast<uint8_t *>(pabyUncompressed);
+        WebPFreeDecBuffer(&sConfig.output);
+        bDecoded = true;
+    }
+#endif
+
+    if (!bDecoded && nBands == 4)
         pRet = WebPDecodeRGBAInto(pabyCompressed, static_cast<uint32_t>(nSize),
                                   static_cast<uint8_t *>(pabyUncompressed),
                                   nRasterXSize * nRasterYSize * nBands,
                                   nRasterXSize * nBands);
-    else
+    else if (!bDecoded)
         pRet = WebPDecodeRGBInto(pabyCompressed, static_cast<uint32_t>(nSize),
                                  static_cast<uint8_t *>(pabyUncompressed),
                                  nRasterXSize * nRasterYSize * nBands,
@@ -31,11 +31,14 @@
 
 #include "cpl_compressor.h"
 #include "cpl_json.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
 #include "memmultidim.h"
 
 #include <array>
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <mutex>
 #include <set>
@@ -534,6 +537,8 @@ class ZarrArray final : public GDALPamMDArray
     uint64_t m_nTotalTileCount = 0;
     mutable bool m_bHasTriedCacheTilePresenceArray = false;
     mutable std::shared_ptr<GDALMDArray> m_poCacheTilePresenceArray{};
+    mutable bool m_bTileExistenceIndexTried = false;
+    mutable std::vector<bool> m_abTileExists{};  // empty if not available
     mutable std::mutex m_oMutex{};
     struct CachedTile
     {
@@ -541,6 +546,29 @@ class ZarrArray final : public GDALPamMDArray
     };
     mutable std::map<uint64_t, CachedTile> m_oMapTileIndexToCachedTile{};
 
+    // Sharding storage transformer
+    std::vector<GUInt64> m_anChunksPerShard{};  // empty if not sharded
+    size_t m_nChunksPerShard = 0;
+    mutable std::string m_osCachedShardFilename{};
+    mutable std::vector<uint64_t> m_anCachedShardIndex{};
+    struct ShardBuffer
+    {
+        std::vector<std::vector<GByte>> aabyChunks{};
+        std::vector<bool> abChunkSet{};
+        size_t nChunksSet = 0;
+        size_t nChunksExpected = 0;
+    };
+    mutable std::map<std::vector<uint64_t>, ShardBuffer> m_oMapShardBuffers{};
+
+    // Multi-threaded chunk encoding and writing
+    struct TileWriteJob;
+    mutable int m_nWriteThreads = -1;
+    mutable std::deque<std::unique_ptr<TileWriteJob>> m_apoWriteJobs{};
+    mutable std::condition_variable m_oWriteJobCV{};
+    // Must be declared after the above members, so that it is destroyed
+    // (and waits for its jobs) first.
+    mutable std::unique_ptr<CPLJobQueue> m_poWriteJobQueue{};
+
     ZarrArray(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
               const std::string &osParentName, const std::string &osName,
               const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -576,8 +604,47 @@ class ZarrArray final : public GDALPamMDArray
 
     void DeallocateDecodedTileData();
 
+    std::string GetDataDirectoryName() const;
+
+    std::string BuildTileFilename(const uint64_t *tileIndices) const;
+
+    bool ParseTileFilename(const char *pszName,
+                           std::vector<uint64_t> &anTileIdx) const;
+
+    uint64_t GetLinearTileIndex(const uint64_t *tileIndices) const;
+
+    void BuildTileExistenceIndex() const;
+
+    bool EncodeTileData(const std::string &osFilename,
+                        std::vector<GByte> &abyRawTileData,
+                        std::vector<GByte> &abyTmpRawTileData,
+                        std::vector<GByte> &abyEncodedData) const;
+
+    VSILFILE *CreateTileFile(const std::string &osFilename) const;
+
+    bool WriteTileFile(const std::string &osFilename,
+                       const std::vector<GByte> &abyData) const;
+
+    bool IsTileWritePending(const std::vector<uint64_t> &anTileIndices) const;
+
+    bool WaitForWriteJobs(size_t nMaxPendingJobs) const;
+
+    bool FlushPendingTileWrites() const;
+
     bool FlushDirtyTile() const;
 
+    size_t GetChunkIndexInShard(const uint64_t *tileIndices,
+                                std::vector<uint64_t> &anShardIndices) const;
+
+    bool ReadShardIndex(VSILFILE *fp, const std::string &osFilename,
+                        std::vector<uint64_t> &anIndex) const;
+
+    bool StoreChunkInShard(const std::vector<uint64_t> &anTileIndices,
+                           std::vector<GByte> &&abyEncodedData) const;
+
+    bool WriteShard(const std::vector<uint64_t> &anShardIndices,
+                    ShardBuffer &oBuffer) const;
+
     std::shared_ptr<GDALMDArray> OpenTilePresenceCache(bool bCanCreate) const;
 
     // Disable copy constructor and assignment operator
@@ -777,6 +844,8 @@ class ZarrArray final : public GDALPamMDArray
         m_oCompressorJSonV3 = oCompressor;
     }
 
+    bool SetChunksPerShard(const std::vector<GUInt64> &anChunksPerShard);
+
     void SetNew(bool bNew)
     {
         m_bNew = bNew;
@@ -26,6 +26,7 @@
  * DEALINGS IN THE SOFTWARE.
  ****************************************************************************/
 
+#include "cpl_error_internal.h"
 #include "cpl_vsi_virtual.h"
 #include "zarr.h"
 #include "gdal_thread_pool.h"
@@ -46,6 +47,12 @@
 
 #define CRS_ATTRIBUTE_NAME "_CRS"
 
+#define SHARDING_EXTENSION                                                     \
+    "https://purl.org/zarr/spec/storage_transformers/sharding/1.0"
+
+// Value of the offset and size of missing chunks in the shard index
+constexpr uint64_t SHARD_MISSING_CHUNK = std::numeric_limits<uint64_t>::max();
+
 namespace
 {
 
@@ -104,6 +111,22 @@ inline char *UCS4ToUTF8(const uint8_t *ucs4Ptr, size_t nSize, bool needByteSwap)
     return ret;
 }
 
+struct DirCloser
+{
+    DirCloser(const DirCloser &) = delete;
+    DirCloser &operator=(const DirCloser &) = delete;
+
+    VSIDIR *m_psDir;
+
+    explicit DirCloser(VSIDIR *psDir) : m_psDir(psDir)
+    {
+    }
+    ~DirCloser()
+    {
+        VSICloseDir(m_psDir);
+    }
+};
+
 }  // namespace
 
 /************************************************************************/
@@ -202,6 +225,7 @@ ZarrArray::~ZarrArray()
 void ZarrArray::Flush()
 {
     FlushDirtyTile();
+    FlushPendingTileWrites();
     bool bSerializeV3 = false;
 
     if (m_bDefinitionModified)
@@ -741,6 +765,24 @@ void ZarrArray::SerializeV3(const CPLJSONObject &oAttrs)
 
     oRoot.Add("extensions", CPLJSONArray());
 
+    if (!m_anChunksPerShard.empty())
+    {
+        CPLJSONObject oSharding;
+        oSharding.Add("extension", SHARDING_EXTENSION);
+        oSharding.Add("type", "indexed");
+        CPLJSONObject oConfiguration;
+        CPLJSONArray oChunksPerShard;
+        for (const auto nVal : m_anChunksPerShard)
+        {
+            oChunksPerShard.Add(static_cast<GInt64>(nVal));
+        }
+        oConfiguration.Add("chunks_per_shard", oChunksPerShard);
+        oSharding.Add("configuration", oConfiguration);
+        CPLJSONArray oStorageTransformers;
+        oStorageTransformers.Add(oSharding);
+        oRoot.Add("storage_transformers", oStorageTransformers);
+    }
+
     oRoot.Add("attributes", oAttrs);
 
     oDoc.Save(m_osFilename);
@@ -1169,6 +1211,12 @@ static void DecodeSourceElt(const std::vector<DtypeElt> &elts,
 bool ZarrArray::LoadTileData(const uint64_t *tileIndices,
                              bool &bMissingTileOut) const
 {
+    // Make sure that tiles being written are visible
+    if (!FlushPendingTileWrites())
+        return false;
+
+    BuildTileExistenceIndex();
+
     return LoadTileData(tileIndices,
                         false,  // use mutex
                         m_psDecompressor, m_abyRawTileData, m_abyTmpRawTileData,
@@ -1193,43 +1241,43 @@ bool ZarrArray::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
 
     bMissingTileOut = false;
 
+    const bool bSharded = !m_anChunksPerShard.empty();
     std::string osFilename;
-    if (m_aoDims.empty())
+    size_t nChunkIdxInShard = 0;
+    if (bSharded)
     {
-        osFilename = "0";
+        // The chunk is stored in the shard file, whose name is built from
+        // the shard indices.
+        std::vector<uint64_t> anShardIndices;
+        nChunkIdxInShard = GetChunkIndexInShard(tileIndices, anShardIndices);
+        osFilename = BuildTileFilename(anShardIndices.data());
     }
     else
     {
-        for (size_t i = 0; i < m_aoDims.size(); ++i)
-        {
-            if (!osFilename.empty())
-                osFilename += m_osDimSeparator;
-            osFilename += std::to_string(tileIndices[i]);
-        }
+        // For network file systems, get the streaming version of the
+        // filename, as we don't need arbitrary seeking in the file
+        osFilename = BuildTileFilename(tileIndices);
+        osFilename = VSIFileManager::GetHandler(osFilename.c_str())
+                         ->GetStreamingFilename(osFilename);
     }
 
-    if (m_nVersion == 2)
-    {
-        osFilename = CPLFormFilename(CPLGetDirname(m_osFilename.c_str()),
-                                     osFilename.c_str(), nullptr);
-    }
-    else
+    // Check tile presence from the in-memory index, if available.
+    // Note: it is only modified by writing operations, which are not
+    // concurrent to reads from several threads.
+    if (!m_abTileExists.empty() &&
+        !m_abTileExists[static_cast<size_t>(GetLinearTileIndex(tileIndices))])
     {
-        std::string osTmp = m_osRootDirectoryName + "/data/root";
-        if (GetFullName() != "/")
-            osTmp += GetFullName();
-        osFilename = osTmp + "/c" + osFilename;
+        CPLDebugOnly(ZARR_DEBUG_KEY, "Tile %s missing (=nodata)",
+                     osFilename.c_str());
+        bMissingTileOut = true;
+        return true;
     }
 
-    // For network file systems, get the streaming version of the filename,
-    // as we don't need arbitrary seeking in the file
-    osFilename = VSIFileManager::GetHandler(osFilename.c_str())
-                     ->GetStreamingFilename(osFilename);
-
-    // First if we have a tile presence cache, check tile presence from it
+    // Then if we have a tile presence cache, check tile presence from it
     if (bUseMutex)
         m_oMutex.lock();
-    auto poTilePresenceArray = OpenTilePresenceCache(false);
+    auto poTilePresenceArray =
+        bSharded ? nullptr : OpenTilePresenceCache(false);
     if (poTilePresenceArray)
     {
         std::vector<GUInt64> anTileIdx(m_aoDims.size());
@@ -1284,18 +1332,65 @@ bool ZarrArray::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
         return true;
     }
 
+    // Locate the chunk in the shard from the shard index
+    vsi_l_offset nChunkOffset = 0;
+    vsi_l_offset nChunkSize = 0;
+    if (bSharded)
+    {
+        std::vector<uint64_t> anIndex;
+        {
+            std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+            if (bUseMutex)
+                oLock.lock();
+            if (m_osCachedShardFilename == osFilename)
+                anIndex = m_anCachedShardIndex;
+        }
+        if (anIndex.empty())
+        {
+            if (!ReadShardIndex(fp, osFilename, anIndex))
+            {
+                VSIFCloseL(fp);
+                return false;
+            }
+            std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+            if (bUseMutex)
+                oLock.lock();
+            m_osCachedShardFilename = osFilename;
+            m_anCachedShardIndex = anIndex;
+        }
+        nChunkOffset = anIndex[2 * nChunkIdxInShard];
+        nChunkSize = anIndex[2 * nChunkIdxInShard + 1];
+        if (nChunkOffset == std::numeric_limits<uint64_t>::max())
+        {
+            VSIFCloseL(fp);
+            CPLDebugOnly(ZARR_DEBUG_KEY,
+                         "Chunk %u of shard %s missing (=nodata)",
+                         static_cast<unsigned>(nChunkIdxInShard),
+                         osFilename.c_str());
+            bMissingTileOut = true;
+            return true;
+        }
+        VSIFSeekL(fp, nChunkOffset, SEEK_SET);
+    }
+
     bMissingTileOut = false;
     bool bRet = true;
     size_t nRawDataSize = abyRawTileData.size();
     if (psDecompressor == nullptr)
     {
+        if (bSharded && nChunkSize < nRawDataSize)
+            nRawDataSize = static_cast<size_t>(nChunkSize);
         nRawDataSize = VSIFReadL(&abyRawTileData[0], 1, nRawDataSize, fp);
     }
     else
     {
-        VSIFSeekL(fp, 0, SEEK_END);
-        const auto nSize = VSIFTellL(fp);
-        VSIFSeekL(fp, 0, SEEK_SET);
+        vsi_l_offset nSize = nChunkSize;
+        if (!bSharded)
+        {
+            VSIFSeekL(fp, 0, SEEK_END);
+            nSize = VSIFTellL(fp);
+            VSIFSeekL(fp, 0, SEEK_SET);
+        }
         if (nSize > static_cast<vsi_l_offset>(std::numeric_limits<int>::max()))
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Too large tile %s",
@@ -1421,6 +1516,12 @@ bool ZarrArray::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
 bool ZarrArray::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
                             CSLConstList papszOptions) const
 {
+    // Make sure that tiles being written are visible
+    if (!FlushPendingTileWrites())
+        return false;
+
+    BuildTileExistenceIndex();
+
     const size_t nDims = m_aoDims.size();
     std::vector<uint64_t> anIndicesCur(nDims);
     std::vector<uint64_t> anIndicesMin(nDims);
@@ -2192,42 +2293,322 @@ lbl_next_depth:
 }
 
 /************************************************************************/
-/*                    ZarrArray::FlushDirtyTile()                       */
+/*                  ZarrArray::GetDataDirectoryName()                   */
 /************************************************************************/
 
-bool ZarrArray::FlushDirtyTile() const
+// Return the directory where tiles are stored
+std::string ZarrArray::GetDataDirectoryName() const
 {
-    if (!m_bDirtyTile)
-        return true;
-    m_bDirtyTile = false;
+    if (m_nVersion == 2)
+        return CPLGetDirname(m_osFilename.c_str());
+
+    std::string osTmp = m_osRootDirectoryName + "/data/root";
+    if (GetFullName() != "/")
+        osTmp += GetFullName();
+    return osTmp;
+}
+
+/************************************************************************/
+/*                   ZarrArray::BuildTileFilename()                     */
+/************************************************************************/
 
+std::string ZarrArray::BuildTileFilename(const uint64_t *tileIndices) const
+{
     std::string osFilename;
-    if (m_anCachedTiledIndices.empty())
+    if (m_aoDims.empty())
     {
         osFilename = "0";
     }
     else
     {
-        for (const auto index : m_anCachedTiledIndices)
+        for (size_t i = 0; i < m_aoDims.size(); ++i)
         {
             if (!osFilename.empty())
                 osFilename += m_osDimSeparator;
-            osFilename += std::to_string(index);
+            osFilename += std::to_string(tileIndices[i]);
         }
     }
 
     if (m_nVersion == 2)
     {
-        osFilename = CPLFormFilename(CPLGetDirname(m_osFilename.c_str()),
-                                     osFilename.c_str(), nullptr);
+        return CPLFormFilename(GetDataDirectoryName().c_str(),
+                               osFilename.c_str(), nullptr);
     }
-    else
+    return GetDataDirectoryName() + "/c" + osFilename;
+}
+
+/************************************************************************/
+/*                    ZarrArray::EncodeTileData()                       */
+/************************************************************************/
+
+// Apply the chunk memory layout, the filters and the compressor to the
+// raw content of a tile.
+bool ZarrArray::EncodeTileData(const std::string &osFilename,
+                               std::vector<GByte> &abyRawTileData,
+                               std::vector<GByte> &abyTmpRawTileData,
+                               std::vector<GByte> &abyEncodedData) const
+{
+    // This method should NOT modify any ZarrArray member, as it is going to
+    // be called concurrently from several threads.
+
+    // Set those #define to avoid accidental use of some global variables
+#define m_abyTmpRawTileData cannot_use_here
+#define m_abyRawTileData cannot_use_here
+#define m_abyDecodedTileData cannot_use_here
+
+    if (m_bFortranOrder && !m_aoDims.empty())
+    {
+        BlockTranspose(abyRawTileData, abyTmpRawTileData, false);
+        std::swap(abyRawTileData, abyTmpRawTileData);
+    }
+
+    size_t nRawDataSize = abyRawTileData.size();
+    for (const auto &oFilter : m_oFiltersArray)
+    {
+        const auto osFilterId = oFilter["id"].ToString();
+        const auto psFilterCompressor = CPLGetCompressor(osFilterId.c_str());
+        CPLAssert(psFilterCompressor);
+
+        CPLStringList aosOptions;
+        for (const auto &obj : oFilter.GetChildren())
+        {
+            aosOptions.SetNameValue(obj.GetName().c_str(),
+                                    obj.ToString().c_str());
+        }
+        void *out_buffer = &abyTmpRawTileData[0];
+        size_t nOutSize = abyTmpRawTileData.size();
+        if (!psFilterCompressor->pfnFunc(
+                abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
+                aosOptions.List(), psFilterCompressor->user_data))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Filter %s for tile %s failed", osFilterId.c_str(),
+                     osFilename.c_str());
+            return false;
+        }
+
+        nRawDataSize = nOutSize;
+        std::swap(abyRawTileData, abyTmpRawTileData);
+    }
+
+    try
+    {
+        if (m_psCompressor == nullptr)
+        {
+            abyEncodedData.assign(abyRawTileData.begin(),
+                                  abyRawTileData.begin() + nRawDataSize);
+            return true;
+        }
+
+        constexpr size_t MIN_BUF_SIZE = 64;  // somewhat arbitrary
+        abyEncodedData.resize(static_cast<size_t>(
+            MIN_BUF_SIZE + nRawDataSize + nRawDataSize / 3));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for tile %s", osFilename.c_str());
+        return false;
+    }
+
+    void *out_buffer = &abyEncodedData[0];
+    size_t out_size = abyEncodedData.size();
+    CPLStringList aosOptions;
+    const auto compressorConfig = m_nVersion == 2
+                                      ? m_oCompressorJSonV2
+                                      : m_oCompressorJSonV3["configuration"];
+    for (const auto &obj : compressorConfig.GetChildren())
+    {
+        aosOptions.SetNameValue(obj.GetName().c_str(), obj.ToString().c_str());
+    }
+    if (EQUAL(m_psCompressor->pszId, "blosc") &&
+        m_oType.GetClass() == GEDTC_NUMERIC)
+    {
+        aosOptions.SetNameValue(
+            "TYPESIZE",
+            CPLSPrintf("%d", GDALGetDataTypeSizeBytes(GDALGetNonComplexDataType(
+                                 m_oType.GetNumericDataType()))));
+    }
+
+    if (!m_psCompressor->pfnFunc(abyRawTileData.data(), nRawDataSize,
+                                 &out_buffer, &out_size, aosOptions.List(),
+                                 m_psCompressor->user_data))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Compression of tile %s failed",
+                 osFilename.c_str());
+        return false;
+    }
+    abyEncodedData.resize(out_size);
+
+    return true;
+
+#undef m_abyTmpRawTileData
+#undef m_abyRawTileData
+#undef m_abyDecodedTileData
+}
+
+/************************************************************************/
+/*                     ZarrArray::CreateTileFile()                      */
+/************************************************************************/
+
+VSILFILE *ZarrArray::CreateTileFile(const std::string &osFilename) const
+{
+    if (m_osDimSeparator == "/")
+    {
+        std::string osDir = CPLGetDirname(osFilename.c_str());
+        VSIStatBufL sStat;
+        if (VSIStatL(osDir.c_str(), &sStat) != 0)
+        {
+            // The directory might have been concurrently created by another
+            // writing thread.
+            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0 &&
+                VSIStatL(osDir.c_str(), &sStat) != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot create directory %s", osDir.c_str());
+                return nullptr;
+            }
+        }
+    }
+
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot create tile %s",
+                 osFilename.c_str());
+    }
+    return fp;
+}
+
+/************************************************************************/
+/*                     ZarrArray::WriteTileFile()                       */
+/************************************************************************/
+
+bool ZarrArray::WriteTileFile(const std::string &osFilename,
+                              const std::vector<GByte> &abyData) const
+{
+    VSILFILE *fp = CreateTileFile(osFilename);
+    if (fp == nullptr)
+        return false;
+
+    bool bRet =
+        VSIFWriteL(abyData.data(), 1, abyData.size(), fp) == abyData.size();
+    if (VSIFCloseL(fp) != 0)
+        bRet = false;
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not write tile %s correctly", osFilename.c_str());
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                       ZarrArray::TileWriteJob                        */
+/************************************************************************/
+
+struct ZarrArray::TileWriteJob
+{
+    const ZarrArray *poArray = nullptr;
+    std::string osFilename{};
+    std::vector<uint64_t> anTileIndices{};
+    std::vector<GByte> abyRawTileData{};
+    std::vector<GByte> abyTmpRawTileData{};
+    std::vector<GByte> abyEncodedData{};  // only kept for sharded arrays
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    bool bOK = false;
+    bool bFinished = false;  // protected by ZarrArray::m_oMutex
+};
+
+/************************************************************************/
+/*                   ZarrArray::IsTileWritePending()                    */
+/************************************************************************/
+
+bool ZarrArray::IsTileWritePending(
+    const std::vector<uint64_t> &anTileIndices) const
+{
+    for (const auto &poJob : m_apoWriteJobs)
+    {
+        if (poJob->anTileIndices == anTileIndices)
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                    ZarrArray::WaitForWriteJobs()                     */
+/************************************************************************/
+
+// Wait for the oldest write jobs to complete, until there are at most
+// nMaxPendingJobs remaining. Jobs are collected in submission order, so
+// that the content of sharded chunks is stored in the same order as the
+// writes.
+bool ZarrArray::WaitForWriteJobs(size_t nMaxPendingJobs) const
+{
+    bool bRet = true;
+    while (m_apoWriteJobs.size() > nMaxPendingJobs)
+    {
+        const auto &poJob = m_apoWriteJobs.front();
+        {
+            std::unique_lock<std::mutex> oLock(m_oMutex);
+            m_oWriteJobCV.wait(oLock, [&poJob] { return poJob->bFinished; });
+        }
+
+        // Re-emit errors from the worker thread in the calling thread
+        for (const auto &oError : poJob->aoErrors)
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+
+        if (!poJob->bOK)
+        {
+            bRet = false;
+        }
+        else if (!m_anChunksPerShard.empty() &&
+                 !StoreChunkInShard(poJob->anTileIndices,
+                                    std::move(poJob->abyEncodedData)))
+        {
+            bRet = false;
+        }
+        m_apoWriteJobs.pop_front();
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                 ZarrArray::FlushPendingTileWrites()                  */
+/************************************************************************/
+
+bool ZarrArray::FlushPendingTileWrites() const
+{
+    bool bRet = WaitForWriteJobs(0);
+    for (auto &oIter : m_oMapShardBuffers)
     {
-        std::string osTmp = m_osRootDirectoryName + "/data/root";
-        if (GetFullName() != "/")
-            osTmp += GetFullName();
-        osFilename = osTmp + "/c" + osFilename;
+        if (!WriteShard(oIter.first, oIter.second))
+            bRet = false;
     }
+    m_oMapShardBuffers.clear();
+    return bRet;
+}
+
+/************************************************************************/
+/*                    ZarrArray::FlushDirtyTile()                       */
+/************************************************************************/
+
+bool ZarrArray::FlushDirtyTile() const
+{
+    if (!m_bDirtyTile)
+        return true;
+    m_bDirtyTile = false;
+
+    // If a previous version of that tile is still being written, wait for it
+    // to be completed, so that writes are applied in order.
+    if (IsTileWritePending(m_anCachedTiledIndices) && !WaitForWriteJobs(0))
+        return false;
+
+    const bool bSharded = !m_anChunksPerShard.empty();
+    const std::string osFilename =
+        BuildTileFilename(m_anCachedTiledIndices.data());
 
     const size_t nSourceSize =
         m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
@@ -2280,10 +2661,20 @@ bool ZarrArray::FlushDirtyTile() const
                 : GSF_FLOATING_POINT);
     }
 
+    if (!m_abTileExists.empty())
+    {
+        m_abTileExists[static_cast<size_t>(
+            GetLinearTileIndex(m_anCachedTiledIndices.data()))] = !bEmptyTile;
+    }
+
     if (bEmptyTile)
     {
         m_bCachedTiledEmpty = true;
 
+        if (bSharded)
+            return StoreChunkInShard(m_anCachedTiledIndices,
+                                     std::vector<GByte>());
+
         VSIStatBufL sStat;
         if (VSIStatL(osFilename.c_str(), &sStat) == 0)
         {
@@ -2308,139 +2699,376 @@ bool ZarrArray::FlushDirtyTile() const
         }
     }
 
-    if (m_bFortranOrder && !m_aoDims.empty())
+    if (m_nWriteThreads < 0)
     {
-        BlockTranspose(m_abyRawTileData, m_abyTmpRawTileData, false);
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
-    }
-
-    size_t nRawDataSize = m_abyRawTileData.size();
-    for (const auto &oFilter : m_oFiltersArray)
-    {
-        const auto osFilterId = oFilter["id"].ToString();
-        const auto psFilterCompressor = CPLGetCompressor(osFilterId.c_str());
-        CPLAssert(psFilterCompressor);
-
-        CPLStringList aosOptions;
-        for (const auto &obj : oFilter.GetChildren())
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        if (EQUAL(pszNumThreads, "ALL_CPUS"))
+            m_nWriteThreads = CPLGetNumCPUs();
+        else
+            m_nWriteThreads = std::max(1, atoi(pszNumThreads));
+        if (m_nWriteThreads > 1024)
+            m_nWriteThreads = 1024;
+        if (m_nWriteThreads > 1)
         {
-            aosOptions.SetNameValue(obj.GetName().c_str(),
-                                    obj.ToString().c_str());
+            CPLWorkerThreadPool *poPool =
+                GDALGetGlobalThreadPool(m_nWriteThreads);
+            if (poPool)
+            {
+                CPLDebug(ZARR_DEBUG_KEY,
+                         "Using up to %d threads to encode and write tiles",
+                         m_nWriteThreads);
+                m_poWriteJobQueue = poPool->CreateJobQueue();
+            }
         }
-        void *out_buffer = &m_abyTmpRawTileData[0];
-        size_t nOutSize = m_abyTmpRawTileData.size();
-        if (!psFilterCompressor->pfnFunc(
-                m_abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
-                aosOptions.List(), psFilterCompressor->user_data))
+    }
+
+    if (!m_poWriteJobQueue)
+    {
+        std::vector<GByte> abyEncodedData;
+        if (!EncodeTileData(osFilename, m_abyRawTileData, m_abyTmpRawTileData,
+                            abyEncodedData))
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Filter %s for tile %s failed", osFilterId.c_str(),
-                     osFilename.c_str());
             return false;
         }
+        if (bSharded)
+            return StoreChunkInShard(m_anCachedTiledIndices,
+                                     std::move(abyEncodedData));
+        return WriteTileFile(osFilename, abyEncodedData);
+    }
 
-        nRawDataSize = nOutSize;
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
+    // Limit the number of tiles in flight to bound memory usage
+    if (!WaitForWriteJobs(2 * static_cast<size_t>(m_nWriteThreads) - 1))
+        return false;
+
+    auto poJob = cpl::make_unique<TileWriteJob>();
+    poJob->poArray = this;
+    poJob->osFilename = osFilename;
+    poJob->anTileIndices = m_anCachedTiledIndices;
+    try
+    {
+        poJob->abyRawTileData = m_abyRawTileData;
+        poJob->abyTmpRawTileData.resize(m_abyTmpRawTileData.size());
+    }
+    catch (const std::bad_alloc &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
     }
 
-    if (m_osDimSeparator == "/")
+    const auto JobFunc = [](void *pData)
     {
-        std::string osDir = CPLGetDirname(osFilename.c_str());
-        VSIStatBufL sStat;
-        if (VSIStatL(osDir.c_str(), &sStat) != 0)
+        TileWriteJob *psJob = static_cast<TileWriteJob *>(pData);
+        const ZarrArray *poArray = psJob->poArray;
+
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        bool bOK = poArray->EncodeTileData(
+            psJob->osFilename, psJob->abyRawTileData, psJob->abyTmpRawTileData,
+            psJob->abyEncodedData);
+        std::vector<GByte>().swap(psJob->abyRawTileData);
+        std::vector<GByte>().swap(psJob->abyTmpRawTileData);
+        // Sharded chunks are assembled in the calling thread
+        if (bOK && poArray->m_anChunksPerShard.empty())
         {
-            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot create directory %s", osDir.c_str());
-                return false;
-            }
+            bOK = poArray->WriteTileFile(psJob->osFilename,
+                                         psJob->abyEncodedData);
+            std::vector<GByte>().swap(psJob->abyEncodedData);
         }
+        CPLUninstallErrorHandlerAccumulator();
+
+        std::lock_guard<std::mutex> oLock(poArray->m_oMutex);
+        psJob->bOK = bOK;
+        psJob->bFinished = true;
+        poArray->m_oWriteJobCV.notify_all();
+    };
+
+    TileWriteJob *psJob = poJob.get();
+    m_apoWriteJobs.push_back(std::move(poJob));
+    if (!m_poWriteJobQueue->SubmitJob(JobFunc, psJob))
+    {
+        m_apoWriteJobs.pop_back();
+        return false;
     }
+    return true;
+}
 
-    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
-    if (fp == nullptr)
+/************************************************************************/
+/*                  ZarrArray::GetChunkIndexInShard()                   */
+/************************************************************************/
+
+// Return the index, in C order, of a chunk within its shard, and the
+// indices of the shard.
+size_t
+ZarrArray::GetChunkIndexInShard(const uint64_t *tileIndices,
+                                std::vector<uint64_t> &anShardIndices) const
+{
+    const size_t nDims = m_aoDims.size();
+    anShardIndices.resize(nDims);
+    size_t nIdx = 0;
+    for (size_t i = 0; i < nDims; ++i)
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "Cannot create tile %s",
+        anShardIndices[i] = tileIndices[i] / m_anChunksPerShard[i];
+        nIdx = nIdx * static_cast<size_t>(m_anChunksPerShard[i]) +
+               static_cast<size_t>(tileIndices[i] % m_anChunksPerShard[i]);
+    }
+    return nIdx;
+}
+
+/************************************************************************/
+/*                     ZarrArray::ReadShardIndex()                      */
+/************************************************************************/
+
+// The index is located at the end of the shard, and is made of a pair of
+// little-endian uint64 values (offset, nbytes) per chunk, in C order.
+// Missing chunks have both values set to 2^64-1.
+bool ZarrArray::ReadShardIndex(VSILFILE *fp, const std::string &osFilename,
+                               std::vector<uint64_t> &anIndex) const
+{
+    const vsi_l_offset nIndexSize =
+        static_cast<vsi_l_offset>(m_nChunksPerShard) * 2 * sizeof(uint64_t);
+    VSIFSeekL(fp, 0, SEEK_END);
+    const vsi_l_offset nFileSize = VSIFTellL(fp);
+    if (nFileSize < nIndexSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Shard %s is too small to contain its index",
                  osFilename.c_str());
         return false;
     }
+    const vsi_l_offset nDataSize = nFileSize - nIndexSize;
 
-    bool bRet = true;
-    if (m_psCompressor == nullptr)
+    try
+    {
+        anIndex.resize(2 * m_nChunksPerShard);
+    }
+    catch (const std::bad_alloc &e)
     {
-        if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
-            nRawDataSize)
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+    if (VSIFSeekL(fp, nDataSize, SEEK_SET) != 0 ||
+        VSIFReadL(anIndex.data(), sizeof(uint64_t), anIndex.size(), fp) !=
+            anIndex.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read index of shard %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    for (size_t i = 0; i < m_nChunksPerShard; ++i)
+    {
+        CPL_LSBPTR64(&anIndex[2 * i]);
+        CPL_LSBPTR64(&anIndex[2 * i + 1]);
+        const uint64_t nOffset = anIndex[2 * i];
+        const uint64_t nSize = anIndex[2 * i + 1];
+        if (nOffset == SHARD_MISSING_CHUNK && nSize == SHARD_MISSING_CHUNK)
+            continue;
+        if (nOffset > nDataSize || nSize > nDataSize - nOffset)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
-                     "Could not write tile %s correctly", osFilename.c_str());
-            bRet = false;
+                     "Invalid index entry for chunk %u of shard %s",
+                     static_cast<unsigned>(i), osFilename.c_str());
+            return false;
         }
     }
-    else
+    return true;
+}
+
+/************************************************************************/
+/*                   ZarrArray::StoreChunkInShard()                     */
+/************************************************************************/
+
+// Buffer the encoded content of a chunk (empty if the chunk only contains
+// nodata values) until all chunks of its shard have been written.
+bool ZarrArray::StoreChunkInShard(const std::vector<uint64_t> &anTileIndices,
+                                  std::vector<GByte> &&abyEncodedData) const
+{
+    std::vector<uint64_t> anShardIndices;
+    const size_t nIdx =
+        GetChunkIndexInShard(anTileIndices.data(), anShardIndices);
+
+    auto &oBuffer = m_oMapShardBuffers[anShardIndices];
+    if (oBuffer.aabyChunks.empty())
     {
-        std::vector<GByte> abyCompressedData;
-        try
-        {
-            constexpr size_t MIN_BUF_SIZE = 64;  // somewhat arbitrary
-            abyCompressedData.resize(static_cast<size_t>(
-                MIN_BUF_SIZE + nRawDataSize + nRawDataSize / 3));
-        }
-        catch (const std::exception &)
+        oBuffer.aabyChunks.resize(m_nChunksPerShard);
+        oBuffer.abChunkSet.resize(m_nChunksPerShard);
+
+        // Shards at the edges of the array may be only partially filled
+        oBuffer.nChunksExpected = 1;
+        for (size_t i = 0; i < m_aoDims.size(); ++i)
         {
-            CPLError(CE_Failure, CPLE_OutOfMemory,
-                     "Cannot allocate memory for tile %s", osFilename.c_str());
-            bRet = false;
+            const uint64_t nTilesThisDim =
+                DIV_ROUND_UP(m_aoDims[i]->GetSize(), m_anBlockSize[i]);
+            const uint64_t nFirstTile =
+                anShardIndices[i] * m_anChunksPerShard[i];
+            oBuffer.nChunksExpected *= static_cast<size_t>(
+                std::min<uint64_t>(m_anChunksPerShard[i],
+                                   nTilesThisDim - nFirstTile));
         }
+    }
+
+    if (!oBuffer.abChunkSet[nIdx])
+    {
+        oBuffer.abChunkSet[nIdx] = true;
+        ++oBuffer.nChunksSet;
+    }
+    oBuffer.aabyChunks[nIdx] = std::move(abyEncodedData);
 
-        if (bRet)
+    if (oBuffer.nChunksSet < oBuffer.nChunksExpected)
+        return true;
+
+    const bool bRet = WriteShard(anShardIndices, oBuffer);
+    m_oMapShardBuffers.erase(anShardIndices);
+    return bRet;
+}
+
+/************************************************************************/
+/*                       ZarrArray::WriteShard()                        */
+/************************************************************************/
+
+bool ZarrArray::WriteShard(const std::vector<uint64_t> &anShardIndices,
+                           ShardBuffer &oBuffer) const
+{
+    const std::string osFilename = BuildTileFilename(anShardIndices.data());
+    const size_t nChunks = oBuffer.aabyChunks.size();
+
+    m_osCachedShardFilename.clear();
+    m_anCachedShardIndex.clear();
+
+    // If not all chunks of the shard have been written, fetch the other
+    // ones from the existing shard.
+    if (oBuffer.nChunksSet < oBuffer.nChunksExpected)
+    {
+        VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+        if (fp)
         {
-            void *out_buffer = &abyCompressedData[0];
-            size_t out_size = abyCompressedData.size();
-            CPLStringList aosOptions;
-            const auto compressorConfig =
-                m_nVersion == 2 ? m_oCompressorJSonV2
-                                : m_oCompressorJSonV3["configuration"];
-            for (const auto &obj : compressorConfig.GetChildren())
+            std::vector<uint64_t> anIndex;
+            bool bOK = ReadShardIndex(fp, osFilename, anIndex);
+            for (size_t i = 0; bOK && i < nChunks; ++i)
             {
-                aosOptions.SetNameValue(obj.GetName().c_str(),
-                                        obj.ToString().c_str());
-            }
-            if (EQUAL(m_psCompressor->pszId, "blosc") &&
-                m_oType.GetClass() == GEDTC_NUMERIC)
-            {
-                aosOptions.SetNameValue(
-                    "TYPESIZE",
-                    CPLSPrintf("%d", GDALGetDataTypeSizeBytes(
-                                         GDALGetNonComplexDataType(
-                                             m_oType.GetNumericDataType()))));
+                if (oBuffer.abChunkSet[i] ||
+                    anIndex[2 * i] == SHARD_MISSING_CHUNK)
+                {
+                    continue;
+                }
+                auto &abyChunk = oBuffer.aabyChunks[i];
+                try
+                {
+                    abyChunk.resize(static_cast<size_t>(anIndex[2 * i + 1]));
+                }
+                catch (const std::bad_alloc &e)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+                    bOK = false;
+                    break;
+                }
+                if (VSIFSeekL(fp, anIndex[2 * i], SEEK_SET) != 0 ||
+                    VSIFReadL(abyChunk.data(), 1, abyChunk.size(), fp) !=
+                        abyChunk.size())
+                {
+                    CPLError(CE_Failure, CPLE_FileIO,
+                             "Cannot read chunk %u of shard %s",
+                             static_cast<unsigned>(i), osFilename.c_str());
+                    bOK = false;
+                }
             }
+            VSIFCloseL(fp);
+            if (!bOK)
+                return false;
+        }
+    }
 
-            if (!m_psCompressor->pfnFunc(
-                    m_abyRawTileData.data(), nRawDataSize, &out_buffer,
-                    &out_size, aosOptions.List(), m_psCompressor->user_data))
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Compression of tile %s failed", osFilename.c_str());
-                bRet = false;
-            }
-            abyCompressedData.resize(out_size);
+    std::vector<uint64_t> anIndex(2 * nChunks, SHARD_MISSING_CHUNK);
+    uint64_t nOffset = 0;
+    for (size_t i = 0; i < nChunks; ++i)
+    {
+        const auto &abyChunk = oBuffer.aabyChunks[i];
+        if (abyChunk.empty())
+            continue;
+        anIndex[2 * i] = nOffset;
+        anIndex[2 * i + 1] = abyChunk.size();
+        nOffset += abyChunk.size();
+    }
+
+    if (nOffset == 0)
+    {
+        VSIStatBufL sStat;
+        if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+        {
+            CPLDebugOnly(ZARR_DEBUG_KEY,
+                         "Deleting shard %s that has now empty content",
+                         osFilename.c_str());
+            return VSIUnlink(osFilename.c_str()) == 0;
         }
+        return true;
+    }
 
-        if (bRet &&
-            VSIFWriteL(abyCompressedData.data(), 1, abyCompressedData.size(),
-                       fp) != abyCompressedData.size())
+    VSILFILE *fp = CreateTileFile(osFilename);
+    if (fp == nullptr)
+        return false;
+
+    bool bRet = true;
+    for (const auto &abyChunk : oBuffer.aabyChunks)
+    {
+        if (!abyChunk.empty() &&
+            VSIFWriteL(abyChunk.data(), 1, abyChunk.size(), fp) !=
+                abyChunk.size())
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Could not write tile %s correctly", osFilename.c_str());
             bRet = false;
+            break;
         }
     }
-    VSIFCloseL(fp);
-
+    for (auto &nVal : anIndex)
+    {
+        CPL_LSBPTR64(&nVal);
+    }
+    if (bRet && VSIFWriteL(anIndex.data(), sizeof(uint64_t), anIndex.size(),
+                           fp) != anIndex.size())
+    {
+        bRet = false;
+    }
+    if (VSIFCloseL(fp) != 0)
+        bRet = false;
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not write shard %s correctly", osFilename.c_str());
+    }
     return bRet;
 }
 
+/************************************************************************/
+/*                   ZarrArray::SetChunksPerShard()                     */
+/************************************************************************/
+
+bool ZarrArray::SetChunksPerShard(const std::vector<GUInt64> &anChunksPerShard)
+{
+    if (m_aoDims.empty() || anChunksPerShard.size() != m_aoDims.size())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid number of values in chunks_per_shard");
+        return false;
+    }
+
+    // Arbitrary limit, to bound the size of the shard index
+    constexpr size_t MAX_CHUNKS_PER_SHARD = 16 * 1024 * 1024;
+    size_t nChunksPerShard = 1;
+    for (const auto nVal : anChunksPerShard)
+    {
+        if (nVal == 0 || nVal > MAX_CHUNKS_PER_SHARD / nChunksPerShard)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid values in chunks_per_shard");
+            return false;
+        }
+        nChunksPerShard *= static_cast<size_t>(nVal);
+    }
+
+    m_anChunksPerShard = anChunksPerShard;
+    m_nChunksPerShard = nChunksPerShard;
+    return true;
+}
+
 /************************************************************************/
 /*                           ZarrArray::IRead()                         */
 /************************************************************************/
@@ -3981,6 +4609,41 @@ ZarrGroupBase::LoadArray(const std::string &osArrayName,
         }
     }
 
+    std::vector<GUInt64> anChunksPerShard;
+    if (!isZarrV2)
+    {
+        const auto oStorageTransformers = oRoot["storage_transformers"];
+        if (oStorageTransformers.GetType() == CPLJSONObject::Type::Array)
+        {
+            for (const auto &oTransformer : oStorageTransformers.ToArray())
+            {
+                const auto osExtension = oTransformer["extension"].ToString();
+                if (osExtension != SHARDING_EXTENSION ||
+                    oTransformer["type"].ToString() != "indexed" ||
+                    !anChunksPerShard.empty())
+                {
+                    CPLError(CE_Failure, CPLE_NotSupported,
+                             "Unsupported storage transformer: %s",
+                             osExtension.c_str());
+                    return nullptr;
+                }
+                const auto oChunksPerShard =
+                    oTransformer["configuration"]["chunks_per_shard"];
+                if (oChunksPerShard.GetType() != CPLJSONObject::Type::Array)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "chunks_per_shard missing or invalid");
+                    return nullptr;
+                }
+                for (const auto &oVal : oChunksPerShard.ToArray())
+                {
+                    anChunksPerShard.push_back(static_cast<GUInt64>(
+                        std::max<GInt64>(0, oVal.ToLong())));
+                }
+            }
+        }
+    }
+
     auto poArray = ZarrArray::Create(m_poSharedResource, GetFullName(),
                                      osArrayName, aoDims, oType, aoDtypeElts,
                                      anBlockSize, bFortranOrder);
@@ -3994,6 +4657,11 @@ ZarrGroupBase::LoadArray(const std::string &osArrayName,
     poArray->SetCompressorDecompressor(osDecompressorId, psCompressor,
                                        psDecompressor);
     poArray->SetFilters(oFiltersArray);
+    if (!anChunksPerShard.empty() &&
+        !poArray->SetChunksPerShard(anChunksPerShard))
+    {
+        return nullptr;
+    }
     if (!abyNoData.empty())
     {
         poArray->RegisterNoDataValue(abyNoData.data());
@@ -4144,40 +4812,176 @@ ZarrArray::OpenTilePresenceCache(bool bCanCreate) const
 }
 
 /************************************************************************/
-/*                    ZarrArray::CacheTilePresence()                    */
+/*                    ZarrArray::ParseTileFilename()                    */
 /************************************************************************/
 
-bool ZarrArray::CacheTilePresence()
+// Extract tile indices from a tile filename, relative to the data directory.
+bool ZarrArray::ParseTileFilename(const char *pszName,
+                                  std::vector<uint64_t> &anTileIdx) const
 {
-    if (m_nTotalTileCount == 1)
-        return true;
+    if (m_nVersion == 3)
+    {
+        if (pszName[0] != 'c')
+            return false;
+        ++pszName;
+    }
+    const CPLStringList aosTokens(
+        CSLTokenizeString2(pszName, m_osDimSeparator.c_str(), 0));
+    if (aosTokens.size() != static_cast<int>(m_aoDims.size()))
+        return false;
 
-    const std::string osDirectoryName = [this]()
+    anTileIdx.resize(m_aoDims.size());
+    for (int i = 0; i < aosTokens.size(); ++i)
     {
-        if (m_nVersion == 2)
-            return std::string(CPLGetDirname(m_osFilename.c_str()));
+        if (CPLGetValueType(aosTokens[i]) != CPL_VALUE_INTEGER)
+            return false;
+        anTileIdx[i] = static_cast<uint64_t>(CPLAtoGIntBig(aosTokens[i]));
+        if (anTileIdx[i] >=
+            DIV_ROUND_UP(m_aoDims[i]->GetSize(), m_anBlockSize[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
-        std::string osTmp = m_osRootDirectoryName + "/data/root";
-        if (GetFullName() != "/")
-            osTmp += GetFullName();
-        return osTmp;
-    }();
+/************************************************************************/
+/*                   ZarrArray::GetLinearTileIndex()                    */
+/************************************************************************/
 
-    struct DirCloser
+uint64_t ZarrArray::GetLinearTileIndex(const uint64_t *tileIndices) const
+{
+    uint64_t nIdx = 0;
+    for (size_t i = 0; i < m_aoDims.size(); ++i)
     {
-        DirCloser(const DirCloser &) = delete;
-        DirCloser &operator=(const DirCloser &) = delete;
+        nIdx = nIdx * DIV_ROUND_UP(m_aoDims[i]->GetSize(), m_anBlockSize[i]) +
+               tileIndices[i];
+    }
+    return nIdx;
+}
+
+/************************************************************************/
+/*                 ZarrArray::BuildTileExistenceIndex()                 */
+/************************************************************************/
+
+// Establish an in-memory bitmap of present tiles, either from the tile
+// presence cache, or from a single directory listing if the LIST_TILES open
+// option is set, so that reading missing tiles does not require any I/O.
+void ZarrArray::BuildTileExistenceIndex() const
+{
+    if (m_bTileExistenceIndexTried)
+        return;
+    m_bTileExistenceIndexTried = true;
 
-        VSIDIR *m_psDir;
+    if (m_nTotalTileCount <= 1 || !m_anChunksPerShard.empty())
+        return;
 
-        explicit DirCloser(VSIDIR *psDir) : m_psDir(psDir)
+    // Arbitrary limit to bound memory usage to 32 MB
+    constexpr uint64_t MAX_TILE_COUNT = 256 * 1024 * 1024;
+    if (m_nTotalTileCount > MAX_TILE_COUNT)
+    {
+        CPLDebug(ZARR_DEBUG_KEY,
+                 "Too many tiles in %s to build a tile existence index",
+                 GetFullName().c_str());
+        return;
+    }
+
+    const size_t nDims = m_aoDims.size();
+    std::vector<bool> abTileExists;
+    try
+    {
+        abTileExists.resize(static_cast<size_t>(m_nTotalTileCount));
+    }
+    catch (const std::bad_alloc &)
+    {
+        return;
+    }
+
+    auto poTilePresenceArray = OpenTilePresenceCache(false);
+    if (poTilePresenceArray)
+    {
+        std::vector<GByte> abyPresence;
+        try
         {
+            abyPresence.resize(static_cast<size_t>(m_nTotalTileCount));
         }
-        ~DirCloser()
+        catch (const std::bad_alloc &)
         {
-            VSICloseDir(m_psDir);
+            return;
         }
-    };
+        const std::vector<GUInt64> anStartIdx(nDims, 0);
+        std::vector<size_t> anCount;
+        for (const auto &poDim : poTilePresenceArray->GetDimensions())
+            anCount.push_back(static_cast<size_t>(poDim->GetSize()));
+        if (!poTilePresenceArray->Read(anStartIdx.data(), anCount.data(),
+                                       nullptr, nullptr,
+                                       GDALExtendedDataType::Create(GDT_Byte),
+                                       abyPresence.data()))
+        {
+            return;
+        }
+        for (size_t i = 0; i < abyPresence.size(); ++i)
+            abTileExists[i] = abyPresence[i] != 0;
+        CPLDebug(ZARR_DEBUG_KEY,
+                 "Tile existence index of %s built from tile presence cache",
+                 GetFullName().c_str());
+    }
+    else if (CPLTestBool(m_poSharedResource->GetOpenOptions().FetchNameValueDef(
+                 "LIST_TILES", "NO")))
+    {
+        const std::string osDirectoryName = GetDataDirectoryName();
+        auto psDir = VSIOpenDir(osDirectoryName.c_str(), -1, nullptr);
+        if (!psDir)
+        {
+            CPLDebug(ZARR_DEBUG_KEY, "Cannot list %s",
+                     osDirectoryName.c_str());
+            return;
+        }
+        DirCloser dirCloser(psDir);
+
+        uint64_t nCounter = 0;
+        std::vector<uint64_t> anTileIdx;
+        while (const VSIDIREntry *psEntry = VSIGetNextDirEntry(psDir))
+        {
+            if (!VSI_ISDIR(psEntry->nMode) &&
+                ParseTileFilename(psEntry->pszName, anTileIdx))
+            {
+                abTileExists[static_cast<size_t>(
+                    GetLinearTileIndex(anTileIdx.data()))] = true;
+                ++nCounter;
+            }
+        }
+        CPLDebug(ZARR_DEBUG_KEY,
+                 "Tile existence index of %s built from directory listing: "
+                 CPL_FRMT_GUIB " tiles present out of " CPL_FRMT_GUIB,
+                 GetFullName().c_str(), static_cast<GUIntBig>(nCounter),
+                 static_cast<GUIntBig>(m_nTotalTileCount));
+    }
+    else
+    {
+        return;
+    }
+
+    m_abTileExists = std::move(abTileExists);
+}
+
+/************************************************************************/
+/*                    ZarrArray::CacheTilePresence()                    */
+/************************************************************************/
+
+bool ZarrArray::CacheTilePresence()
+{
+    if (m_nTotalTileCount == 1)
+        return true;
+
+    if (!m_anChunksPerShard.empty())
+    {
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "Tile presence cache is not supported for sharded arrays");
+        return false;
+    }
+
+    const std::string osDirectoryName = GetDataDirectoryName();
 
     auto psDir = VSIOpenDir(osDirectoryName.c_str(), -1, nullptr);
     if (!psDir)
@@ -4198,11 +5002,11 @@ bool ZarrArray::CacheTilePresence()
         return true;
     }
 
+    std::vector<uint64_t> anParsedTileIdx;
     std::vector<GUInt64> anTileIdx(m_aoDims.size());
     const std::vector<size_t> anCount(m_aoDims.size(), 1);
     const std::vector<GInt64> anArrayStep(m_aoDims.size(), 0);
     const std::vector<GPtrDiff_t> anBufferStride(m_aoDims.size(), 0);
-    const auto apoDimsCache = poTilePresenceArray->GetDimensions();
     const auto eByteDT = GDALExtendedDataType::Create(GDT_Byte);
 
     CPLDebug(ZARR_DEBUG_KEY,
@@ -4214,36 +5018,11 @@ bool ZarrArray::CacheTilePresence()
     {
         if (!VSI_ISDIR(psEntry->nMode))
         {
-            int nOff = 0;
-            if (m_nVersion == 3)
-            {
-                if (psEntry->pszName[0] != 'c')
-                    continue;
-                nOff = 1;
-            }
-            const CPLStringList aosTokens(CSLTokenizeString2(
-                psEntry->pszName + nOff, m_osDimSeparator.c_str(), 0));
-            if (aosTokens.size() == static_cast<int>(m_aoDims.size()))
+            // Get tile indices from filename
+            if (ParseTileFilename(psEntry->pszName, anParsedTileIdx))
             {
-                // Get tile indices from filename
-                bool unexpectedIndex = false;
-                for (int i = 0; i < aosTokens.size(); ++i)
-                {
-                    if (CPLGetValueType(aosTokens[i]) != CPL_VALUE_INTEGER)
-                    {
-                        unexpectedIndex = true;
-                    }
-                    anTileIdx[i] =
-                        static_cast<GUInt64>(CPLAtoGIntBig(aosTokens[i]));
-                    if (anTileIdx[i] >= apoDimsCache[i]->GetSize())
-                    {
-                        unexpectedIndex = true;
-                    }
-                }
-                if (unexpectedIndex)
-                {
-                    continue;
-                }
+                for (size_t i = 0; i < m_aoDims.size(); ++i)
+                    anTileIdx[i] = static_cast<GUInt64>(anParsedTileIdx[i]);
 
                 nCounter++;
                 if ((nCounter % 1000) == 0)
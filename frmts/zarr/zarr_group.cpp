@@ -1121,6 +1121,13 @@ std::shared_ptr<GDALMDArray> ZarrGroupV2::CreateMDArray(
         return nullptr;
     }
 
+    if (CSLFetchNameValue(papszOptions, "CHUNKS_PER_SHARD"))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "CHUNKS_PER_SHARD option not supported with Zarr V2");
+        return nullptr;
+    }
+
     std::vector<DtypeElt> aoDtypeElts;
     constexpr bool bZarrV2 = true;
     const bool bUseUnicode =
@@ -1835,6 +1842,20 @@ std::shared_ptr<GDALMDArray> ZarrGroupV3::CreateMDArray(
     const char *pszDimSeparator =
         CSLFetchNameValueDef(papszOptions, "DIM_SEPARATOR", "/");
 
+    std::vector<GUInt64> anChunksPerShard;
+    const char *pszChunksPerShard =
+        CSLFetchNameValue(papszOptions, "CHUNKS_PER_SHARD");
+    if (pszChunksPerShard)
+    {
+        const CPLStringList aosTokens(
+            CSLTokenizeString2(pszChunksPerShard, ",", 0));
+        for (int i = 0; i < aosTokens.size(); ++i)
+        {
+            anChunksPerShard.push_back(static_cast<GUInt64>(
+                std::max<GIntBig>(0, CPLAtoGIntBig(aosTokens[i]))));
+        }
+    }
+
     auto poArray = ZarrArray::Create(m_poSharedResource, GetFullName(), osName,
                                      aoDimensions, oDataType, aoDtypeElts,
                                      anBlockSize, bFortranOrder);
@@ -1851,6 +1872,8 @@ std::shared_ptr<GDALMDArray> ZarrGroupV3::CreateMDArray(
                                        psDecompressor);
     if (oCompressor.IsValid())
         poArray->SetCompressorJsonV3(oCompressor);
+    if (pszChunksPerShard && !poArray->SetChunksPerShard(anChunksPerShard))
+        return nullptr;
     poArray->SetUpdatable(true);
     poArray->SetDefinitionModified(true);
     RegisterArray(poArray);
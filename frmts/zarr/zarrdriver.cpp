@@ -718,6 +718,16 @@ void ZarrDriver::InitMetadata()
             "Dimension separator in chunk filenames. Default to decimal point "
             "for ZarrV2 and slash for ZarrV3");
 
+        auto psChunksPerShardNode =
+            CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
+        CPLAddXMLAttributeAndValue(psChunksPerShardNode, "name",
+                                   "CHUNKS_PER_SHARD");
+        CPLAddXMLAttributeAndValue(psChunksPerShardNode, "type", "string");
+        CPLAddXMLAttributeAndValue(
+            psChunksPerShardNode, "description",
+            "Comma separated list of the number of chunks per shard along "
+            "each dimension (only for ZARR_V3)");
+
         for (auto iter = compressors; iter && *iter; ++iter)
         {
             const auto psCompressor = CPLGetCompressor(*iter);
@@ -1469,6 +1479,10 @@ void GDALRegister_Zarr()
         "   <Option name='CACHE_TILE_PRESENCE' type='boolean' "
         "description='Whether to establish an initial listing of present "
         "tiles' default='NO'/>"
+        "   <Option name='LIST_TILES' type='boolean' "
+        "description='Whether to list present tiles with a single directory "
+        "listing when first reading an array, to avoid accessing missing "
+        "tiles' default='NO'/>"
         "</OpenOptionList>");
 
     poDriver->SetMetadataItem(
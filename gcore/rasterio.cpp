@@ -56,6 +56,10 @@
 #include "memdataset.h"
 #include "vrtdataset.h"
 
+#ifdef HAVE_SSSE3_AT_COMPILE_TIME
+#include "rasterio_ssse3.h"
+#endif
+
 static void GDALFastCopyByte(const GByte *CPL_RESTRICT pSrcData,
                              int nSrcPixelStride, GByte *CPL_RESTRICT pDstData,
                              int nDstPixelStride, GPtrDiff_t nWordCount);
@@ -1985,6 +1989,16 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
     GByte *pabyData = static_cast<GByte *>(pData);
 
+#if defined(HAVE_SSSE3_AT_COMPILE_TIME) &&                                     \
+    (defined(__x86_64) || defined(_M_X64))
+    if ((nWordSize == 2 || nWordSize == 4 || nWordSize == 8) &&
+        nWordSkip == nWordSize && nWordCount >= 16 && CPLHaveRuntimeSSSE3())
+    {
+        GDALSwapWordsPacked_SSSE3(pabyData, nWordSize, nWordCount);
+        return;
+    }
+#endif
+
     switch (nWordSize)
     {
         case 1:
@@ -5226,10 +5240,6 @@ bool GDALBufferHasOnlyNoData(const void *pBuffer, double dfNoDataValue,
 
 #include <emmintrin.h>
 
-#ifdef HAVE_SSSE3_AT_COMPILE_TIME
-#include "rasterio_ssse3.h"
-#endif
-
 /************************************************************************/
 /*                    GDALDeinterleave3Byte()                           */
 /************************************************************************/
@@ -36,6 +36,8 @@
 #include <tmmintrin.h>
 #include "gdal_priv_templates.hpp"
 
+#include <utility>
+
 void GDALUnrolledCopy_GByte_3_1_SSSE3(GByte *CPL_RESTRICT pDest,
                                       const GByte *CPL_RESTRICT pSrc,
                                       GPtrDiff_t nIters)
@@ -80,6 +82,58 @@ void GDALUnrolledCopy_GByte_3_1_SSSE3(GByte *CPL_RESTRICT pDest,
     }
 }
 
+/************************************************************************/
+/*                     GDALSwapWordsPacked_SSSE3()                      */
+/************************************************************************/
+
+// Byte swap contiguous 2, 4 or 8 byte words in place.
+void GDALSwapWordsPacked_SSSE3(GByte *pabyData, int nWordSize,
+                               size_t nWordCount)
+{
+    const __m128i xmm_shuffle =
+        (nWordSize == 2)
+            ? _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1)
+        : (nWordSize == 4)
+            ? _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3)
+            : _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6,
+                           7);
+    const size_t nBytes = nWordCount * nWordSize;
+    size_t i = 0;
+    for (; i + 63 < nBytes; i += 64)
+    {
+        __m128i xmm0 =
+            _mm_loadu_si128(reinterpret_cast<__m128i const *>(pabyData + i));
+        __m128i xmm1 = _mm_loadu_si128(
+            reinterpret_cast<__m128i const *>(pabyData + i + 16));
+        __m128i xmm2 = _mm_loadu_si128(
+            reinterpret_cast<__m128i const *>(pabyData + i + 32));
+        __m128i xmm3 = _mm_loadu_si128(
+            reinterpret_cast<__m128i const *>(pabyData + i + 48));
+        xmm0 = _mm_shuffle_epi8(xmm0, xmm_shuffle);
+        xmm1 = _mm_shuffle_epi8(xmm1, xmm_shuffle);
+        xmm2 = _mm_shuffle_epi8(xmm2, xmm_shuffle);
+        xmm3 = _mm_shuffle_epi8(xmm3, xmm_shuffle);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyData + i), xmm0);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyData + i + 16), xmm1);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyData + i + 32), xmm2);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyData + i + 48), xmm3);
+    }
+    for (; i + 15 < nBytes; i += 16)
+    {
+        __m128i xmm0 =
+            _mm_loadu_si128(reinterpret_cast<__m128i const *>(pabyData + i));
+        xmm0 = _mm_shuffle_epi8(xmm0, xmm_shuffle);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyData + i), xmm0);
+    }
+    for (; i < nBytes; i += nWordSize)
+    {
+        for (int j = 0; j < nWordSize / 2; ++j)
+        {
+            std::swap(pabyData[i + j], pabyData[i + nWordSize - 1 - j]);
+        }
+    }
+}
+
 /************************************************************************/
 /*                  GDALDeinterleave3Byte_SSSE3()                       */
 /************************************************************************/
@@ -38,6 +38,9 @@ void GDALUnrolledCopy_GByte_3_1_SSSE3(GByte *CPL_RESTRICT pDest,
                                       const GByte *CPL_RESTRICT pSrc,
                                       GPtrDiff_t nIters);
 
+void GDALSwapWordsPacked_SSSE3(GByte *pabyData, int nWordSize,
+                               size_t nWordCount);
+
 void GDALDeinterleave3Byte_SSSE3(const GByte *CPL_RESTRICT pabySrc,
                                  GByte *CPL_RESTRICT pabyDest0,
                                  GByte *CPL_RESTRICT pabyDest1,
@@ -311,6 +311,8 @@ RawRasterBand::~RawRasterBand()
         }
     }
 
+    ReleaseMappedData();
+
     CPLFree(pLineBuffer);
 }
 
@@ -349,9 +351,109 @@ bool RawRasterBand::IsBIP() const
 
 void RawRasterBand::SetAccess(GDALAccess eAccessIn)
 {
+    // Writes go through the buffered VSILFILE API, so a read-only mapping
+    // could expose stale content.
+    if (eAccessIn == GA_Update)
+        ReleaseMappedData();
     eAccess = eAccessIn;
 }
 
+/************************************************************************/
+/*                           GetMappedData()                            */
+/*                                                                      */
+/*      Return the address of nImgOffset in a read-only memory          */
+/*      mapping of the file, or nullptr if the file cannot (or          */
+/*      should not) be mapped. The mapping is created on first use.     */
+/************************************************************************/
+
+const GByte *RawRasterBand::GetMappedData()
+{
+    if (m_bMappingAttempted)
+    {
+        return m_poMappedData ? static_cast<const GByte *>(
+                                    CPLVirtualMemGetAddr(m_poMappedData))
+                              : nullptr;
+    }
+    m_bMappingAttempted = true;
+
+    if (eAccess != GA_ReadOnly || nPixelOffset <= 0 || nLineOffset <= 0 ||
+        fpRawL == nullptr || !CPLIsVirtualMemFileMapAvailable() ||
+        VSIFGetNativeFileDescriptorL(fpRawL) == nullptr ||
+        !CPLTestBool(CPLGetConfigOption("GDAL_RAW_USE_MMAP",
+#if SIZEOF_VOIDP == 8
+                                        "YES"
+#else
+                                        "NO"
+#endif
+                                        )))
+    {
+        return nullptr;
+    }
+
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    vsi_l_offset nSize =
+        static_cast<vsi_l_offset>(nRasterYSize - 1) * nLineOffset +
+        static_cast<vsi_l_offset>(nRasterXSize - 1) * nPixelOffset + nDTSize;
+
+    const bool bIsBIP = poDS != nullptr && IsBIP();
+    RawRasterBand *poFirstBand = nullptr;
+    if (bIsBIP && nBand > 1)
+    {
+        poFirstBand = cpl::down_cast<RawRasterBand *>(poDS->GetRasterBand(1));
+        if (poFirstBand->fpRawL != fpRawL)
+            poFirstBand = nullptr;
+    }
+    else if (bIsBIP)
+    {
+        // Cover the whole last pixel so that the other bands can derive
+        // their mapping from this one.
+        nSize += std::min(nPixelOffset, poDS->GetRasterCount() * nDTSize) -
+                 nDTSize;
+    }
+    if (static_cast<size_t>(nSize) != nSize)
+        return nullptr;
+
+    if (poFirstBand != nullptr)
+    {
+        if (poFirstBand->GetMappedData() == nullptr)
+            return nullptr;
+        const vsi_l_offset nShift = nImgOffset - poFirstBand->nImgOffset;
+        if (nShift + nSize >
+            CPLVirtualMemGetSize(poFirstBand->m_poMappedData))
+            return nullptr;
+        m_poMappedData = CPLVirtualMemDerivedNew(
+            poFirstBand->m_poMappedData, nShift, nSize, nullptr, nullptr);
+    }
+    else
+    {
+        // Fails on truncated files, in which case the regular code path
+        // is used.
+        CPLErrorStateBackuper oErrorStateBackuper;
+        CPLErrorHandlerPusher oErrorHandlerPusher(CPLQuietErrorHandler);
+        m_poMappedData = CPLVirtualMemFileMapNew(
+            fpRawL, nImgOffset, nSize, VIRTUALMEM_READONLY, nullptr, nullptr);
+    }
+    if (m_poMappedData == nullptr)
+        return nullptr;
+
+    CPLDebug("RAW", "Band %d: using memory mapped reads", nBand);
+    return static_cast<const GByte *>(CPLVirtualMemGetAddr(m_poMappedData));
+}
+
+/************************************************************************/
+/*                         ReleaseMappedData()                          */
+/************************************************************************/
+
+void RawRasterBand::ReleaseMappedData()
+{
+    if (m_poMappedData)
+    {
+        CPLVirtualMemFree(m_poMappedData);
+        m_poMappedData = nullptr;
+    }
+    m_bMappingAttempted = false;
+}
+
 /************************************************************************/
 /*                             FlushCache()                             */
 /*                                                                      */
@@ -424,6 +526,12 @@ void RawRasterBand::DoByteSwap(void *pBuffer, size_t nValues, int nByteSkip,
         if (GDALDataTypeIsComplex(eDataType))
         {
             const int nWordSize = GDALGetDataTypeSize(eDataType) / 16;
+            if (nByteSkip == 2 * nWordSize)
+            {
+                // Packed values: swap real and imaginary parts in one pass
+                GDALSwapWordsEx(pBuffer, nWordSize, 2 * nValues, nWordSize);
+                return;
+            }
             GDALSwapWordsEx(pBuffer, nWordSize, nValues, nByteSkip);
             GDALSwapWordsEx(static_cast<GByte *>(pBuffer) + nWordSize,
                             nWordSize, nValues, nByteSkip);
@@ -616,13 +724,73 @@ CPLErr RawRasterBand::IReadBlock(CPL_UNUSED int nBlockXOff, int nBlockYOff,
     if (eErr == CE_Failure)
         return eErr;
 
-    // Copy data from disk buffer to user block buffer.
     const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const bool bIsBIP =
+        poDS != nullptr && poDS->GetRasterCount() > 1 && IsBIP();
+
+    // For pixel interleaved datasets without padding, deinterleave the line
+    // in one go into the blocks of all bands, when none of them is cached
+    // yet. This is restricted to read-only mode, where getting a block
+    // cannot cause the line buffer to be reloaded by a flush.
+    if (bIsBIP && eAccess == GA_ReadOnly &&
+        nPixelOffset == poDS->GetRasterCount() * nDTSize)
+    {
+        const int nBands = poDS->GetRasterCount();
+        std::vector<RawRasterBand *> apoOtherBands;
+        std::vector<GDALRasterBlock *> apoBlocks;
+        std::vector<void *> apDstBuffers;
+        for (int iBand = 1; iBand <= nBands; iBand++)
+        {
+            if (iBand == nBand)
+            {
+                apDstBuffers.push_back(pImage);
+                continue;
+            }
+            auto poOtherBand =
+                cpl::down_cast<RawRasterBand *>(poDS->GetRasterBand(iBand));
+            GDALRasterBlock *poBlock =
+                poOtherBand->TryGetLockedBlockRef(0, nBlockYOff);
+            if (poBlock != nullptr)
+            {
+                poBlock->DropLock();
+                break;
+            }
+            poBlock = poOtherBand->GetLockedBlockRef(0, nBlockYOff, true);
+            if (poBlock == nullptr)
+                break;
+            apoOtherBands.push_back(poOtherBand);
+            apoBlocks.push_back(poBlock);
+            apDstBuffers.push_back(poBlock->GetDataRef());
+        }
+
+        const bool bAllBands = static_cast<int>(apDstBuffers.size()) == nBands;
+        if (bAllBands)
+        {
+            const auto poFirstBand =
+                cpl::down_cast<RawRasterBand *>(poDS->GetRasterBand(1));
+            GDALDeinterleave(poFirstBand->pLineStart, eDataType, nBands,
+                             apDstBuffers.data(), eDataType, nBlockXSize);
+        }
+        for (size_t i = 0; i < apoBlocks.size(); ++i)
+        {
+            if (!bAllBands)
+            {
+                GDALCopyWords(apoOtherBands[i]->pLineStart, eDataType,
+                              nPixelOffset, apoBlocks[i]->GetDataRef(),
+                              eDataType, nDTSize, nBlockXSize);
+            }
+            apoBlocks[i]->DropLock();
+        }
+        if (bAllBands)
+            return eErr;
+    }
+
+    // Copy data from disk buffer to user block buffer.
     GDALCopyWords(pLineStart, eDataType, nPixelOffset, pImage, eDataType,
                   nDTSize, nBlockXSize);
 
     // Pre-cache block cache of other bands
-    if (poDS != nullptr && poDS->GetRasterCount() > 1 && IsBIP())
+    if (bIsBIP)
     {
         for (int iBand = 1; iBand <= poDS->GetRasterCount(); iBand++)
         {
@@ -1028,6 +1196,60 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 #endif
     const int nBufDataSize = GDALGetDataTypeSizeBytes(eBufType);
 
+    // Read straight from the memory mapped file when possible, bypassing
+    // both the line buffer and the block cache.
+    const GByte *pabyMappedData = nullptr;
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize &&
+        (pabyMappedData = GetMappedData()) != nullptr)
+    {
+        const bool bNeedsByteOrderChange = NeedsByteOrderChange();
+        // Byte swapping is done in place in the output buffer when it has
+        // the band data type, and in a temporary line otherwise.
+        const bool bSwapInOutput = eBufType == eDataType &&
+                                   std::abs(nPixelSpace) >= nBandDataSize;
+        std::vector<GByte> abyLine;
+        if (bNeedsByteOrderChange && !bSwapInOutput)
+            abyLine.resize(static_cast<size_t>(nXSize) * nBandDataSize);
+
+        for (int iLine = 0; iLine < nYSize; iLine++)
+        {
+            const GByte *pabySrc =
+                pabyMappedData +
+                static_cast<size_t>(nYOff + iLine) * nLineOffset +
+                static_cast<size_t>(nXOff) * nPixelOffset;
+            GByte *pabyDst = static_cast<GByte *>(pData) + iLine * nLineSpace;
+            if (!bNeedsByteOrderChange)
+            {
+                GDALCopyWords(pabySrc, eDataType, nPixelOffset, pabyDst,
+                              eBufType, static_cast<int>(nPixelSpace), nXSize);
+            }
+            else if (bSwapInOutput)
+            {
+                GDALCopyWords(pabySrc, eDataType, nPixelOffset, pabyDst,
+                              eBufType, static_cast<int>(nPixelSpace), nXSize);
+                DoByteSwap(pabyDst, nXSize, static_cast<int>(nPixelSpace),
+                           true);
+            }
+            else
+            {
+                GDALCopyWords(pabySrc, eDataType, nPixelOffset, abyLine.data(),
+                              eDataType, nBandDataSize, nXSize);
+                DoByteSwap(abyLine.data(), nXSize, nBandDataSize, true);
+                GDALCopyWords(abyLine.data(), eDataType, nBandDataSize,
+                              pabyDst, eBufType, static_cast<int>(nPixelSpace),
+                              nXSize);
+            }
+
+            if (psExtraArg->pfnProgress != nullptr &&
+                !psExtraArg->pfnProgress(1.0 * (iLine + 1) / nYSize, "",
+                                         psExtraArg->pProgressData))
+            {
+                return CE_Failure;
+            }
+        }
+        return CE_None;
+    }
+
     if (!CanUseDirectIO(nXOff, nYOff, nXSize, nYSize, eBufType, psExtraArg))
     {
         return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
@@ -1629,21 +1851,35 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
             const bool bNeedsByteOrderChange =
                 poFirstBand->NeedsByteOrderChange();
+            const GByte *pabyMappedData = poFirstBand->GetMappedData();
             for (int iY = 0; iY < nYSize; ++iY)
             {
                 GByte *pabyOut = static_cast<GByte *>(pData) + iY * nLineSpace;
-                VSIFSeekL(poFirstBand->fpRawL,
-                          poFirstBand->nImgOffset +
-                              static_cast<vsi_l_offset>(nYOff + iY) *
-                                  poFirstBand->nLineOffset +
-                              static_cast<vsi_l_offset>(nXOff) *
-                                  poFirstBand->nPixelOffset,
-                          SEEK_SET);
-                if (VSIFReadL(pabyOut,
-                              static_cast<size_t>(nXSize * nPixelSpace), 1,
-                              poFirstBand->fpRawL) != 1)
+                if (pabyMappedData != nullptr)
                 {
-                    return CE_Failure;
+                    memcpy(pabyOut,
+                           pabyMappedData +
+                               static_cast<size_t>(nYOff + iY) *
+                                   poFirstBand->nLineOffset +
+                               static_cast<size_t>(nXOff) *
+                                   poFirstBand->nPixelOffset,
+                           static_cast<size_t>(nXSize * nPixelSpace));
+                }
+                else
+                {
+                    VSIFSeekL(poFirstBand->fpRawL,
+                              poFirstBand->nImgOffset +
+                                  static_cast<vsi_l_offset>(nYOff + iY) *
+                                      poFirstBand->nLineOffset +
+                                  static_cast<vsi_l_offset>(nXOff) *
+                                      poFirstBand->nPixelOffset,
+                              SEEK_SET);
+                    if (VSIFReadL(pabyOut,
+                                  static_cast<size_t>(nXSize * nPixelSpace), 1,
+                                  poFirstBand->fpRawL) != 1)
+                    {
+                        return CE_Failure;
+                    }
                 }
                 if (bNeedsByteOrderChange)
                 {
@@ -123,6 +123,9 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
                                         // modified content that needs to
                                         // be pushed to disk
 
+    CPLVirtualMem *m_poMappedData = nullptr;  // read-only file mapping
+    bool m_bMappingAttempted = false;
+
     GDALColorTable *poCT{};
     GDALColorInterp eInterp = GCI_Undefined;
 
@@ -228,6 +231,8 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
                     bool bDiskToCPU) const;
     bool IsBIP() const;
     vsi_l_offset ComputeFileOffset(int iLine) const;
+    const GByte *GetMappedData();
+    void ReleaseMappedData();
     bool FlushCurrentLine(bool bNeedUsableBufferAfter);
     CPLErr BIPWriteBlock(int nBlockYOff, int nCallingBand, const void *pImage);
 };
@@ -1646,6 +1646,8 @@ class CPL_DLL OGRGlobFieldDomain final : public OGRFieldDomain
 class OGRLayer;
 class swq_expr_node;
 class swq_custom_func_registrar;
+struct ArrowSchema;
+struct ArrowArray;
 
 class CPL_DLL OGRFeatureQuery
 {
@@ -1653,6 +1655,9 @@ class CPL_DLL OGRFeatureQuery
     OGRFeatureDefn *poTargetDefn;
     void *pSWQExpr;
 
+    // Flattened form of pSWQExpr, evaluated without allocations
+    void *pCompiledExpr;
+
     char **FieldCollector(void *, char **);
 
     GIntBig *EvaluateAgainstIndices(swq_expr_node *, OGRLayer *,
@@ -1674,6 +1679,9 @@ class CPL_DLL OGRFeatureQuery
     OGRErr Compile(OGRFeatureDefn *, const char *, int bCheck = TRUE,
                    swq_custom_func_registrar *poCustomFuncRegistrar = nullptr);
     int Evaluate(OGRFeature *);
+    bool EvaluateArrowArray(const struct ArrowSchema *,
+                            const struct ArrowArray *,
+                            std::vector<bool> &abRetain);
 
     GIntBig *EvaluateAgainstIndices(OGRLayer *, OGRErr *);
 
@@ -30,7 +30,9 @@
 #include "ogr_wkb.h"
 #include "ogr_core.h"
 #include "ogr_p.h"
+#include "ogr_spatialref.h"
 
+#include <algorithm>
 #include <cmath>
 #include <climits>
 
@@ -212,6 +214,374 @@ bool OGRWKBMultiPolygonGetArea(const GByte *&pabyWkb, size_t &nWKBSize,
     return false;
 }
 
+/************************************************************************/
+/*                     OGRWKBGetBoundingBoxInternal()                   */
+/************************************************************************/
+
+static bool OGRWKBGetBoundingBoxInternal(const GByte *&pabyWkb,
+                                         size_t &nWKBSize, int nRec,
+                                         OGREnvelope3D &sEnvelope)
+{
+    // Arbitrary nesting limit, consistent with OGRGeometryFactory
+    if (nWKBSize < 5 || nRec == 128)
+        return false;
+    const bool bNeedSwap = OGRWKBNeedSwap(pabyWkb[0]);
+    OGRwkbGeometryType eGeometryType = wkbUnknown;
+    if (OGRReadWKBGeometryType(pabyWkb, wkbVariantIso, &eGeometryType) !=
+        OGRERR_NONE)
+        return false;
+    const bool bHasZ = OGR_GT_HasZ(eGeometryType) != FALSE;
+    const int nDim = 2 + (bHasZ ? 1 : 0) + (OGR_GT_HasM(eGeometryType) ? 1 : 0);
+    const auto eFlatType = wkbFlatten(eGeometryType);
+    pabyWkb += 5;
+    nWKBSize -= 5;
+
+    const auto MergePoints = [&pabyWkb, &nWKBSize, nDim, bHasZ, bNeedSwap,
+                              &sEnvelope]()
+    {
+        if (nWKBSize < sizeof(uint32_t))
+            return false;
+        const uint32_t nPoints = OGRWKBReadUInt32(pabyWkb, bNeedSwap);
+        pabyWkb += sizeof(uint32_t);
+        nWKBSize -= sizeof(uint32_t);
+        if (nWKBSize / (nDim * sizeof(double)) < nPoints)
+            return false;
+        for (uint32_t i = 0; i < nPoints; ++i)
+        {
+            const double dfX = OGRWKBReadFloat64(pabyWkb, bNeedSwap);
+            const double dfY =
+                OGRWKBReadFloat64(pabyWkb + sizeof(double), bNeedSwap);
+            sEnvelope.MinX = std::min(sEnvelope.MinX, dfX);
+            sEnvelope.MaxX = std::max(sEnvelope.MaxX, dfX);
+            sEnvelope.MinY = std::min(sEnvelope.MinY, dfY);
+            sEnvelope.MaxY = std::max(sEnvelope.MaxY, dfY);
+            if (bHasZ)
+            {
+                const double dfZ =
+                    OGRWKBReadFloat64(pabyWkb + 2 * sizeof(double), bNeedSwap);
+                sEnvelope.MinZ = std::min(sEnvelope.MinZ, dfZ);
+                sEnvelope.MaxZ = std::max(sEnvelope.MaxZ, dfZ);
+            }
+            pabyWkb += nDim * sizeof(double);
+        }
+        nWKBSize -= static_cast<size_t>(nPoints) * nDim * sizeof(double);
+        return true;
+    };
+
+    switch (eFlatType)
+    {
+        case wkbPoint:
+        {
+            if (nWKBSize < nDim * sizeof(double))
+                return false;
+            const double dfX = OGRWKBReadFloat64(pabyWkb, bNeedSwap);
+            const double dfY =
+                OGRWKBReadFloat64(pabyWkb + sizeof(double), bNeedSwap);
+            // POINT EMPTY is encoded with NaN coordinates
+            if (!std::isnan(dfX))
+            {
+                sEnvelope.MinX = std::min(sEnvelope.MinX, dfX);
+                sEnvelope.MaxX = std::max(sEnvelope.MaxX, dfX);
+                sEnvelope.MinY = std::min(sEnvelope.MinY, dfY);
+                sEnvelope.MaxY = std::max(sEnvelope.MaxY, dfY);
+                if (bHasZ)
+                {
+                    const double dfZ = OGRWKBReadFloat64(
+                        pabyWkb + 2 * sizeof(double), bNeedSwap);
+                    sEnvelope.MinZ = std::min(sEnvelope.MinZ, dfZ);
+                    sEnvelope.MaxZ = std::max(sEnvelope.MaxZ, dfZ);
+                }
+            }
+            pabyWkb += nDim * sizeof(double);
+            nWKBSize -= nDim * sizeof(double);
+            return true;
+        }
+
+        case wkbLineString:
+        case wkbCircularString:
+            return MergePoints();
+
+        case wkbPolygon:
+        case wkbTriangle:
+        {
+            if (nWKBSize < sizeof(uint32_t))
+                return false;
+            const uint32_t nRings = OGRWKBReadUInt32(pabyWkb, bNeedSwap);
+            pabyWkb += sizeof(uint32_t);
+            nWKBSize -= sizeof(uint32_t);
+            if (nWKBSize / sizeof(uint32_t) < nRings)
+                return false;
+            for (uint32_t i = 0; i < nRings; ++i)
+            {
+                if (!MergePoints())
+                    return false;
+            }
+            return true;
+        }
+
+        case wkbMultiPoint:
+        case wkbMultiLineString:
+        case wkbMultiPolygon:
+        case wkbGeometryCollection:
+        case wkbCompoundCurve:
+        case wkbCurvePolygon:
+        case wkbMultiCurve:
+        case wkbMultiSurface:
+        case wkbPolyhedralSurface:
+        case wkbTIN:
+        {
+            if (nWKBSize < sizeof(uint32_t))
+                return false;
+            const uint32_t nGeoms = OGRWKBReadUInt32(pabyWkb, bNeedSwap);
+            pabyWkb += sizeof(uint32_t);
+            nWKBSize -= sizeof(uint32_t);
+            if (nWKBSize / 5 < nGeoms)
+                return false;
+            for (uint32_t i = 0; i < nGeoms; ++i)
+            {
+                if (!OGRWKBGetBoundingBoxInternal(pabyWkb, nWKBSize, nRec + 1,
+                                                  sEnvelope))
+                    return false;
+            }
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                        OGRWKBGetBoundingBox()                        */
+/************************************************************************/
+
+/** Computes the bounding box of a WKB geometry, without instantiating it.
+ *
+ * ISO and "25D" WKB variants are accepted. For curve geometries, the bounding
+ * box is computed from the control points, and may thus be smaller than the
+ * one returned by OGRGeometry::getEnvelope().
+ *
+ * @param pabyWkb WKB content.
+ * @param nWKBSize Size of the WKB content, in bytes.
+ * @param sEnvelope Computed envelope. Not initialized for an empty geometry.
+ *                  The Z extent is only initialized for geometries with a Z
+ *                  dimension.
+ * @return true in case of success.
+ */
+bool OGRWKBGetBoundingBox(const GByte *pabyWkb, size_t nWKBSize,
+                          OGREnvelope3D &sEnvelope)
+{
+    sEnvelope = OGREnvelope3D();
+    return OGRWKBGetBoundingBoxInternal(pabyWkb, nWKBSize, 0, sEnvelope);
+}
+
+/************************************************************************/
+/*                      OGRWKBTransformCollect()                        */
+/************************************************************************/
+
+constexpr GByte WKB_TRANSFORM_FLAG_SWAP = 1;
+constexpr GByte WKB_TRANSFORM_FLAG_Z = 2;
+
+static bool OGRWKBTransformCollect(const GByte *pabyWkbStart,
+                                   const GByte *&pabyWkb, size_t &nWKBSize,
+                                   int nRec, OGRWKBTransformCache &oCache)
+{
+    // Arbitrary nesting limit, consistent with OGRGeometryFactory
+    if (nWKBSize < 5 || nRec == 128)
+        return false;
+    const bool bNeedSwap = OGRWKBNeedSwap(pabyWkb[0]);
+    OGRwkbGeometryType eGeometryType = wkbUnknown;
+    if (OGRReadWKBGeometryType(pabyWkb, wkbVariantIso, &eGeometryType) !=
+        OGRERR_NONE)
+        return false;
+    const bool bHasZ = OGR_GT_HasZ(eGeometryType) != FALSE;
+    const int nDim = 2 + (bHasZ ? 1 : 0) + (OGR_GT_HasM(eGeometryType) ? 1 : 0);
+    const GByte nFlags =
+        static_cast<GByte>((bNeedSwap ? WKB_TRANSFORM_FLAG_SWAP : 0) |
+                           (bHasZ ? WKB_TRANSFORM_FLAG_Z : 0));
+    const auto eFlatType = wkbFlatten(eGeometryType);
+    pabyWkb += 5;
+    nWKBSize -= 5;
+
+    const auto CollectPoints =
+        [pabyWkbStart, &pabyWkb, &nWKBSize, nDim, nFlags, bNeedSwap, &oCache]()
+    {
+        if (nWKBSize < sizeof(uint32_t))
+            return false;
+        const uint32_t nPoints = OGRWKBReadUInt32(pabyWkb, bNeedSwap);
+        pabyWkb += sizeof(uint32_t);
+        nWKBSize -= sizeof(uint32_t);
+        if (nWKBSize / (nDim * sizeof(double)) < nPoints)
+            return false;
+        for (uint32_t i = 0; i < nPoints; ++i)
+        {
+            oCache.anOffsets.push_back(
+                static_cast<size_t>(pabyWkb - pabyWkbStart));
+            oCache.abyFlags.push_back(nFlags);
+            pabyWkb += nDim * sizeof(double);
+        }
+        nWKBSize -= static_cast<size_t>(nPoints) * nDim * sizeof(double);
+        return true;
+    };
+
+    switch (eFlatType)
+    {
+        case wkbPoint:
+        {
+            if (nWKBSize < nDim * sizeof(double))
+                return false;
+            // POINT EMPTY is encoded with NaN coordinates
+            if (!std::isnan(OGRWKBReadFloat64(pabyWkb, bNeedSwap)))
+            {
+                oCache.anOffsets.push_back(
+                    static_cast<size_t>(pabyWkb - pabyWkbStart));
+                oCache.abyFlags.push_back(nFlags);
+            }
+            pabyWkb += nDim * sizeof(double);
+            nWKBSize -= nDim * sizeof(double);
+            return true;
+        }
+
+        case wkbLineString:
+        case wkbCircularString:
+            return CollectPoints();
+
+        case wkbPolygon:
+        case wkbTriangle:
+        {
+            if (nWKBSize < sizeof(uint32_t))
+                return false;
+            const uint32_t nRings = OGRWKBReadUInt32(pabyWkb, bNeedSwap);
+            pabyWkb += sizeof(uint32_t);
+            nWKBSize -= sizeof(uint32_t);
+            if (nWKBSize / sizeof(uint32_t) < nRings)
+                return false;
+            for (uint32_t i = 0; i < nRings; ++i)
+            {
+                if (!CollectPoints())
+                    return false;
+            }
+            return true;
+        }
+
+        case wkbMultiPoint:
+        case wkbMultiLineString:
+        case wkbMultiPolygon:
+        case wkbGeometryCollection:
+        case wkbCompoundCurve:
+        case wkbCurvePolygon:
+        case wkbMultiCurve:
+        case wkbMultiSurface:
+        case wkbPolyhedralSurface:
+        case wkbTIN:
+        {
+            if (nWKBSize < sizeof(uint32_t))
+                return false;
+            const uint32_t nGeoms = OGRWKBReadUInt32(pabyWkb, bNeedSwap);
+            pabyWkb += sizeof(uint32_t);
+            nWKBSize -= sizeof(uint32_t);
+            if (nWKBSize / 5 < nGeoms)
+                return false;
+            for (uint32_t i = 0; i < nGeoms; ++i)
+            {
+                if (!OGRWKBTransformCollect(pabyWkbStart, pabyWkb, nWKBSize,
+                                            nRec + 1, oCache))
+                    return false;
+            }
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                          OGRWKBTransform()                           */
+/************************************************************************/
+
+/** Reprojects in place the coordinates of a WKB geometry, without
+ * instantiating it.
+ *
+ * All the points of the geometry are transformed with a single call to
+ * OGRCoordinateTransformation::Transform(). M values are left untouched.
+ * ISO and "25D" WKB variants are accepted.
+ *
+ * @param pabyWkb WKB content, modified in place.
+ * @param nWKBSize Size of the WKB content, in bytes.
+ * @param poCT Coordinate transformation.
+ * @param oCache Working buffers, that may be reused between calls.
+ * @return true in case of success. On failure, the content of pabyWkb is
+ *         left unmodified.
+ */
+bool OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
+                     OGRCoordinateTransformation *poCT,
+                     OGRWKBTransformCache &oCache)
+{
+    oCache.anOffsets.clear();
+    oCache.abyFlags.clear();
+    const GByte *pabyIter = pabyWkb;
+    size_t nRemaining = nWKBSize;
+    if (!OGRWKBTransformCollect(pabyWkb, pabyIter, nRemaining, 0, oCache))
+        return false;
+
+    const size_t nPoints = oCache.anOffsets.size();
+    if (nPoints == 0)
+        return true;
+    if (nPoints > static_cast<size_t>(INT_MAX))
+        return false;
+    oCache.adfX.resize(nPoints);
+    oCache.adfY.resize(nPoints);
+    oCache.adfZ.resize(nPoints);
+    oCache.abSuccess.resize(nPoints);
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        const GByte *pabyPoint = pabyWkb + oCache.anOffsets[i];
+        const GByte nFlags = oCache.abyFlags[i];
+        const bool bNeedSwap = (nFlags & WKB_TRANSFORM_FLAG_SWAP) != 0;
+        oCache.adfX[i] = OGRWKBReadFloat64(pabyPoint, bNeedSwap);
+        oCache.adfY[i] =
+            OGRWKBReadFloat64(pabyPoint + sizeof(double), bNeedSwap);
+        oCache.adfZ[i] = (nFlags & WKB_TRANSFORM_FLAG_Z) != 0
+                             ? OGRWKBReadFloat64(pabyPoint + 2 * sizeof(double),
+                                                 bNeedSwap)
+                             : 0.0;
+    }
+
+    if (!poCT->Transform(static_cast<int>(nPoints), oCache.adfX.data(),
+                         oCache.adfY.data(), oCache.adfZ.data(), nullptr,
+                         oCache.abSuccess.data()))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        if (!oCache.abSuccess[i])
+            return false;
+    }
+
+    const auto WriteFloat64 = [](GByte *pabyDst, double dfVal, bool bNeedSwap)
+    {
+        if (bNeedSwap)
+            CPL_SWAP64PTR(&dfVal);
+        memcpy(pabyDst, &dfVal, sizeof(dfVal));
+    };
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        GByte *pabyPoint = pabyWkb + oCache.anOffsets[i];
+        const GByte nFlags = oCache.abyFlags[i];
+        const bool bNeedSwap = (nFlags & WKB_TRANSFORM_FLAG_SWAP) != 0;
+        WriteFloat64(pabyPoint, oCache.adfX[i], bNeedSwap);
+        WriteFloat64(pabyPoint + sizeof(double), oCache.adfY[i], bNeedSwap);
+        if ((nFlags & WKB_TRANSFORM_FLAG_Z) != 0)
+            WriteFloat64(pabyPoint + 2 * sizeof(double), oCache.adfZ[i],
+                         bNeedSwap);
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                            WKBFromEWKB()                             */
 /************************************************************************/
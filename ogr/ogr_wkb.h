@@ -30,6 +30,11 @@
 #define OGR_WKB_H_INCLUDED
 
 #include "cpl_port.h"
+#include "ogr_core.h"
+
+#include <vector>
+
+class OGRCoordinateTransformation;
 
 bool OGRWKBGetGeomType(const GByte *pabyWkb, size_t nWKBSize, bool &bNeedSwap,
                        uint32_t &nType);
@@ -37,6 +42,24 @@ bool OGRWKBPolygonGetArea(const GByte *&pabyWkb, size_t &nWKBSize,
                           double &dfArea);
 bool OGRWKBMultiPolygonGetArea(const GByte *&pabyWkb, size_t &nWKBSize,
                                double &dfArea);
+bool CPL_DLL OGRWKBGetBoundingBox(const GByte *pabyWkb, size_t nWKBSize,
+                                  OGREnvelope3D &sEnvelope);
+
+/** Working buffers of OGRWKBTransform(), which may be reused across calls
+ * to avoid reallocations. */
+struct OGRWKBTransformCache
+{
+    std::vector<size_t> anOffsets{};
+    std::vector<GByte> abyFlags{};
+    std::vector<double> adfX{};
+    std::vector<double> adfY{};
+    std::vector<double> adfZ{};
+    std::vector<int> abSuccess{};
+};
+
+bool CPL_DLL OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
+                             OGRCoordinateTransformation *poCT,
+                             OGRWKBTransformCache &oCache);
 
 /** Modifies a PostGIS-style Extended WKB geometry to a regular WKB one.
  * pabyEWKB will be modified in place.
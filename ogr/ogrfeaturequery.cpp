@@ -32,9 +32,13 @@
 #include "ogr_feature.h"
 #include "ogr_swq.h"
 
+#include <cctype>
 #include <cstddef>
 #include <cstdlib>
 #include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -42,6 +46,7 @@
 #include "ogr_attrind.h"
 #include "ogr_core.h"
 #include "ogr_p.h"
+#include "ogr_recordbatch.h"
 #include "ogrsf_frmts.h"
 
 //! @cond Doxygen_Suppress
@@ -55,11 +60,106 @@ const char *const SpecialFieldNames[SPECIAL_FIELD_COUNT] = {
 const swq_field_type SpecialFieldTypes[SPECIAL_FIELD_COUNT] = {
     SWQ_INTEGER, SWQ_STRING, SWQ_STRING, SWQ_STRING, SWQ_FLOAT};
 
+/************************************************************************/
+/*                             CompiledExpr                             */
+/*                                                                      */
+/*      Flattened form of the logical operators and comparisons of a    */
+/*      WHERE expression, with constants converted once to the type    */
+/*      of the comparison. It is evaluated directly on the raw fields   */
+/*      of a feature, or on the columns of an Arrow array, without      */
+/*      creating swq_expr_node values. Sub-expressions that cannot be   */
+/*      compiled (functions, arithmetic, LIKE, dates, ...) are kept as  */
+/*      GENERIC nodes evaluated by swq_expr_node::Evaluate().           */
+/*                                                                      */
+/*      OGRFeatureQuery::pCompiledExpr points to an instance of it.     */
+/************************************************************************/
+
+namespace
+{
+struct CompiledExpr
+{
+    enum class NodeType
+    {
+        AND,
+        OR,
+        NOT,
+        COMPARE,
+        IN,
+        BETWEEN,
+        IS_NULL,
+        COLUMN,
+        GENERIC
+    };
+
+    enum class ValueType
+    {
+        INTEGER,
+        FLOAT,
+        STRING
+    };
+
+    static constexpr int FID_COLUMN = -1;
+
+    // Field read by the expression
+    struct Column
+    {
+        int iField = 0;  // OGR field index, or FID_COLUMN
+        OGRFieldType eType = OFTInteger;
+    };
+
+    // Column or constant argument of a node
+    struct Operand
+    {
+        int iColumn = -1;  // index in aoColumns, or -1 for a constant
+        bool bIsNull = false;
+        GIntBig nVal = 0;
+        double dfVal = 0;
+        std::string osVal{};
+    };
+
+    struct Node
+    {
+        NodeType eType = NodeType::GENERIC;
+        swq_op eOp = SWQ_EQ;
+        ValueType eValueType = ValueType::INTEGER;
+        bool bMayBeNull = false;
+        std::vector<int> anChildren{};
+        std::vector<Operand> aoOperands{};
+        std::unique_ptr<swq_expr_node> poGeneric{};
+    };
+
+    struct FeatureReader;
+    struct ArrowReader;
+
+    OGRFeatureDefn *poDefn = nullptr;
+    std::vector<Column> aoColumns{};
+    std::vector<Node> aoNodes{};
+    bool bHasGeneric = false;
+
+    static std::unique_ptr<CompiledExpr> Build(swq_expr_node *poExpr,
+                                               OGRFeatureDefn *poDefn);
+    int BuildNode(swq_expr_node *poExpr, int nRecLevel);
+    bool BuildComparison(swq_expr_node *poExpr, Node &oNode);
+    bool BuildColumn(const swq_expr_node *poExpr, Operand &oOperand);
+    bool IsValid() const;
+
+    // Returns TRUE, FALSE, or -1 for a NULL value
+    template <class Reader>
+    int Evaluate(const Reader &oReader, const Node &oNode) const;
+
+    template <class Reader>
+    int EvaluateComparison(const Reader &oReader, const Node &oNode) const;
+
+    int EvaluateRoot(const FeatureReader &oReader) const;
+};
+}  // namespace
+
 /************************************************************************/
 /*                          OGRFeatureQuery()                           */
 /************************************************************************/
 
-OGRFeatureQuery::OGRFeatureQuery() : poTargetDefn(nullptr), pSWQExpr(nullptr)
+OGRFeatureQuery::OGRFeatureQuery()
+    : poTargetDefn(nullptr), pSWQExpr(nullptr), pCompiledExpr(nullptr)
 {
 }
 
@@ -71,6 +171,7 @@ OGRFeatureQuery::~OGRFeatureQuery()
 
 {
     delete static_cast<swq_expr_node *>(pSWQExpr);
+    delete static_cast<CompiledExpr *>(pCompiledExpr);
 }
 
 /************************************************************************/
@@ -111,6 +212,8 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
                          swq_custom_func_registrar *poCustomFuncRegistrar)
 {
     // Clear any existing expression.
+    delete static_cast<CompiledExpr *>(pCompiledExpr);
+    pCompiledExpr = nullptr;
     if (pSWQExpr != nullptr)
     {
         delete static_cast<swq_expr_node *>(pSWQExpr);
@@ -236,6 +339,14 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
     CPLFree(papszFieldNames);
     CPLFree(paeFieldTypes);
 
+    if (pSWQExpr != nullptr &&
+        CPLTestBool(CPLGetConfigOption("OGR_SQL_COMPILE_WHERE", "YES")))
+    {
+        pCompiledExpr =
+            CompiledExpr::Build(static_cast<swq_expr_node *>(pSWQExpr), poDefn)
+                .release();
+    }
+
     return eErr;
 }
 
@@ -307,6 +418,633 @@ static swq_expr_node *OGRFeatureFetcher(swq_expr_node *op, void *pFeatureIn)
     return poRetNode;
 }
 
+/************************************************************************/
+/*                        CompiledExpr::Build()                         */
+/************************************************************************/
+
+std::unique_ptr<CompiledExpr> CompiledExpr::Build(swq_expr_node *poExpr,
+                                                 OGRFeatureDefn *poDefn)
+{
+    auto poCompiled = cpl::make_unique<CompiledExpr>();
+    poCompiled->poDefn = poDefn;
+    poCompiled->BuildNode(poExpr, 0);
+
+    // Nothing to gain if the whole expression is evaluated generically
+    if (poCompiled->aoNodes.back().eType == NodeType::GENERIC)
+        return nullptr;
+    return poCompiled;
+}
+
+/************************************************************************/
+/*                      CompiledExpr::BuildNode()                       */
+/*                                                                      */
+/*      Append the node for poExpr, after the nodes of its children,    */
+/*      and return its index.                                           */
+/************************************************************************/
+
+int CompiledExpr::BuildNode(swq_expr_node *poExpr, int nRecLevel)
+{
+    Node oNode;
+
+    // Deeply nested expressions are left to swq_expr_node::Evaluate(),
+    // which errors out on them.
+    if (nRecLevel >= 32)
+    {
+        // GENERIC node
+    }
+    else if (poExpr->eNodeType == SNT_OPERATION)
+    {
+        switch (poExpr->nOperation)
+        {
+            case SWQ_AND:
+            case SWQ_OR:
+            case SWQ_NOT:
+            {
+                if (poExpr->nSubExprCount !=
+                    (poExpr->nOperation == SWQ_NOT ? 1 : 2))
+                    break;
+                oNode.eType = poExpr->nOperation == SWQ_AND  ? NodeType::AND
+                              : poExpr->nOperation == SWQ_OR ? NodeType::OR
+                                                             : NodeType::NOT;
+                for (int i = 0; i < poExpr->nSubExprCount; i++)
+                {
+                    oNode.anChildren.push_back(
+                        BuildNode(poExpr->papoSubExpr[i], nRecLevel + 1));
+                }
+                break;
+            }
+
+            case SWQ_EQ:
+            case SWQ_NE:
+            case SWQ_LT:
+            case SWQ_LE:
+            case SWQ_GT:
+            case SWQ_GE:
+            case SWQ_IN:
+            case SWQ_BETWEEN:
+            {
+                if (BuildComparison(poExpr, oNode))
+                {
+                    oNode.eType = poExpr->nOperation == SWQ_IN ? NodeType::IN
+                                  : poExpr->nOperation == SWQ_BETWEEN
+                                      ? NodeType::BETWEEN
+                                      : NodeType::COMPARE;
+                    oNode.eOp = poExpr->nOperation;
+                }
+                break;
+            }
+
+            case SWQ_ISNULL:
+            {
+                Operand oOperand;
+                if (poExpr->nSubExprCount == 1 &&
+                    poExpr->papoSubExpr[0]->eNodeType == SNT_COLUMN &&
+                    BuildColumn(poExpr->papoSubExpr[0], oOperand))
+                {
+                    oNode.eType = NodeType::IS_NULL;
+                    oNode.aoOperands.push_back(std::move(oOperand));
+                }
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+    else if (poExpr->eNodeType == SNT_COLUMN &&
+             (SWQ_IS_INTEGER(poExpr->field_type) ||
+              poExpr->field_type == SWQ_BOOLEAN))
+    {
+        Operand oOperand;
+        if (BuildColumn(poExpr, oOperand) &&
+            aoColumns[oOperand.iColumn].eType != OFTReal &&
+            aoColumns[oOperand.iColumn].eType != OFTString)
+        {
+            oNode.eType = NodeType::COLUMN;
+            oNode.bMayBeNull = true;
+            oNode.aoOperands.push_back(std::move(oOperand));
+        }
+    }
+
+    if (oNode.eType == NodeType::GENERIC)
+    {
+        oNode = Node();
+        oNode.bMayBeNull = true;
+        oNode.poGeneric.reset(poExpr->Clone());
+        bHasGeneric = true;
+    }
+
+    aoNodes.push_back(std::move(oNode));
+    return static_cast<int>(aoNodes.size()) - 1;
+}
+
+/************************************************************************/
+/*                     CompiledExpr::BuildColumn()                      */
+/************************************************************************/
+
+bool CompiledExpr::BuildColumn(const swq_expr_node *poExpr,
+                               Operand &oOperand)
+{
+    Column oColumn;
+    const int nFieldCount = poDefn->GetFieldCount();
+    const int iField =
+        OGRFeatureFetcherFixFieldIndex(poDefn, poExpr->field_index);
+    if (iField == nFieldCount + SPF_FID)
+    {
+        // Only when OGRFeatureFetcher() would not truncate it to 32 bit
+        if (poExpr->field_type != SWQ_INTEGER64)
+            return false;
+        oColumn.iField = FID_COLUMN;
+        oColumn.eType = OFTInteger64;
+    }
+    else if (iField >= 0 && iField < nFieldCount)
+    {
+        oColumn.iField = iField;
+        oColumn.eType = poDefn->GetFieldDefn(iField)->GetType();
+        if (oColumn.eType != OFTInteger && oColumn.eType != OFTInteger64 &&
+            oColumn.eType != OFTReal && oColumn.eType != OFTString)
+            return false;
+    }
+    else
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < aoColumns.size(); i++)
+    {
+        if (aoColumns[i].iField == oColumn.iField)
+        {
+            oOperand.iColumn = static_cast<int>(i);
+            return true;
+        }
+    }
+    oOperand.iColumn = static_cast<int>(aoColumns.size());
+    aoColumns.push_back(oColumn);
+    return true;
+}
+
+/************************************************************************/
+/*                   CompiledExpr::BuildComparison()                    */
+/*                                                                      */
+/*      Compile a comparison between columns and constants, following   */
+/*      the type rules of SWQGeneralEvaluator().                        */
+/************************************************************************/
+
+bool CompiledExpr::BuildComparison(swq_expr_node *poExpr, Node &oNode)
+{
+    const int nArgs = poExpr->nSubExprCount;
+    if (nArgs < 2 || (poExpr->nOperation == SWQ_BETWEEN && nArgs != 3) ||
+        (poExpr->nOperation != SWQ_IN && poExpr->nOperation != SWQ_BETWEEN &&
+         nArgs != 2))
+        return false;
+
+    const swq_field_type eType0 = poExpr->papoSubExpr[0]->field_type;
+    const swq_field_type eType1 = poExpr->papoSubExpr[1]->field_type;
+    if (eType0 == SWQ_FLOAT || eType1 == SWQ_FLOAT)
+        oNode.eValueType = ValueType::FLOAT;
+    else if (SWQ_IS_INTEGER(eType0) || eType0 == SWQ_BOOLEAN)
+        oNode.eValueType = ValueType::INTEGER;
+    else if (eType0 == SWQ_STRING)
+        oNode.eValueType = ValueType::STRING;
+    else
+        return false;
+
+    int nColumns = 0;
+    for (int i = 0; i < nArgs; i++)
+    {
+        const swq_expr_node *poSubExpr = poExpr->papoSubExpr[i];
+        const swq_field_type eType = poSubExpr->field_type;
+        const bool bIsInteger = SWQ_IS_INTEGER(eType) || eType == SWQ_BOOLEAN;
+        if (!(oNode.eValueType == ValueType::FLOAT
+                  ? (bIsInteger || eType == SWQ_FLOAT)
+              : oNode.eValueType == ValueType::INTEGER ? bIsInteger
+                                                       : eType == SWQ_STRING))
+        {
+            return false;
+        }
+
+        Operand oOperand;
+        if (poSubExpr->eNodeType == SNT_COLUMN)
+        {
+            if (!BuildColumn(poSubExpr, oOperand))
+                return false;
+            const OGRFieldType eFieldType = aoColumns[oOperand.iColumn].eType;
+            if ((oNode.eValueType == ValueType::STRING) !=
+                    (eFieldType == OFTString) ||
+                (oNode.eValueType == ValueType::INTEGER &&
+                 eFieldType == OFTReal))
+                return false;
+            nColumns++;
+        }
+        else if (poSubExpr->eNodeType == SNT_CONSTANT)
+        {
+            oOperand.bIsNull = CPL_TO_BOOL(poSubExpr->is_null);
+            oOperand.nVal = poSubExpr->int_value;
+            oOperand.dfVal = eType == SWQ_FLOAT
+                                 ? poSubExpr->float_value
+                                 : static_cast<double>(poSubExpr->int_value);
+            if (oNode.eValueType == ValueType::STRING && !oOperand.bIsNull)
+            {
+                if (poSubExpr->string_value == nullptr)
+                    return false;
+                oOperand.osVal = poSubExpr->string_value;
+
+                // SWQGeneralEvaluator() has special rules for the equality
+                // of strings looking like timestamps with time zones.
+                const size_t nLen = oOperand.osVal.size();
+                if (poExpr->nOperation == SWQ_EQ && nLen > 3 &&
+                    (oOperand.osVal[nLen - 3] == ':' ||
+                     oOperand.osVal.compare(nLen - 3, 3, "+00") == 0))
+                    return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+        oNode.aoOperands.push_back(std::move(oOperand));
+    }
+
+    // Same as above for the comparison of two columns
+    if (poExpr->nOperation == SWQ_EQ &&
+        oNode.eValueType == ValueType::STRING && nColumns > 1)
+        return false;
+
+    return true;
+}
+
+/************************************************************************/
+/*                       CompiledExpr::IsValid()                        */
+/*                                                                      */
+/*      Check that the fields did not change since compilation.         */
+/************************************************************************/
+
+bool CompiledExpr::IsValid() const
+{
+    const int nFieldCount = poDefn->GetFieldCountUnsafe();
+    for (const auto &oColumn : aoColumns)
+    {
+        if (oColumn.iField != FID_COLUMN &&
+            (oColumn.iField >= nFieldCount ||
+             poDefn->GetFieldDefnUnsafe(oColumn.iField)->GetType() !=
+                 oColumn.eType))
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      OGRFeatureQueryStrCaseCmp()                     */
+/*                                                                      */
+/*      strcasecmp() for strings that are not nul-terminated.           */
+/************************************************************************/
+
+static int OGRFeatureQueryStrCaseCmp(const char *pszA, size_t nLenA,
+                                     const char *pszB, size_t nLenB)
+{
+    const size_t nLen = std::min(nLenA, nLenB);
+    for (size_t i = 0; i < nLen; i++)
+    {
+        const int chA = tolower(static_cast<unsigned char>(pszA[i]));
+        const int chB = tolower(static_cast<unsigned char>(pszB[i]));
+        if (chA != chB)
+            return chA - chB;
+    }
+    return nLenA < nLenB ? -1 : nLenA > nLenB ? 1 : 0;
+}
+
+/************************************************************************/
+/*                     CompiledExpr::FeatureReader                      */
+/************************************************************************/
+
+struct CompiledExpr::FeatureReader
+{
+    const std::vector<Column> &aoColumns;
+    OGRFeature *poFeature;
+
+    bool IsNull(int iColumn) const
+    {
+        const Column &oColumn = aoColumns[iColumn];
+        if (oColumn.iField == FID_COLUMN)
+            return poFeature->GetFID() == OGRNullFID;
+        return !poFeature->IsFieldSetAndNotNullUnsafe(oColumn.iField);
+    }
+
+    GIntBig GetInteger(int iColumn) const
+    {
+        const Column &oColumn = aoColumns[iColumn];
+        if (oColumn.iField == FID_COLUMN)
+            return poFeature->GetFID();
+        const OGRField *psField = poFeature->GetRawFieldRef(oColumn.iField);
+        return oColumn.eType == OFTInteger ? psField->Integer
+                                           : psField->Integer64;
+    }
+
+    double GetDouble(int iColumn) const
+    {
+        const Column &oColumn = aoColumns[iColumn];
+        if (oColumn.eType == OFTReal)
+            return poFeature->GetRawFieldRef(oColumn.iField)->Real;
+        return static_cast<double>(GetInteger(iColumn));
+    }
+
+    const char *GetString(int iColumn, size_t &nLen) const
+    {
+        const char *pszVal =
+            poFeature->GetRawFieldRef(aoColumns[iColumn].iField)->String;
+        nLen = strlen(pszVal);
+        return pszVal;
+    }
+
+    int EvaluateGeneric(swq_expr_node *poExpr) const
+    {
+        swq_expr_node *poResult =
+            poExpr->Evaluate(OGRFeatureFetcher, poFeature);
+        if (poResult == nullptr)
+            return -1;
+        int nRet = -1;
+        if (!poResult->is_null && (SWQ_IS_INTEGER(poResult->field_type) ||
+                                   poResult->field_type == SWQ_BOOLEAN))
+            nRet = poResult->int_value != 0;
+        delete poResult;
+        return nRet;
+    }
+};
+
+/************************************************************************/
+/*                      CompiledExpr::ArrowReader                       */
+/************************************************************************/
+
+struct CompiledExpr::ArrowReader
+{
+    // Indexed like aoColumns
+    std::vector<const struct ArrowArray *> apoArrays{};
+    std::vector<char> achFormats{};
+    int64_t nParentOffset = 0;
+    int64_t iRow = 0;
+
+    int64_t GetIndex(int iColumn) const
+    {
+        return apoArrays[iColumn]->offset + nParentOffset + iRow;
+    }
+
+    bool IsNull(int iColumn) const
+    {
+        const struct ArrowArray *psArray = apoArrays[iColumn];
+        const GByte *pabyValidity =
+            static_cast<const GByte *>(psArray->buffers[0]);
+        if (psArray->null_count == 0 || pabyValidity == nullptr)
+            return false;
+        const int64_t nIdx = GetIndex(iColumn);
+        return (pabyValidity[nIdx / 8] & (1 << (nIdx % 8))) == 0;
+    }
+
+    GIntBig GetInteger(int iColumn) const
+    {
+        const void *pValues = apoArrays[iColumn]->buffers[1];
+        const int64_t nIdx = GetIndex(iColumn);
+        switch (achFormats[iColumn])
+        {
+            case 'b':
+                return (static_cast<const GByte *>(pValues)[nIdx / 8] >>
+                        (nIdx % 8)) &
+                       1;
+            case 'c':
+                return static_cast<const int8_t *>(pValues)[nIdx];
+            case 's':
+                return static_cast<const int16_t *>(pValues)[nIdx];
+            case 'i':
+                return static_cast<const int32_t *>(pValues)[nIdx];
+            default:
+                return static_cast<const int64_t *>(pValues)[nIdx];
+        }
+    }
+
+    double GetDouble(int iColumn) const
+    {
+        const void *pValues = apoArrays[iColumn]->buffers[1];
+        const int64_t nIdx = GetIndex(iColumn);
+        switch (achFormats[iColumn])
+        {
+            case 'f':
+                return static_cast<const float *>(pValues)[nIdx];
+            case 'g':
+                return static_cast<const double *>(pValues)[nIdx];
+            default:
+                return static_cast<double>(GetInteger(iColumn));
+        }
+    }
+
+    const char *GetString(int iColumn, size_t &nLen) const
+    {
+        const struct ArrowArray *psArray = apoArrays[iColumn];
+        const int64_t nIdx = GetIndex(iColumn);
+        const char *pachData = static_cast<const char *>(psArray->buffers[2]);
+        if (achFormats[iColumn] == 'u')
+        {
+            const auto panOffsets =
+                static_cast<const int32_t *>(psArray->buffers[1]);
+            nLen = static_cast<size_t>(panOffsets[nIdx + 1] - panOffsets[nIdx]);
+            return pachData + panOffsets[nIdx];
+        }
+        const auto panOffsets =
+            static_cast<const int64_t *>(psArray->buffers[1]);
+        nLen = static_cast<size_t>(panOffsets[nIdx + 1] - panOffsets[nIdx]);
+        return pachData + panOffsets[nIdx];
+    }
+
+    int EvaluateGeneric(swq_expr_node *) const
+    {
+        // EvaluateArrowArray() refuses expressions with GENERIC nodes
+        return -1;
+    }
+};
+
+/************************************************************************/
+/*                  CompiledExpr::EvaluateComparison()                  */
+/************************************************************************/
+
+template <class Reader>
+int CompiledExpr::EvaluateComparison(const Reader &oReader,
+                                     const Node &oNode) const
+{
+    // Comparisons involving a NULL value are false
+    for (const auto &oOperand : oNode.aoOperands)
+    {
+        if (oOperand.bIsNull ||
+            (oOperand.iColumn >= 0 && oReader.IsNull(oOperand.iColumn)))
+            return FALSE;
+    }
+
+    const auto &aoOperands = oNode.aoOperands;
+    const size_t nOperands = aoOperands.size();
+    switch (oNode.eValueType)
+    {
+        case ValueType::INTEGER:
+        {
+            const auto GetValue = [&oReader, &aoOperands](size_t i)
+            {
+                return aoOperands[i].iColumn >= 0
+                           ? oReader.GetInteger(aoOperands[i].iColumn)
+                           : aoOperands[i].nVal;
+            };
+            const GIntBig nVal = GetValue(0);
+            if (oNode.eType == NodeType::IN)
+            {
+                for (size_t i = 1; i < nOperands; i++)
+                {
+                    if (nVal == GetValue(i))
+                        return TRUE;
+                }
+                return FALSE;
+            }
+            if (oNode.eType == NodeType::BETWEEN)
+                return nVal >= GetValue(1) && nVal <= GetValue(2);
+            const GIntBig nOther = GetValue(1);
+            return oNode.eOp == SWQ_EQ   ? nVal == nOther
+                   : oNode.eOp == SWQ_NE ? nVal != nOther
+                   : oNode.eOp == SWQ_LT ? nVal < nOther
+                   : oNode.eOp == SWQ_LE ? nVal <= nOther
+                   : oNode.eOp == SWQ_GT ? nVal > nOther
+                                         : nVal >= nOther;
+        }
+
+        case ValueType::FLOAT:
+        {
+            const auto GetValue = [&oReader, &aoOperands](size_t i)
+            {
+                return aoOperands[i].iColumn >= 0
+                           ? oReader.GetDouble(aoOperands[i].iColumn)
+                           : aoOperands[i].dfVal;
+            };
+            const double dfVal = GetValue(0);
+            if (oNode.eType == NodeType::IN)
+            {
+                for (size_t i = 1; i < nOperands; i++)
+                {
+                    if (dfVal == GetValue(i))
+                        return TRUE;
+                }
+                return FALSE;
+            }
+            if (oNode.eType == NodeType::BETWEEN)
+                return dfVal >= GetValue(1) && dfVal <= GetValue(2);
+            const double dfOther = GetValue(1);
+            return oNode.eOp == SWQ_EQ   ? dfVal == dfOther
+                   : oNode.eOp == SWQ_NE ? dfVal != dfOther
+                   : oNode.eOp == SWQ_LT ? dfVal < dfOther
+                   : oNode.eOp == SWQ_LE ? dfVal <= dfOther
+                   : oNode.eOp == SWQ_GT ? dfVal > dfOther
+                                         : dfVal >= dfOther;
+        }
+
+        case ValueType::STRING:
+        {
+            size_t nLen = 0;
+            const char *pszVal =
+                aoOperands[0].iColumn >= 0
+                    ? oReader.GetString(aoOperands[0].iColumn, nLen)
+                    : (nLen = aoOperands[0].osVal.size(),
+                       aoOperands[0].osVal.c_str());
+            const auto Compare = [&oReader, &aoOperands, pszVal, nLen](size_t i)
+            {
+                size_t nOtherLen = 0;
+                const char *pszOther =
+                    aoOperands[i].iColumn >= 0
+                        ? oReader.GetString(aoOperands[i].iColumn, nOtherLen)
+                        : (nOtherLen = aoOperands[i].osVal.size(),
+                           aoOperands[i].osVal.c_str());
+                return OGRFeatureQueryStrCaseCmp(pszVal, nLen, pszOther,
+                                                 nOtherLen);
+            };
+            if (oNode.eType == NodeType::IN)
+            {
+                for (size_t i = 1; i < nOperands; i++)
+                {
+                    if (Compare(i) == 0)
+                        return TRUE;
+                }
+                return FALSE;
+            }
+            if (oNode.eType == NodeType::BETWEEN)
+                return Compare(1) >= 0 && Compare(2) <= 0;
+            const int nRes = Compare(1);
+            return oNode.eOp == SWQ_EQ   ? nRes == 0
+                   : oNode.eOp == SWQ_NE ? nRes != 0
+                   : oNode.eOp == SWQ_LT ? nRes < 0
+                   : oNode.eOp == SWQ_LE ? nRes <= 0
+                   : oNode.eOp == SWQ_GT ? nRes > 0
+                                         : nRes >= 0;
+        }
+    }
+    return FALSE;
+}
+
+/************************************************************************/
+/*                       CompiledExpr::Evaluate()                       */
+/*                                                                      */
+/*      As in SWQGeneralEvaluator(), logical operators applied to a     */
+/*      NULL value evaluate to false.                                   */
+/************************************************************************/
+
+template <class Reader>
+int CompiledExpr::Evaluate(const Reader &oReader, const Node &oNode) const
+{
+    switch (oNode.eType)
+    {
+        case NodeType::AND:
+        {
+            if (Evaluate(oReader, aoNodes[oNode.anChildren[0]]) != TRUE)
+                return FALSE;
+            return Evaluate(oReader, aoNodes[oNode.anChildren[1]]) == TRUE;
+        }
+
+        case NodeType::OR:
+        {
+            const int nFirst = Evaluate(oReader, aoNodes[oNode.anChildren[0]]);
+            if (nFirst < 0)
+                return FALSE;
+            const Node &oSecondNode = aoNodes[oNode.anChildren[1]];
+            if (nFirst == TRUE && !oSecondNode.bMayBeNull)
+                return TRUE;
+            const int nSecond = Evaluate(oReader, oSecondNode);
+            return nSecond >= 0 && (nFirst == TRUE || nSecond == TRUE);
+        }
+
+        case NodeType::NOT:
+            return Evaluate(oReader, aoNodes[oNode.anChildren[0]]) == FALSE;
+
+        case NodeType::COMPARE:
+        case NodeType::IN:
+        case NodeType::BETWEEN:
+            return EvaluateComparison(oReader, oNode);
+
+        case NodeType::IS_NULL:
+            return oReader.IsNull(oNode.aoOperands[0].iColumn);
+
+        case NodeType::COLUMN:
+        {
+            const int iColumn = oNode.aoOperands[0].iColumn;
+            if (oReader.IsNull(iColumn))
+                return -1;
+            return oReader.GetInteger(iColumn) != 0;
+        }
+
+        case NodeType::GENERIC:
+            return oReader.EvaluateGeneric(oNode.poGeneric.get());
+    }
+    return FALSE;
+}
+
+/************************************************************************/
+/*                     CompiledExpr::EvaluateRoot()                     */
+/************************************************************************/
+
+int CompiledExpr::EvaluateRoot(const FeatureReader &oReader) const
+{
+    return Evaluate(oReader, aoNodes.back()) == TRUE;
+}
+
 /************************************************************************/
 /*                              Evaluate()                              */
 /************************************************************************/
@@ -317,6 +1055,16 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     if (pSWQExpr == nullptr)
         return FALSE;
 
+    const CompiledExpr *poCompiledExpr =
+        static_cast<const CompiledExpr *>(pCompiledExpr);
+    if (poCompiledExpr && poFeature->GetDefnRef() == poTargetDefn &&
+        poCompiledExpr->IsValid())
+    {
+        const CompiledExpr::FeatureReader oReader{poCompiledExpr->aoColumns,
+                                                  poFeature};
+        return poCompiledExpr->EvaluateRoot(oReader);
+    }
+
     swq_expr_node *poResult = static_cast<swq_expr_node *>(pSWQExpr)->Evaluate(
         OGRFeatureFetcher, poFeature);
 
@@ -334,6 +1082,81 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     return bLogicalResult;
 }
 
+/************************************************************************/
+/*                         EvaluateArrowArray()                         */
+/*                                                                      */
+/*      Evaluate the expression on all the rows of an Arrow struct      */
+/*      array, as returned by OGRLayer::GetArrowStream(), whose         */
+/*      children are matched with the fields of the expression by      */
+/*      name. abRetain[i] is set to whether row i passes the filter.    */
+/*                                                                      */
+/*      Returns false, without modifying abRetain, if the expression    */
+/*      cannot be evaluated that way (use of the FID, of functions,     */
+/*      of date fields, unsupported Arrow types, ...), in which case    */
+/*      the rows must be evaluated as features with Evaluate().         */
+/************************************************************************/
+
+bool OGRFeatureQuery::EvaluateArrowArray(const struct ArrowSchema *schema,
+                                         const struct ArrowArray *array,
+                                         std::vector<bool> &abRetain)
+{
+    const CompiledExpr *poCompiledExpr =
+        static_cast<const CompiledExpr *>(pCompiledExpr);
+    if (!poCompiledExpr || poCompiledExpr->bHasGeneric ||
+        !poCompiledExpr->IsValid() || strcmp(schema->format, "+s") != 0 ||
+        schema->n_children != array->n_children)
+        return false;
+
+    CompiledExpr::ArrowReader oReader;
+    oReader.nParentOffset = array->offset;
+    for (const auto &oColumn : poCompiledExpr->aoColumns)
+    {
+        if (oColumn.iField == CompiledExpr::FID_COLUMN)
+            return false;
+        const char *pszName =
+            poTargetDefn->GetFieldDefn(oColumn.iField)->GetNameRef();
+        int iChild = 0;
+        for (; iChild < static_cast<int>(schema->n_children); iChild++)
+        {
+            if (strcmp(schema->children[iChild]->name, pszName) == 0)
+                break;
+        }
+        if (iChild == static_cast<int>(schema->n_children))
+            return false;
+
+        const struct ArrowSchema *psChildSchema = schema->children[iChild];
+        const struct ArrowArray *psChildArray = array->children[iChild];
+        const char *pszFormat = psChildSchema->format;
+        if (pszFormat[0] == '\0' || pszFormat[1] != '\0' ||
+            psChildSchema->dictionary != nullptr ||
+            psChildArray->length < array->offset + array->length)
+            return false;
+        const char chFormat = pszFormat[0];
+        const bool bOK =
+            oColumn.eType == OFTString
+                ? (chFormat == 'u' || chFormat == 'U')
+            : oColumn.eType == OFTReal
+                ? (chFormat == 'f' || chFormat == 'g')
+                : (chFormat == 'b' || chFormat == 'c' || chFormat == 's' ||
+                   chFormat == 'i' ||
+                   (chFormat == 'l' && oColumn.eType == OFTInteger64));
+        if (!bOK)
+            return false;
+        oReader.apoArrays.push_back(psChildArray);
+        oReader.achFormats.push_back(chFormat);
+    }
+
+    const auto &oRoot = poCompiledExpr->aoNodes.back();
+    abRetain.resize(static_cast<size_t>(array->length));
+    for (int64_t i = 0; i < array->length; i++)
+    {
+        oReader.iRow = i;
+        abRetain[static_cast<size_t>(i)] =
+            poCompiledExpr->Evaluate(oReader, oRoot) == TRUE;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                            CanUseIndex()                             */
 /************************************************************************/
@@ -324,6 +324,10 @@ class OGRArrowWriterLayer CPL_NON_FINAL : public OGRLayer
     virtual void FixupGeometryBeforeWriting(OGRGeometry * /* poGeom */)
     {
     }
+    virtual bool IsFixupGeometryBeforeWritingNeeded() const
+    {
+        return false;
+    }
     virtual bool IsSRSRequired() const = 0;
 
   public:
@@ -355,6 +359,9 @@ class OGRArrowWriterLayer CPL_NON_FINAL : public OGRLayer
     OGRErr CreateGeomField(OGRGeomFieldDefn *poField,
                            int bApproxOK = TRUE) override;
     GIntBig GetFeatureCount(int bForce) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
 
   protected:
     OGRErr ICreateFeature(OGRFeature *poFeature) override;
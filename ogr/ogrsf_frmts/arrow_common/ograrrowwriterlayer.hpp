@@ -27,6 +27,8 @@
  ****************************************************************************/
 
 #include "ogr_arrow.h"
+#include "ogr_p.h"
+#include "ogr_wkb.h"
 
 #include "cpl_json.h"
 #include "cpl_time.h"
@@ -1530,6 +1532,236 @@ inline OGRErr OGRArrowWriterLayer::ICreateFeature(OGRFeature *poFeature)
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                         WriteArrowBatch()                            */
+/************************************************************************/
+
+inline bool OGRArrowWriterLayer::WriteArrowBatch(
+    const struct ArrowSchema *schema, struct ArrowArray *array,
+    CSLConstList papszOptions)
+{
+#if ARROW_VERSION_MAJOR >= 7
+    if (m_poSchema == nullptr)
+    {
+        CreateSchema();
+    }
+
+    if (m_apoBuilders.empty())
+    {
+        CreateArrayBuilders();
+    }
+
+    // The fast path appends slices of the input columns directly into the
+    // array builders, which requires WKB pass-through for geometries.
+    const auto FallbackToGeneric = [this, schema, array, papszOptions]()
+    { return OGRLayer::WriteArrowBatch(schema, array, papszOptions); };
+    for (const auto eGeomEncoding : m_aeGeomEncoding)
+    {
+        if (eGeomEncoding != OGRArrowGeomEncoding::WKB)
+            return FallbackToGeneric();
+    }
+
+    // Import shallow copies of the schema and array, with a no-op release
+    // callback, since their ownership stays with the caller.
+    struct ArrowSchema sSchemaCopy = *schema;
+    sSchemaCopy.release = [](struct ArrowSchema *psSchema)
+    { psSchema->release = nullptr; };
+    auto poBatchSchemaRes = arrow::ImportSchema(&sSchemaCopy);
+    if (!poBatchSchemaRes.ok())
+        return FallbackToGeneric();
+    struct ArrowArray sArrayCopy = *array;
+    sArrayCopy.release = [](struct ArrowArray *psArray)
+    { psArray->release = nullptr; };
+    auto poBatchRes = arrow::ImportRecordBatch(&sArrayCopy, *poBatchSchemaRes);
+    if (!poBatchRes.ok())
+        return FallbackToGeneric();
+    const auto &poBatch = *poBatchRes;
+
+    // Map builders to columns of the batch, by name.
+    const char *pszFIDName =
+        CSLFetchNameValueDef(papszOptions, "FID", m_osFIDColumn.c_str());
+    const int nArrowIdxFirstGeomField = (m_osFIDColumn.empty() ? 0 : 1) +
+                                        m_poFeatureDefn->GetFieldCount();
+    std::vector<std::shared_ptr<arrow::Array>> apoColumns(m_apoBuilders.size());
+    std::vector<bool> abColumnUsed(poBatch->num_columns());
+    for (size_t i = 0; i < m_apoBuilders.size(); ++i)
+    {
+        const auto &field = m_poSchema->fields()[i];
+        const bool bIsFID = i == 0 && !m_osFIDColumn.empty();
+        int iCol = poBatch->schema()->GetFieldIndex(
+            bIsFID ? std::string(pszFIDName) : field->name());
+        if (iCol < 0 && static_cast<int>(i) == nArrowIdxFirstGeomField)
+        {
+            // Same rules as the generic implementation: use GEOMETRY_NAME,
+            // or the single column tagged with the ogc.wkb extension.
+            const char *pszGeomName =
+                CSLFetchNameValue(papszOptions, "GEOMETRY_NAME");
+            if (pszGeomName)
+            {
+                iCol = poBatch->schema()->GetFieldIndex(pszGeomName);
+            }
+            else if (m_poFeatureDefn->GetGeomFieldCount() == 1)
+            {
+                for (int j = 0; j < poBatch->num_columns(); ++j)
+                {
+                    const auto &poMD = poBatch->schema()->field(j)->metadata();
+                    if (poMD && poMD->Contains("ARROW:extension:name") &&
+                        poMD->Get("ARROW:extension:name").ValueOr("") ==
+                            "ogc.wkb")
+                    {
+                        iCol = j;
+                        break;
+                    }
+                }
+            }
+        }
+        if (iCol < 0)
+        {
+            if (!bIsFID && !field->nullable())
+                return FallbackToGeneric();
+            continue;
+        }
+        const auto &poColumn = poBatch->column(iCol);
+        if (!poColumn->type()->Equals(m_apoBuilders[i]->type()) ||
+            (poColumn->null_count() != 0 && (bIsFID || !field->nullable())))
+        {
+            return FallbackToGeneric();
+        }
+        apoColumns[i] = poColumn;
+        abColumnUsed[iCol] = true;
+    }
+    for (int iCol = 0; iCol < poBatch->num_columns(); ++iCol)
+    {
+        if (!abColumnUsed[iCol])
+        {
+            // A FID column is silently ignored when the layer has none, as
+            // the generic implementation would do.
+            const auto &osName = poBatch->schema()->field(iCol)->name();
+            if (!m_osFIDColumn.empty() ||
+                (osName != "OGC_FID" && !EQUAL(osName.c_str(), pszFIDName)))
+            {
+                return FallbackToGeneric();
+            }
+        }
+    }
+
+    // Scan geometries before appending anything, to collect the extent and
+    // geometry types, and detect geometries that need the generic path.
+    // Polygonal geometries may need their winding order to be fixed.
+    const bool bFixupNeeded = IsFixupGeometryBeforeWritingNeeded();
+    const auto IsPolygonal = [](OGRwkbGeometryType eGType)
+    {
+        const auto eFlatType = wkbFlatten(eGType);
+        return eFlatType == wkbPolygon || eFlatType == wkbMultiPolygon ||
+               eFlatType == wkbGeometryCollection;
+    };
+    const int nGeomFieldCount = m_poFeatureDefn->GetGeomFieldCount();
+    std::vector<OGREnvelope3D> aoEnvelopes(nGeomFieldCount);
+    std::vector<std::set<OGRwkbGeometryType>> aoSetGeomTypes(nGeomFieldCount);
+    for (int i = 0; i < nGeomFieldCount; ++i)
+    {
+        const auto &poColumn = apoColumns[nArrowIdxFirstGeomField + i];
+        if (!poColumn)
+            continue;
+        const auto eColumnGType =
+            m_poFeatureDefn->GetGeomFieldDefn(i)->GetType();
+        const auto poBinaryArray =
+            static_cast<const arrow::BinaryArray *>(poColumn.get());
+        for (int64_t iRow = 0; iRow < poBinaryArray->length(); ++iRow)
+        {
+            if (poBinaryArray->IsNull(iRow))
+                continue;
+            int32_t nLen = 0;
+            const uint8_t *pabyWKB = poBinaryArray->GetValue(iRow, &nLen);
+            bool bNeedSwap = false;
+            uint32_t nRawType = 0;
+            OGRwkbGeometryType eGType = wkbUnknown;
+            OGREnvelope3D oEnvelope;
+            if (!OGRWKBGetGeomType(pabyWKB, nLen, bNeedSwap, nRawType) ||
+                nRawType >= 4000 ||
+                OGRReadWKBGeometryType(pabyWKB, wkbVariantIso, &eGType) !=
+                    OGRERR_NONE ||
+                OGR_GT_IsNonLinear(eGType) ||
+                (bFixupNeeded && IsPolygonal(eGType)) ||
+                (OGR_GT_HasM(eGType) && !OGR_GT_HasM(eColumnGType)) ||
+                !OGRWKBGetBoundingBox(pabyWKB, nLen, oEnvelope))
+            {
+                return FallbackToGeneric();
+            }
+            if (oEnvelope.IsInit())
+            {
+                aoEnvelopes[i].Merge(oEnvelope);
+                aoSetGeomTypes[i].insert(eGType);
+            }
+        }
+    }
+    for (int i = 0; i < nGeomFieldCount; ++i)
+    {
+        if (aoEnvelopes[i].IsInit())
+            m_aoEnvelopes[i].Merge(aoEnvelopes[i]);
+        m_oSetWrittenGeometryTypes[i].insert(aoSetGeomTypes[i].begin(),
+                                             aoSetGeomTypes[i].end());
+    }
+
+    // Append column slices, flushing row groups when they are full.
+    const int64_t nRows = poBatch->num_rows();
+    int64_t nOffset = 0;
+    while (nOffset < nRows)
+    {
+        const int64_t nChunk = std::min(
+            nRows - nOffset, m_nRowGroupSize - m_apoBuilders[0]->length());
+        for (size_t i = 0; i < m_apoBuilders.size(); ++i)
+        {
+            auto poBuilder = m_apoBuilders[i].get();
+            const auto &poColumn = apoColumns[i];
+            if (poColumn)
+            {
+#if ARROW_VERSION_MAJOR >= 9
+                OGR_ARROW_RETURN_FALSE_NOT_OK(poBuilder->AppendArraySlice(
+                    arrow::ArraySpan(*(poColumn->data())), nOffset, nChunk));
+#else
+                OGR_ARROW_RETURN_FALSE_NOT_OK(poBuilder->AppendArraySlice(
+                    *(poColumn->data()), nOffset, nChunk));
+#endif
+            }
+            else if (i == 0 && !m_osFIDColumn.empty())
+            {
+                auto poFIDBuilder =
+                    static_cast<arrow::Int64Builder *>(poBuilder);
+                for (int64_t j = 0; j < nChunk; ++j)
+                {
+                    OGR_ARROW_RETURN_FALSE_NOT_OK(
+                        poFIDBuilder->Append(m_nFeatureCount + j));
+                }
+            }
+            else
+            {
+                OGR_ARROW_RETURN_FALSE_NOT_OK(poBuilder->AppendNulls(nChunk));
+            }
+        }
+        m_nFeatureCount += nChunk;
+        nOffset += nChunk;
+
+        if (m_apoBuilders[0]->length() == m_nRowGroupSize)
+        {
+            if (!IsFileWriterCreated())
+            {
+                CreateWriter();
+                if (!IsFileWriterCreated())
+                    return false;
+            }
+
+            if (!FlushGroup())
+                return false;
+        }
+    }
+
+    return true;
+#else
+    return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+#endif
+}
+
 /************************************************************************/
 /*                        GetFeatureCount()                             */
 /************************************************************************/
@@ -1561,6 +1793,9 @@ inline int OGRArrowWriterLayer::TestCapability(const char *pszCap)
     if (EQUAL(pszCap, OLCMeasuredGeometries))
         return true;
 
+    if (EQUAL(pszCap, OLCFastWriteArrowBatch))
+        return true;
+
     return false;
 }
 
@@ -142,6 +142,16 @@ class OGRCSVLayer final : public OGRLayer
     StringQuoting m_eStringQuoting = StringQuoting::IF_AMBIGUOUS;
 
     char **GetNextLineTokens();
+    bool GetNextLineFields(std::string &osLine,
+                           std::vector<char *> &apszFields);
+
+    int ParseBooleanValue(const OGRFieldDefn *poFieldDefn,
+                          const char *pszValue);
+    bool CheckNumericValue(const OGRFieldDefn *poFieldDefn, char *pszValue);
+    void CheckStringValueWidth(const OGRFieldDefn *poFieldDefn,
+                               const char *pszValue);
+
+    bool CanReadArrowArrayNatively();
 
     static bool Matches(const char *pszFieldName, char **papszPossibleNames);
 
@@ -203,6 +213,8 @@ class OGRCSVLayer final : public OGRLayer
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
 
     OGRFeatureDefn *GetLayerDefn() override
     {
@@ -56,6 +56,7 @@
 #include "ogr_p.h"
 #include "ogr_spatialref.h"
 #include "ogrsf_frmts.h"
+#include "ograrrowarrayhelper.h"
 
 #define DIGIT_ZERO '0'
 
@@ -1307,6 +1308,136 @@ char **OGRCSVLayer::GetNextLineTokens()
     }
 }
 
+/************************************************************************/
+/*                         GetNextLineFields()                          */
+/*                                                                      */
+/*      Same as GetNextLineTokens(), but the record is split in place   */
+/*      within osLine, and apszFields points into it, so that no        */
+/*      allocation is needed per record once the buffers are warm.      */
+/*      Only valid when bHonourStrings is set.                           */
+/************************************************************************/
+
+bool OGRCSVLayer::GetNextLineFields(std::string &osLine,
+                                    std::vector<char *> &apszFields)
+{
+    const char chDelimiter = szDelimiter[0];
+    while (true)
+    {
+        int nBufLength = 0;
+        const char *pszLine =
+            CPLReadLine3L(fpCSV, m_nMaxLineSize, &nBufLength, nullptr);
+        if (pszLine == nullptr)
+            return false;
+
+        // Skip BOM.
+        const GByte *pabyData = reinterpret_cast<const GByte *>(pszLine);
+        if (pabyData[0] == 0xEF && pabyData[1] == 0xBB && pabyData[2] == 0xBF)
+            pszLine += 3;
+        osLine.assign(pszLine);
+
+        // As in CSVReadParseLine3L(), keep appending lines as long as the
+        // number of quotes is odd.
+        size_t nQuotes = 0;
+        size_t nPos = 0;
+        while (true)
+        {
+            const char *pszQuote;
+            while ((pszQuote = static_cast<const char *>(
+                        memchr(osLine.data() + nPos, '"',
+                               osLine.size() - nPos))) != nullptr)
+            {
+                nQuotes++;
+                nPos = static_cast<size_t>(pszQuote - osLine.data()) + 1;
+            }
+            nPos = osLine.size();
+
+            if (nQuotes % 2 == 0)
+                break;
+
+            pszLine =
+                CPLReadLine3L(fpCSV, m_nMaxLineSize, &nBufLength, nullptr);
+            if (pszLine == nullptr)
+                break;
+
+            osLine += '\n';
+            osLine += pszLine;
+        }
+
+        apszFields.clear();
+        if (osLine.empty())
+            continue;
+
+        // Those are the same tokenization rules as CSVSplitLine() in
+        // port/cpl_csv.cpp, including the trailing empty field added when
+        // the last character is a delimiter.
+        const bool bEndsWithDelimiter = osLine.back() == chDelimiter;
+        char *pszIter = &osLine[0];
+        char *const pszEnd = pszIter + osLine.size();
+        if (nQuotes == 0)
+        {
+            // Fast path: locate delimiters with memchr().
+            while (pszIter < pszEnd)
+            {
+                apszFields.push_back(pszIter);
+                char *pszDelimiter = static_cast<char *>(
+                    memchr(pszIter, chDelimiter, pszEnd - pszIter));
+                if (pszDelimiter == nullptr)
+                    break;
+                *pszDelimiter = '\0';
+                pszIter = pszDelimiter + 1;
+                if (bMergeDelimiter)
+                {
+                    while (pszIter < pszEnd && *pszIter == chDelimiter)
+                        pszIter++;
+                }
+            }
+        }
+        else
+        {
+            // Remove quotes in place: the output pointer never gets ahead
+            // of the input one.
+            while (*pszIter != '\0')
+            {
+                char *pszOut = pszIter;
+                apszFields.push_back(pszOut);
+                bool bInString = false;
+                do
+                {
+                    if (!bInString && *pszIter == chDelimiter)
+                    {
+                        pszIter++;
+                        if (bMergeDelimiter)
+                        {
+                            while (*pszIter == chDelimiter)
+                                pszIter++;
+                        }
+                        break;
+                    }
+
+                    if (*pszIter == '"')
+                    {
+                        if (!bInString || pszIter[1] != '"')
+                        {
+                            bInString = !bInString;
+                            continue;
+                        }
+                        // Doubled quotes in string resolve to one quote.
+                        pszIter++;
+                    }
+
+                    *pszOut = *pszIter;
+                    pszOut++;
+                } while (*(++pszIter) != '\0');
+                *pszOut = '\0';
+            }
+        }
+        if (bEndsWithDelimiter)
+            apszFields.push_back(pszEnd);
+
+        return true;
+    }
+}
+
 /************************************************************************/
 /*                             GetFeature()                             */
 /************************************************************************/
@@ -1328,6 +1459,160 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
     return GetNextUnfilteredFeature();
 }
 
+/************************************************************************/
+/*                        OGRCSVParseGeometry()                         */
+/*                                                                      */
+/*      Parse the content of a geometry column, which may be WKT,       */
+/*      GeoJSON or HexEWKB. Only WKT geometries get poSRS assigned.     */
+/************************************************************************/
+
+static OGRGeometry *OGRCSVParseGeometry(const char *pszStr,
+                                        OGRSpatialReference *poSRS)
+{
+    while (*pszStr == ' ')
+        pszStr++;
+    OGRGeometry *poGeom = nullptr;
+
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    if (OGRGeometryFactory::createFromWkt(pszStr, nullptr, &poGeom) ==
+        OGRERR_NONE)
+    {
+        poGeom->assignSpatialReference(poSRS);
+    }
+    else if (*pszStr == '{')
+    {
+        poGeom = reinterpret_cast<OGRGeometry *>(
+            OGR_G_CreateGeometryFromJson(pszStr));
+    }
+    else if ((*pszStr >= '0' && *pszStr <= '9') ||
+             (*pszStr >= 'a' && *pszStr <= 'z') ||
+             (*pszStr >= 'A' && *pszStr <= 'Z'))
+    {
+        poGeom = OGRGeometryFromHexEWKB(pszStr, nullptr, FALSE);
+    }
+    CPLPopErrorHandler();
+
+    return poGeom;
+}
+
+/************************************************************************/
+/*                         ParseBooleanValue()                          */
+/*                                                                      */
+/*      Return 1 or 0, or -1 (after warning once) if the value is not   */
+/*      a recognized boolean.                                            */
+/************************************************************************/
+
+int OGRCSVLayer::ParseBooleanValue(const OGRFieldDefn *poFieldDefn,
+                                   const char *pszValue)
+{
+    if (OGRCSVIsTrue(pszValue) || strcmp(pszValue, "1") == 0)
+        return 1;
+    if (OGRCSVIsFalse(pszValue) || strcmp(pszValue, "0") == 0)
+        return 0;
+    if (!bWarningBadTypeOrWidth)
+    {
+        bWarningBadTypeOrWidth = true;
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Invalid value type found in record %d for field %s. "
+                 "This warning will no longer be emitted",
+                 nNextFID, poFieldDefn->GetNameRef());
+    }
+    return -1;
+}
+
+/************************************************************************/
+/*                         CheckNumericValue()                          */
+/*                                                                      */
+/*      Check that the value of a Integer, Integer64 or Real field is   */
+/*      numeric, and warn once about values not fitting the field       */
+/*      definition. For Real fields, a decimal comma is replaced in     */
+/*      place by a dot.                                                  */
+/************************************************************************/
+
+bool OGRCSVLayer::CheckNumericValue(const OGRFieldDefn *poFieldDefn,
+                                    char *pszValue)
+{
+    const OGRFieldType eFieldType = poFieldDefn->GetType();
+    if (eFieldType == OFTReal)
+    {
+        char *chComma = strchr(pszValue, ',');
+        if (chComma)
+            *chComma = '.';
+    }
+    const CPLValueType eType = CPLGetValueType(pszValue);
+    if (eType != CPL_VALUE_INTEGER && eType != CPL_VALUE_REAL)
+    {
+        if (!bWarningBadTypeOrWidth)
+        {
+            bWarningBadTypeOrWidth = true;
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Invalid value type found in record %d for field "
+                     "%s. This warning will no longer be emitted.",
+                     nNextFID, poFieldDefn->GetNameRef());
+        }
+        return false;
+    }
+
+    if (!bWarningBadTypeOrWidth &&
+        (eFieldType == OFTInteger || eFieldType == OFTInteger64) &&
+        eType == CPL_VALUE_REAL)
+    {
+        bWarningBadTypeOrWidth = true;
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Invalid value type found in record %d for "
+                 "field %s. "
+                 "This warning will no longer be emitted",
+                 nNextFID, poFieldDefn->GetNameRef());
+    }
+    else if (!bWarningBadTypeOrWidth && poFieldDefn->GetWidth() > 0 &&
+             static_cast<int>(strlen(pszValue)) > poFieldDefn->GetWidth())
+    {
+        bWarningBadTypeOrWidth = true;
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Value with a width greater than field width "
+                 "found in record %d for field %s. "
+                 "This warning will no longer be emitted",
+                 nNextFID, poFieldDefn->GetNameRef());
+    }
+    else if (!bWarningBadTypeOrWidth && eType == CPL_VALUE_REAL &&
+             poFieldDefn->GetWidth() > 0)
+    {
+        const char *pszDot = strchr(pszValue, '.');
+        const int nPrecision =
+            pszDot != nullptr ? static_cast<int>(strlen(pszDot + 1)) : 0;
+        if (nPrecision > poFieldDefn->GetPrecision())
+        {
+            bWarningBadTypeOrWidth = true;
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Value with a precision greater than "
+                     "field precision found in record %d for "
+                     "field %s. "
+                     "This warning will no longer be emitted",
+                     nNextFID, poFieldDefn->GetNameRef());
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       CheckStringValueWidth()                        */
+/************************************************************************/
+
+void OGRCSVLayer::CheckStringValueWidth(const OGRFieldDefn *poFieldDefn,
+                                        const char *pszValue)
+{
+    if (!bWarningBadTypeOrWidth && poFieldDefn->GetWidth() > 0 &&
+        static_cast<int>(strlen(pszValue)) > poFieldDefn->GetWidth())
+    {
+        bWarningBadTypeOrWidth = true;
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Value with a width greater than field width "
+                 "found in record %d for field %s. "
+                 "This warning will no longer be emitted",
+                 nNextFID, poFieldDefn->GetNameRef());
+    }
+}
+
 /************************************************************************/
 /*                      GetNextUnfilteredFeature()                      */
 /************************************************************************/
@@ -1374,35 +1659,11 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
             if (papszTokens[iAttr][0] != '\0' &&
                 !(poFeatureDefn->GetGeomFieldDefn(iGeom)->IsIgnored()))
             {
-                const char *pszStr = papszTokens[iAttr];
-                while (*pszStr == ' ')
-                    pszStr++;
-                OGRGeometry *poGeom = nullptr;
-
-                CPLPushErrorHandler(CPLQuietErrorHandler);
-                if (OGRGeometryFactory::createFromWkt(pszStr, nullptr,
-                                                      &poGeom) == OGRERR_NONE)
-                {
-                    poGeom->assignSpatialReference(
-                        poFeatureDefn->GetGeomFieldDefn(iGeom)
-                            ->GetSpatialRef());
+                OGRGeometry *poGeom = OGRCSVParseGeometry(
+                    papszTokens[iAttr],
+                    poFeatureDefn->GetGeomFieldDefn(iGeom)->GetSpatialRef());
+                if (poGeom != nullptr)
                     poFeature->SetGeomFieldDirectly(iGeom, poGeom);
-                }
-                else if (*pszStr == '{' &&
-                         (poGeom = reinterpret_cast<OGRGeometry *>(
-                              OGR_G_CreateGeometryFromJson(pszStr))) != nullptr)
-                {
-                    poFeature->SetGeomFieldDirectly(iGeom, poGeom);
-                }
-                else if (((*pszStr >= '0' && *pszStr <= '9') ||
-                          (*pszStr >= 'a' && *pszStr <= 'z') ||
-                          (*pszStr >= 'A' && *pszStr <= 'Z')) &&
-                         (poGeom = OGRGeometryFromHexEWKB(pszStr, nullptr,
-                                                          FALSE)) != nullptr)
-                {
-                    poFeature->SetGeomFieldDirectly(iGeom, poGeom);
-                }
-                CPLPopErrorHandler();
             }
             if (!bKeepGeomColumns || (iAttr == 0 && bHiddenWKTColumn))
                 continue;
@@ -1415,99 +1676,19 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         {
             if (papszTokens[iAttr][0] != '\0' && !poFieldDefn->IsIgnored())
             {
-                if (OGRCSVIsTrue(papszTokens[iAttr]) ||
-                    strcmp(papszTokens[iAttr], "1") == 0)
-                {
-                    poFeature->SetField(iOGRField, 1);
-                }
-                else if (OGRCSVIsFalse(papszTokens[iAttr]) ||
-                         strcmp(papszTokens[iAttr], "0") == 0)
-                {
-                    poFeature->SetField(iOGRField, 0);
-                }
-                else if (!bWarningBadTypeOrWidth)
-                {
-                    bWarningBadTypeOrWidth = true;
-                    CPLError(
-                        CE_Warning, CPLE_AppDefined,
-                        "Invalid value type found in record %d for field %s. "
-                        "This warning will no longer be emitted",
-                        nNextFID, poFieldDefn->GetNameRef());
-                }
+                const int nVal =
+                    ParseBooleanValue(poFieldDefn, papszTokens[iAttr]);
+                if (nVal >= 0)
+                    poFeature->SetField(iOGRField, nVal);
             }
         }
         else if (eFieldType == OFTReal || eFieldType == OFTInteger ||
                  eFieldType == OFTInteger64)
         {
-            if (papszTokens[iAttr][0] != '\0' && !poFieldDefn->IsIgnored())
+            if (papszTokens[iAttr][0] != '\0' && !poFieldDefn->IsIgnored() &&
+                CheckNumericValue(poFieldDefn, papszTokens[iAttr]))
             {
-                if (eFieldType == OFTReal)
-                {
-                    char *chComma = strchr(papszTokens[iAttr], ',');
-                    if (chComma)
-                        *chComma = '.';
-                }
-                CPLValueType eType = CPLGetValueType(papszTokens[iAttr]);
-                if (eType == CPL_VALUE_INTEGER || eType == CPL_VALUE_REAL)
-                {
-                    poFeature->SetField(iOGRField, papszTokens[iAttr]);
-                    if (!bWarningBadTypeOrWidth &&
-                        (eFieldType == OFTInteger ||
-                         eFieldType == OFTInteger64) &&
-                        eType == CPL_VALUE_REAL)
-                    {
-                        bWarningBadTypeOrWidth = true;
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "Invalid value type found in record %d for "
-                                 "field %s. "
-                                 "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
-                    }
-                    else if (!bWarningBadTypeOrWidth &&
-                             poFieldDefn->GetWidth() > 0 &&
-                             static_cast<int>(strlen(papszTokens[iAttr])) >
-                                 poFieldDefn->GetWidth())
-                    {
-                        bWarningBadTypeOrWidth = true;
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "Value with a width greater than field width "
-                                 "found in record %d for field %s. "
-                                 "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
-                    }
-                    else if (!bWarningBadTypeOrWidth &&
-                             eType == CPL_VALUE_REAL &&
-                             poFieldDefn->GetWidth() > 0)
-                    {
-                        const char *pszDot = strchr(papszTokens[iAttr], '.');
-                        const int nPrecision =
-                            pszDot != nullptr
-                                ? static_cast<int>(strlen(pszDot + 1))
-                                : 0;
-                        if (nPrecision > poFieldDefn->GetPrecision())
-                        {
-                            bWarningBadTypeOrWidth = true;
-                            CPLError(CE_Warning, CPLE_AppDefined,
-                                     "Value with a precision greater than "
-                                     "field precision found in record %d for "
-                                     "field %s. "
-                                     "This warning will no longer be emitted",
-                                     nNextFID, poFieldDefn->GetNameRef());
-                        }
-                    }
-                }
-                else
-                {
-                    if (!bWarningBadTypeOrWidth)
-                    {
-                        bWarningBadTypeOrWidth = true;
-                        CPLError(
-                            CE_Warning, CPLE_AppDefined,
-                            "Invalid value type found in record %d for field "
-                            "%s. This warning will no longer be emitted.",
-                            nNextFID, poFieldDefn->GetNameRef());
-                    }
-                }
+                poFeature->SetField(iOGRField, papszTokens[iAttr]);
             }
         }
         else if (eFieldType != OFTString)
@@ -1536,17 +1717,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
             else
             {
                 poFeature->SetField(iOGRField, papszTokens[iAttr]);
-                if (!bWarningBadTypeOrWidth && poFieldDefn->GetWidth() > 0 &&
-                    static_cast<int>(strlen(papszTokens[iAttr])) >
-                        poFieldDefn->GetWidth())
-                {
-                    bWarningBadTypeOrWidth = true;
-                    CPLError(CE_Warning, CPLE_AppDefined,
-                             "Value with a width greater than field width "
-                             "found in record %d for field %s. "
-                             "This warning will no longer be emitted",
-                             nNextFID, poFieldDefn->GetNameRef());
-                }
+                CheckStringValueWidth(poFieldDefn, papszTokens[iAttr]);
             }
         }
 
@@ -1707,6 +1878,318 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                     CanReadArrowArrayNatively()                      */
+/*                                                                      */
+/*      Whether GetNextArrowArray() can directly parse the records      */
+/*      into the Arrow buffers, instead of going through OGRFeature.    */
+/************************************************************************/
+
+bool OGRCSVLayer::CanReadArrowArrayNatively()
+{
+    if (fpCSV == nullptr || m_poAttrQuery != nullptr || !bHonourStrings ||
+        bIsEurostatTSV || bHiddenWKTColumn || bKeepSourceColumns ||
+        iNfdcLatitudeS >= 0 || iNfdcLongitudeS >= 0 || iLatitudeField >= 0 ||
+        iLongitudeField >= 0 || iZField >= 0 ||
+        CPLTestBool(CPLGetConfigOption("OGR_CSV_STREAM_BASE_IMPL", "NO")))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < poFeatureDefn->GetFieldCount(); i++)
+    {
+        const OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        const OGRFieldType eType = poFieldDefn->GetType();
+        const OGRFieldSubType eSubType = poFieldDefn->GetSubType();
+        if (!((eSubType == OFSTNone &&
+               (eType == OFTString || eType == OFTInteger ||
+                eType == OFTInteger64 || eType == OFTReal ||
+                eType == OFTDate || eType == OFTDateTime)) ||
+              (eSubType == OFSTBoolean && eType == OFTInteger)))
+        {
+            return false;
+        }
+    }
+
+    for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++)
+    {
+        const OGRGeomFieldDefn *poGeomFieldDefn =
+            poFeatureDefn->GetGeomFieldDefn(i);
+        if (!poGeomFieldDefn->IsIgnored() && !poGeomFieldDefn->IsNullable())
+            return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/************************************************************************/
+
+int OGRCSVLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                   struct ArrowArray *out_array)
+{
+    if (!CanReadArrowArrayNatively())
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    if (bNeedRewindBeforeRead)
+        ResetReading();
+
+    OGRArrowArrayHelper sHelper(nullptr, poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    // Index of the OGR attribute field matching each CSV column, or -1
+    // if it is only used as a geometry column.
+    std::vector<int> anColumnToField(nCSVFieldCount, -1);
+    std::vector<int> anGeomColumns;
+    for (int iAttr = 0, iOGRField = 0; iAttr < nCSVFieldCount; iAttr++)
+    {
+        if (panGeomFieldIndex[iAttr] >= 0)
+        {
+            anGeomColumns.push_back(iAttr);
+            if (!bKeepGeomColumns)
+                continue;
+        }
+        anColumnToField[iAttr] = iOGRField;
+        iOGRField++;
+    }
+
+    std::vector<std::unique_ptr<OGRGeometry>> apoGeoms(
+        sHelper.nGeomFieldCount);
+    std::string osLine;
+    std::vector<char *> apszFields;
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    int errorErrno = 0;
+    int iFeat = 0;
+    while (iFeat < sHelper.nMaxBatchSize)
+    {
+        if (!GetNextLineFields(osLine, apszFields))
+            break;
+        const int nFields = static_cast<int>(apszFields.size());
+        const int nFID = nNextFID;
+        nNextFID++;
+        m_nFeaturesRead++;
+
+        /* -------------------------------------------------------------- */
+        /*      Parse geometries, and apply the spatial filter before      */
+        /*      anything is written in the arrays for this record.        */
+        /* -------------------------------------------------------------- */
+        for (const int iAttr : anGeomColumns)
+        {
+            const int iGeom = panGeomFieldIndex[iAttr];
+            apoGeoms[iGeom].reset();
+            if (iAttr < nFields && apszFields[iAttr][0] != '\0' &&
+                (sHelper.mapOGRGeomFieldToArrowField[iGeom] >= 0 ||
+                 (m_poFilterGeom != nullptr && iGeom == m_iGeomFieldFilter)))
+            {
+                apoGeoms[iGeom].reset(
+                    OGRCSVParseGeometry(apszFields[iAttr], nullptr));
+            }
+        }
+        if (m_poFilterGeom != nullptr &&
+            !FilterGeometry(apoGeoms[m_iGeomFieldFilter].get()))
+        {
+            continue;
+        }
+
+        if (sHelper.panFIDValues)
+            sHelper.panFIDValues[iFeat] = nFID;
+
+        for (int iGeom = 0; iGeom < sHelper.nGeomFieldCount; iGeom++)
+        {
+            const int iArrowField = sHelper.mapOGRGeomFieldToArrowField[iGeom];
+            if (iArrowField < 0)
+                continue;
+            const OGRGeometry *poGeom = apoGeoms[iGeom].get();
+            if (poGeom != nullptr)
+            {
+                const size_t nWKBSize = poGeom->WkbSize();
+                GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                    iArrowField, iFeat, nWKBSize);
+                if (outPtr == nullptr)
+                {
+                    errorErrno = ENOMEM;
+                    break;
+                }
+                poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            }
+            else if (!sHelper.SetNull(iArrowField, iFeat))
+            {
+                errorErrno = ENOMEM;
+                break;
+            }
+        }
+        if (errorErrno != 0)
+            break;
+
+        /* -------------------------------------------------------------- */
+        /*      Attributes, with the same conversion rules as             */
+        /*      GetNextUnfilteredFeature().                               */
+        /* -------------------------------------------------------------- */
+        for (int iAttr = 0; iAttr < nCSVFieldCount; iAttr++)
+        {
+            const int iField = anColumnToField[iAttr];
+            if (iField < 0)
+                continue;
+            const int iArrowField = sHelper.mapOGRFieldToArrowField[iField];
+            if (iArrowField < 0)
+                continue;
+            auto psArray = out_array->children[iArrowField];
+            const OGRFieldDefn *poFieldDefn =
+                poFeatureDefn->GetFieldDefn(iField);
+            const OGRFieldType eType = poFieldDefn->GetType();
+
+            // Missing trailing columns are null, empty ones too unless
+            // this is a string field without EMPTY_STRING_AS_NULL.
+            char *pszVal = iAttr < nFields ? apszFields[iAttr] : nullptr;
+            bool bIsNull = pszVal == nullptr ||
+                           (pszVal[0] == '\0' &&
+                            (eType != OFTString || bEmptyStringNull));
+            if (!bIsNull)
+            {
+                switch (eType)
+                {
+                    case OFTString:
+                    {
+                        CheckStringValueWidth(poFieldDefn, pszVal);
+                        const size_t nLen = strlen(pszVal);
+                        GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                            iArrowField, iFeat, nLen);
+                        if (outPtr == nullptr)
+                            errorErrno = ENOMEM;
+                        else
+                            memcpy(outPtr, pszVal, nLen);
+                        break;
+                    }
+
+                    case OFTInteger:
+                    {
+                        if (poFieldDefn->GetSubType() == OFSTBoolean)
+                        {
+                            const int nVal =
+                                ParseBooleanValue(poFieldDefn, pszVal);
+                            if (nVal < 0)
+                                bIsNull = true;
+                            else if (nVal)
+                                sHelper.SetBoolOn(psArray, iFeat);
+                        }
+                        else if (!CheckNumericValue(poFieldDefn, pszVal))
+                        {
+                            bIsNull = true;
+                        }
+                        else
+                        {
+                            const long long nVal64 =
+                                std::strtoll(pszVal, nullptr, 10);
+                            const int nVal32 =
+                                nVal64 > INT_MAX   ? INT_MAX
+                                : nVal64 < INT_MIN ? INT_MIN
+                                                   : static_cast<int>(nVal64);
+                            sHelper.SetInt32(psArray, iFeat, nVal32);
+                        }
+                        break;
+                    }
+
+                    case OFTInteger64:
+                    {
+                        if (!CheckNumericValue(poFieldDefn, pszVal))
+                            bIsNull = true;
+                        else
+                            sHelper.SetInt64(
+                                psArray, iFeat,
+                                CPLAtoGIntBigEx(pszVal, false, nullptr));
+                        break;
+                    }
+
+                    case OFTReal:
+                    {
+                        if (!CheckNumericValue(poFieldDefn, pszVal))
+                            bIsNull = true;
+                        else
+                            sHelper.SetDouble(psArray, iFeat,
+                                              CPLStrtod(pszVal, nullptr));
+                        break;
+                    }
+
+                    case OFTDate:
+                    case OFTDateTime:
+                    {
+                        OGRField sField;
+                        if (!OGRParseDate(pszVal, &sField, 0))
+                        {
+                            bIsNull = true;
+                            if (!bWarningBadTypeOrWidth)
+                            {
+                                bWarningBadTypeOrWidth = true;
+                                CPLError(CE_Warning, CPLE_AppDefined,
+                                         "Invalid value type found in record "
+                                         "%d for field %s. "
+                                         "This warning will no longer be "
+                                         "emitted",
+                                         nFID, poFieldDefn->GetNameRef());
+                            }
+                        }
+                        else if (eType == OFTDate)
+                        {
+                            sHelper.SetDate(psArray, iFeat, brokenDown,
+                                            sField);
+                        }
+                        else
+                        {
+                            sHelper.SetDateTime(psArray, iFeat, brokenDown,
+                                                sField);
+                        }
+                        break;
+                    }
+
+                    default:
+                        CPLAssert(false);
+                        break;
+                }
+                if (errorErrno != 0)
+                    break;
+            }
+
+            if (bIsNull)
+            {
+                if (sHelper.abNullableFields[iField])
+                {
+                    if (!sHelper.SetNull(iArrowField, iFeat))
+                    {
+                        errorErrno = ENOMEM;
+                        break;
+                    }
+                }
+                else if (eType == OFTString)
+                {
+                    sHelper.SetEmptyStringOrBinary(psArray, iFeat);
+                }
+            }
+        }
+        if (errorErrno != 0)
+            break;
+
+        iFeat++;
+    }
+
+    if (errorErrno != 0 || iFeat == 0)
+    {
+        sHelper.ClearArray();
+        return errorErrno;
+    }
+
+    sHelper.Shrink(iFeat);
+    return 0;
+}
+
 /************************************************************************/
 /*                           TestCapability()                           */
 /************************************************************************/
@@ -1729,6 +2212,8 @@ int OGRCSVLayer::TestCapability(const char *pszCap)
         return TRUE;
     else if (EQUAL(pszCap, OLCZGeometries))
         return TRUE;
+    else if (EQUAL(pszCap, OLCFastGetArrowStream))
+        return CanReadArrowArrayNatively();
     else
         return FALSE;
 }
@@ -102,6 +102,19 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     bool m_ignoreSpatialFilter = false;
     bool m_ignoreAttributeFilter = false;
 
+    // coalesced reads of the features found in spatial index search
+    struct CoalescedRange
+    {
+        uint64_t offset;   // file offset
+        size_t size;       // size in bytes
+        size_t bufOffset;  // offset in m_coalescedBuf
+    };
+    std::vector<GByte> m_coalescedBuf{};
+    std::vector<CoalescedRange> m_coalescedRanges{};
+    size_t m_coalescedRangeIdx = 0;  // current index in m_coalescedRanges
+    size_t m_coalescedItemsEnd =
+        0;  // index in m_foundItems past the last item covered by the ranges
+
     // creation
     bool m_create = false;
     std::deque<FeatureItem> m_featureItems;  // feature item description used to
@@ -126,6 +139,9 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     void ensurePadfBuffers(size_t count);
     OGRErr ensureFeatureBuf(uint32_t featureSize);
     OGRErr parseFeature(OGRFeature *poFeature);
+    OGRErr readFeatureData(bool seek, uint32_t &featureSize, bool &eof);
+    void fillCoalescedRanges();
+    bool readCoalescedFeature(uint32_t &featureSize);
     const std::vector<flatbuffers::Offset<FlatGeobuf::Column>>
     writeColumns(flatbuffers::FlatBufferBuilder &fbb);
     void readColumns();
@@ -872,6 +872,9 @@ OGRErr OGRFlatGeobufLayer::readIndex()
             m_foundItems = PackedRTree::streamSearch(
                 featuresCount, indexNodeSize, n, readNode);
             m_featuresCount = m_foundItems.size();
+            m_coalescedRanges.clear();
+            m_coalescedRangeIdx = 0;
+            m_coalescedItemsEnd = 0;
             CPLDebugOnly("FlatGeobuf",
                          "%lu features found in spatial index search",
                          static_cast<long unsigned int>(m_featuresCount));
@@ -987,40 +990,38 @@ OGRErr OGRFlatGeobufLayer::ensureFeatureBuf(uint32_t featureSize)
     return OGRERR_NONE;
 }
 
-OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
+/************************************************************************/
+/*                          readFeatureData()                           */
+/************************************************************************/
+
+// Read the size and the content of the feature at m_offset into m_featureBuf.
+// eof is set to true if the end of file is reached before the feature.
+OGRErr OGRFlatGeobufLayer::readFeatureData(bool seek, uint32_t &featureSize,
+                                           bool &eof)
 {
-    GIntBig fid;
-    auto seek = false;
-    if (m_queriedSpatialIndex && !m_ignoreSpatialFilter)
-    {
-        const auto item = m_foundItems[m_featuresPos];
-        m_offset = m_offsetFeatures + item.offset;
-        fid = item.index;
-        seek = true;
-    }
-    else
+    eof = false;
+    if (seek && m_queriedSpatialIndex && !m_ignoreSpatialFilter &&
+        readCoalescedFeature(featureSize))
     {
-        fid = m_featuresPos;
+        return OGRERR_NONE;
     }
-    poFeature->SetFID(fid);
-
-    // CPLDebugOnly("FlatGeobuf", "m_featuresPos: %lu", static_cast<long
-    // unsigned int>(m_featuresPos));
-
-    if (m_featuresPos == 0)
-        seek = true;
 
     if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
     {
         if (VSIFEofL(m_poFp))
+        {
+            eof = true;
             return OGRERR_NONE;
+        }
         return CPLErrorIO("seeking to feature location");
     }
-    uint32_t featureSize;
     if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
     {
         if (VSIFEofL(m_poFp))
+        {
+            eof = true;
             return OGRERR_NONE;
+        }
         return CPLErrorIO("reading feature size");
     }
     CPL_LSBPTR32(&featureSize);
@@ -1052,6 +1053,205 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
         return CPLErrorIO("reading feature");
     m_offset += featureSize + sizeof(featureSize);
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                        fillCoalescedRanges()                         */
+/************************************************************************/
+
+// Maximum amount of feature data fetched by a single fillCoalescedRanges()
+constexpr size_t MAX_COALESCED_BUF_SIZE = 16 * 1024 * 1024;
+
+// Group the features found in the spatial index search, starting at
+// m_featuresPos, into ranges of nearby features, and fetch them with a
+// single VSIFReadMultiRangeL() call, instead of a seek and read per feature,
+// which is particularly costly on network file systems.
+void OGRFlatGeobufLayer::fillCoalescedRanges()
+{
+    m_coalescedRanges.clear();
+    m_coalescedRangeIdx = 0;
+    // Unless ranges are successfully set up, do not try again for those items
+    m_coalescedItemsEnd = m_foundItems.size();
+
+    // Maximum distance between the start of two consecutive found features
+    // for them to be fetched in the same range.
+    const GIntBig nMaxGapSize = CPLAtoGIntBig(
+        CPLGetConfigOption("OGR_FLATGEOBUF_MAX_GAP_SIZE", "65536"));
+    if (nMaxGapSize <= 0)
+        return;
+    const uint64_t maxGap = static_cast<uint64_t>(nMaxGapSize);
+
+    if (m_nFileSize == 0)
+    {
+        VSIStatBufL sStatBuf;
+        if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+        {
+            m_nFileSize = sStatBuf.st_size;
+        }
+    }
+    if (m_nFileSize <= m_offsetFeatures)
+        return;
+
+    // The size of the last feature of a range is not known before reading
+    // it, unless it is immediately followed by the next found feature. Use
+    // twice the average feature size as an estimate: if it turns out to be
+    // too small, that feature is read directly by readFeatureData().
+    const uint64_t featuresCount =
+        std::max<uint64_t>(1, m_poHeader->features_count());
+    const uint64_t tailSize = std::max<uint64_t>(
+        4096, 2 * ((m_nFileSize - m_offsetFeatures) / featuresCount));
+
+    size_t bufSize = 0;
+    size_t i = m_featuresPos;
+    while (i < m_foundItems.size() && bufSize < MAX_COALESCED_BUF_SIZE)
+    {
+        const auto &first = m_foundItems[i];
+        size_t j = i;
+        while (j + 1 < m_foundItems.size() &&
+               m_foundItems[j + 1].offset > m_foundItems[j].offset &&
+               m_foundItems[j + 1].offset - m_foundItems[j].offset <= maxGap &&
+               m_foundItems[j + 1].offset - first.offset <=
+                   MAX_COALESCED_BUF_SIZE - bufSize)
+        {
+            ++j;
+        }
+        const auto &last = m_foundItems[j];
+        uint64_t end = m_offsetFeatures + last.offset + tailSize;
+        if (j + 1 < m_foundItems.size())
+        {
+            const auto &next = m_foundItems[j + 1];
+            if (next.index == last.index + 1 || next.offset < last.offset ||
+                m_offsetFeatures + next.offset < end)
+            {
+                end = m_offsetFeatures + next.offset;
+            }
+        }
+        end = std::min<uint64_t>(end, m_nFileSize);
+        const uint64_t start = m_offsetFeatures + first.offset;
+        if (end <= start + sizeof(uint32_t))
+            break;
+        const size_t size = static_cast<size_t>(
+            std::min<uint64_t>(end - start, MAX_COALESCED_BUF_SIZE));
+        m_coalescedRanges.push_back(CoalescedRange{start, size, bufSize});
+        bufSize += size;
+        i = j + 1;
+    }
+    if (m_coalescedRanges.empty())
+    {
+        m_coalescedItemsEnd = m_featuresPos + 1;
+        return;
+    }
+
+    try
+    {
+        m_coalescedBuf.resize(bufSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLDebug("FlatGeobuf", "Cannot allocate %lu bytes for coalesced reads",
+                 static_cast<long unsigned int>(bufSize));
+        m_coalescedRanges.clear();
+        return;
+    }
+
+    const size_t nRanges = m_coalescedRanges.size();
+    std::vector<void *> apData(nRanges);
+    std::vector<vsi_l_offset> anOffsets(nRanges);
+    std::vector<size_t> anSizes(nRanges);
+    for (size_t k = 0; k < nRanges; ++k)
+    {
+        const auto &range = m_coalescedRanges[k];
+        apData[k] = m_coalescedBuf.data() + range.bufOffset;
+        anOffsets[k] = range.offset;
+        anSizes[k] = range.size;
+    }
+    CPLDebugOnly("FlatGeobuf",
+                 "Fetching %lu found features in %lu ranges (%lu bytes)",
+                 static_cast<long unsigned int>(i - m_featuresPos),
+                 static_cast<long unsigned int>(nRanges),
+                 static_cast<long unsigned int>(bufSize));
+    if (VSIFReadMultiRangeL(static_cast<int>(nRanges), apData.data(),
+                            anOffsets.data(), anSizes.data(), m_poFp) != 0)
+    {
+        CPLDebug("FlatGeobuf", "VSIFReadMultiRangeL() failed");
+        m_coalescedRanges.clear();
+    }
+    else
+    {
+        m_coalescedItemsEnd = i;
+    }
+    // Reset the file position and the end-of-file indicator
+    VSIFSeekL(m_poFp, m_offset, SEEK_SET);
+}
+
+/************************************************************************/
+/*                        readCoalescedFeature()                        */
+/************************************************************************/
+
+// Copy the feature at m_offset into m_featureBuf from the ranges fetched by
+// fillCoalescedRanges(). Returns false if it must be read directly instead.
+bool OGRFlatGeobufLayer::readCoalescedFeature(uint32_t &featureSize)
+{
+    if (m_featuresPos >= m_coalescedItemsEnd)
+        fillCoalescedRanges();
+
+    while (m_coalescedRangeIdx < m_coalescedRanges.size() &&
+           m_coalescedRanges[m_coalescedRangeIdx].offset +
+                   m_coalescedRanges[m_coalescedRangeIdx].size <=
+               m_offset)
+    {
+        ++m_coalescedRangeIdx;
+    }
+    if (m_coalescedRangeIdx == m_coalescedRanges.size())
+        return false;
+    const auto &range = m_coalescedRanges[m_coalescedRangeIdx];
+    if (m_offset < range.offset)
+        return false;
+    const size_t posInRange = static_cast<size_t>(m_offset - range.offset);
+    if (range.size - posInRange < sizeof(featureSize))
+        return false;
+    const GByte *data = m_coalescedBuf.data() + range.bufOffset + posInRange;
+    memcpy(&featureSize, data, sizeof(featureSize));
+    CPL_LSBPTR32(&featureSize);
+    if (featureSize > range.size - posInRange - sizeof(featureSize))
+        return false;
+
+    if (ensureFeatureBuf(featureSize) != OGRERR_NONE)
+        return false;
+    memcpy(m_featureBuf, data + sizeof(featureSize), featureSize);
+    m_offset += featureSize + sizeof(featureSize);
+    return true;
+}
+
+OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
+{
+    GIntBig fid;
+    auto seek = false;
+    if (m_queriedSpatialIndex && !m_ignoreSpatialFilter)
+    {
+        const auto item = m_foundItems[m_featuresPos];
+        m_offset = m_offsetFeatures + item.offset;
+        fid = item.index;
+        seek = true;
+    }
+    else
+    {
+        fid = m_featuresPos;
+    }
+    poFeature->SetFID(fid);
+
+    // CPLDebugOnly("FlatGeobuf", "m_featuresPos: %lu", static_cast<long
+    // unsigned int>(m_featuresPos));
+
+    if (m_featuresPos == 0)
+        seek = true;
+
+    uint32_t featureSize = 0;
+    bool eof = false;
+    const auto err = readFeatureData(seek, featureSize, eof);
+    if (err != OGRERR_NONE || eof)
+        return err;
 
     if (m_bVerifyBuffers)
     {
@@ -1448,54 +1648,12 @@ int OGRFlatGeobufLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         if (m_featuresPos == 0)
             seek = true;
 
-        if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
-        {
-            break;
-        }
-        uint32_t featureSize;
-        if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
-        {
-            if (VSIFEofL(m_poFp))
-                break;
-            CPLErrorIO("reading feature size");
+        uint32_t featureSize = 0;
+        bool eof = false;
+        if (readFeatureData(seek, featureSize, eof) != OGRERR_NONE)
             goto error;
-        }
-        CPL_LSBPTR32(&featureSize);
-
-        // Sanity check to avoid allocated huge amount of memory on corrupted
-        // feature
-        if (featureSize > 100 * 1024 * 1024)
-        {
-            if (featureSize > feature_max_buffer_size)
-            {
-                CPLErrorInvalidSize("feature");
-                goto error;
-            }
-
-            if (m_nFileSize == 0)
-            {
-                VSIStatBufL sStatBuf;
-                if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
-                {
-                    m_nFileSize = sStatBuf.st_size;
-                }
-            }
-            if (m_offset + featureSize > m_nFileSize)
-            {
-                CPLErrorIO("reading feature size");
-                goto error;
-            }
-        }
-
-        const auto err = ensureFeatureBuf(featureSize);
-        if (err != OGRERR_NONE)
-            goto error;
-        if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
-        {
-            CPLErrorIO("reading feature");
-            goto error;
-        }
-        m_offset += featureSize + sizeof(featureSize);
+        if (eof)
+            break;
 
         if (m_bVerifyBuffers)
         {
@@ -2256,6 +2414,9 @@ void OGRFlatGeobufLayer::ResetReading()
     m_bEOF = false;
     m_featuresPos = 0;
     m_foundItems.clear();
+    m_coalescedRanges.clear();
+    m_coalescedRangeIdx = 0;
+    m_coalescedItemsEnd = 0;
     m_featuresCount = m_poHeader ? m_poHeader->features_count() : 0;
     m_queriedSpatialIndex = false;
     m_ignoreSpatialFilter = false;
@@ -33,7 +33,13 @@
 #include "cpl_string.h"
 #include "ogr_api.h"
 #include "cpl_time.h"
+#include "cpl_vsi.h"
+#include "ogr_attrind.h"
 #include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -52,6 +58,122 @@ class OGRGenSQLGeomFieldDefn final : public OGRGeomFieldDefn
     int bForceGeomType;
 };
 
+/************************************************************************/
+/*                   OGRGenSQLResultsLayer::HashJoin                    */
+/************************************************************************/
+
+// Maps the value of the join key of a secondary layer to its first
+// matching feature. Used instead of installing an attribute filter on the
+// secondary layer for each primary feature, which costs a full scan of the
+// secondary layer per primary feature when it has no attribute index.
+struct OGRGenSQLResultsLayer::HashJoin
+{
+    struct Entry
+    {
+        GIntBig nFID = OGRNullFID;
+        OGRFeatureUniquePtr poFeature{};
+    };
+
+    int iPrimaryField = -1;
+    bool bStringKey = false;
+
+    // Set when the features did not fit in memory: only their FID is
+    // kept, and they are fetched again from the secondary layer.
+    bool bFIDOnly = false;
+
+    std::unordered_map<GIntBig, Entry> oMapInteger{};
+    std::unordered_map<std::string, Entry> oMapString{};
+
+    OGRFeature *GetJoinFeature(OGRFeature *poSrcFeat,
+                               OGRLayer *poJoinLayer) const;
+};
+
+/************************************************************************/
+/*                           GetJoinFeature()                           */
+/************************************************************************/
+
+OGRFeature *
+OGRGenSQLResultsLayer::HashJoin::GetJoinFeature(OGRFeature *poSrcFeat,
+                                                OGRLayer *poJoinLayer) const
+{
+    // if source key is null, we can't do join.
+    if (!poSrcFeat->IsFieldSetAndNotNull(iPrimaryField))
+        return nullptr;
+
+    const Entry *psEntry = nullptr;
+    if (bStringKey)
+    {
+        // OGR SQL string equality is case insensitive
+        const auto oIter = oMapString.find(
+            CPLString(poSrcFeat->GetFieldAsString(iPrimaryField)).toupper());
+        if (oIter != oMapString.end())
+            psEntry = &(oIter->second);
+    }
+    else
+    {
+        const auto oIter =
+            oMapInteger.find(poSrcFeat->GetFieldAsInteger64(iPrimaryField));
+        if (oIter != oMapInteger.end())
+            psEntry = &(oIter->second);
+    }
+
+    if (psEntry == nullptr)
+        return nullptr;
+    if (psEntry->poFeature)
+        return psEntry->poFeature->Clone();
+    return poJoinLayer->GetFeature(psEntry->nFID);
+}
+
+/************************************************************************/
+/*                   OGRGenSQLEstimateFeatureMemory()                   */
+/************************************************************************/
+
+static size_t OGRGenSQLEstimateFeatureMemory(const OGRFeature *poFeature)
+{
+    const int nFieldCount = poFeature->GetFieldCount();
+    size_t nSize = sizeof(OGRFeature) + nFieldCount * sizeof(OGRField);
+    for (int iField = 0; iField < nFieldCount; iField++)
+    {
+        if (!poFeature->IsFieldSetAndNotNull(iField))
+            continue;
+        const OGRField *psField = poFeature->GetRawFieldRef(iField);
+        switch (poFeature->GetFieldDefnRef(iField)->GetType())
+        {
+            case OFTString:
+                nSize += strlen(psField->String) + 1;
+                break;
+            case OFTBinary:
+                nSize += psField->Binary.nCount;
+                break;
+            case OFTIntegerList:
+                nSize += psField->IntegerList.nCount * sizeof(int);
+                break;
+            case OFTInteger64List:
+                nSize += psField->Integer64List.nCount * sizeof(GIntBig);
+                break;
+            case OFTRealList:
+                nSize += psField->RealList.nCount * sizeof(double);
+                break;
+            case OFTStringList:
+                for (int i = 0; i < psField->StringList.nCount; i++)
+                    nSize += sizeof(char *) +
+                             strlen(psField->StringList.paList[i]) + 1;
+                break;
+            default:
+                break;
+        }
+    }
+    for (int iGeomField = 0; iGeomField < poFeature->GetGeomFieldCount();
+         iGeomField++)
+    {
+        const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(iGeomField);
+        // Rough account of the overhead of the in-memory representation
+        if (poGeom)
+            nSize += 2 * poGeom->WkbSize();
+    }
+    return nSize;
+}
+
 /************************************************************************/
 /*               OGRGenSQLResultsLayerHasSpecialField()                 */
 /************************************************************************/
@@ -500,13 +622,16 @@ OGRGenSQLResultsLayer::~OGRGenSQLResultsLayer()
 
     OGRGenSQLResultsLayer::ClearFilters();
 
+    // Must be done before closing the datasets of the joined layers
+    m_apoHashJoins.clear();
+
     /* -------------------------------------------------------------------- */
     /*      Free various datastructures.                                    */
     /* -------------------------------------------------------------------- */
     CPLFree(papoTableLayers);
     papoTableLayers = nullptr;
 
-    CPLFree(panFIDIndex);
+    InvalidateOrderByIndex();
     CPLFree(panGeomFieldToSrcGeomField);
 
     delete poSummaryFeature;
@@ -657,8 +782,7 @@ OGRErr OGRGenSQLResultsLayer::SetNextByIndex(GIntBig nIndex)
     CreateOrderByIndex();
 
     if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
-        psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
-        panFIDIndex != nullptr)
+        psSelectInfo->query_mode == SWQM_DISTINCT_LIST || HasOrderByIndex())
     {
         nNextIndexFID = nIndex + psSelectInfo->offset;
         return OGRERR_NONE;
@@ -758,7 +882,7 @@ int OGRGenSQLResultsLayer::TestCapability(const char *pszCap)
     {
         if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
             psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
-            panFIDIndex != nullptr)
+            HasOrderByIndex())
             return TRUE;
         else
             return poSrcLayer->TestCapability(pszCap);
@@ -1282,6 +1406,175 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                          PrepareHashJoins()                          */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::PrepareHashJoins()
+{
+    m_bHashJoinsPrepared = true;
+
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+    m_apoHashJoins.resize(psSelectInfo->join_count);
+    const bool bEnabled =
+        CPLTestBool(CPLGetConfigOption("OGR_SQL_HASH_JOIN", "YES"));
+    m_anHashJoinFilteredFeatures.assign(psSelectInfo->join_count,
+                                        bEnabled ? 0 : -1);
+    // Reading the whole secondary layer is only worth it if many primary
+    // features are to be joined.
+    m_nHashJoinMinFeatures = std::max(
+        1, atoi(CPLGetConfigOption("OGR_SQL_HASH_JOIN_MIN_FEATURES", "100")));
+}
+
+/************************************************************************/
+/*                           BuildHashJoin()                            */
+/*                                                                      */
+/*      Read the secondary layer of a join once, and build a hash       */
+/*      table over its join key. Returns null if the join condition     */
+/*      is not a simple equality between two columns of compatible      */
+/*      types, if the secondary layer has an attribute index on the     */
+/*      key, or if the table does not fit in memory and the layer       */
+/*      lacks efficient random reading.                                 */
+/*                                                                      */
+/*      Only used for secondary layers whose attribute filters are      */
+/*      evaluated by OGR, whose string equality is case insensitive,    */
+/*      like the lookup of string keys in the hash table.               */
+/************************************************************************/
+
+std::unique_ptr<OGRGenSQLResultsLayer::HashJoin>
+OGRGenSQLResultsLayer::BuildHashJoin(swq_join_def *psJoinInfo)
+{
+    swq_expr_node *poExpr = psJoinInfo->poExpr;
+    if (poExpr == nullptr || poExpr->eNodeType != SNT_OPERATION ||
+        poExpr->nOperation != SWQ_EQ || poExpr->nSubExprCount != 2 ||
+        poExpr->papoSubExpr[0]->eNodeType != SNT_COLUMN ||
+        poExpr->papoSubExpr[1]->eNodeType != SNT_COLUMN)
+    {
+        return nullptr;
+    }
+
+    swq_expr_node *poPrimaryColumn = poExpr->papoSubExpr[0];
+    swq_expr_node *poSecondaryColumn = poExpr->papoSubExpr[1];
+    if (poPrimaryColumn->table_index != 0)
+        std::swap(poPrimaryColumn, poSecondaryColumn);
+    if (poPrimaryColumn->table_index != 0 ||
+        poSecondaryColumn->table_index != psJoinInfo->secondary_table)
+    {
+        return nullptr;
+    }
+
+    OGRLayer *poJoinLayer = papoTableLayers[psJoinInfo->secondary_table];
+    // A self join would interfere with the reading of the primary layer
+    if (poJoinLayer == poSrcLayer)
+        return nullptr;
+
+    OGRFeatureDefn *poPrimaryDefn = poSrcLayer->GetLayerDefn();
+    OGRFeatureDefn *poSecondaryDefn = poJoinLayer->GetLayerDefn();
+    const int iPrimaryField = poPrimaryColumn->field_index;
+    const int iSecondaryField = poSecondaryColumn->field_index;
+    if (iPrimaryField < 0 || iPrimaryField >= poPrimaryDefn->GetFieldCount() ||
+        iSecondaryField < 0 ||
+        iSecondaryField >= poSecondaryDefn->GetFieldCount())
+    {
+        return nullptr;
+    }
+
+    const auto IsInteger = [](OGRFieldType eType)
+    { return eType == OFTInteger || eType == OFTInteger64; };
+    const OGRFieldType ePrimaryType =
+        poPrimaryDefn->GetFieldDefn(iPrimaryField)->GetType();
+    const OGRFieldType eSecondaryType =
+        poSecondaryDefn->GetFieldDefn(iSecondaryField)->GetType();
+    const bool bStringKey =
+        ePrimaryType == OFTString && eSecondaryType == OFTString;
+    if (!bStringKey && !(IsInteger(ePrimaryType) && IsInteger(eSecondaryType)))
+        return nullptr;
+
+    // An attribute filter will be fast enough
+    if (poJoinLayer->GetIndex() != nullptr &&
+        poJoinLayer->GetIndex()->GetFieldIndex(iSecondaryField) != nullptr)
+    {
+        return nullptr;
+    }
+
+    const GIntBig nMaxMemory = CPLAtoGIntBig(
+        CPLGetConfigOption("OGR_SQL_HASH_JOIN_MAX_MEMORY", "268435456"));
+    const bool bCanSpill =
+        CPL_TO_BOOL(poJoinLayer->TestCapability(OLCRandomRead));
+
+    auto poHashJoin = cpl::make_unique<HashJoin>();
+    poHashJoin->iPrimaryField = iPrimaryField;
+    poHashJoin->bStringKey = bStringKey;
+
+    CPLDebug("GenSQL", "Building hash table for join on layer '%s'",
+             poJoinLayer->GetName());
+
+    GIntBig nMemory = 0;
+    poJoinLayer->SetAttributeFilter(nullptr);
+    poJoinLayer->ResetReading();
+    for (auto &&poFeature : *poJoinLayer)
+    {
+        if (!poFeature->IsFieldSetAndNotNull(iSecondaryField))
+            continue;
+
+        HashJoin::Entry *psEntry;
+        if (bStringKey)
+        {
+            auto oRes = poHashJoin->oMapString.emplace(
+                CPLString(poFeature->GetFieldAsString(iSecondaryField))
+                    .toupper(),
+                HashJoin::Entry());
+            // Only the first matching feature is used
+            if (!oRes.second)
+                continue;
+            psEntry = &(oRes.first->second);
+        }
+        else
+        {
+            auto oRes = poHashJoin->oMapInteger.emplace(
+                poFeature->GetFieldAsInteger64(iSecondaryField),
+                HashJoin::Entry());
+            if (!oRes.second)
+                continue;
+            psEntry = &(oRes.first->second);
+        }
+
+        psEntry->nFID = poFeature->GetFID();
+        if (poHashJoin->bFIDOnly)
+            continue;
+
+        nMemory += static_cast<GIntBig>(
+            OGRGenSQLEstimateFeatureMemory(poFeature.get()));
+        if (nMemory > nMaxMemory)
+        {
+            if (!bCanSpill || psEntry->nFID == OGRNullFID)
+            {
+                CPLDebug("GenSQL",
+                         "Hash table for join on layer '%s' exceeds "
+                         "OGR_SQL_HASH_JOIN_MAX_MEMORY. Using attribute "
+                         "filters instead",
+                         poJoinLayer->GetName());
+                poJoinLayer->ResetReading();
+                return nullptr;
+            }
+            CPLDebug("GenSQL",
+                     "Hash table for join on layer '%s' exceeds "
+                     "OGR_SQL_HASH_JOIN_MAX_MEMORY. Only keeping FIDs",
+                     poJoinLayer->GetName());
+            poHashJoin->bFIDOnly = true;
+            for (auto &oIter : poHashJoin->oMapInteger)
+                oIter.second.poFeature.reset();
+            for (auto &oIter : poHashJoin->oMapString)
+                oIter.second.poFeature.reset();
+            continue;
+        }
+        psEntry->poFeature = std::move(poFeature);
+    }
+    poJoinLayer->ResetReading();
+
+    return poHashJoin;
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1315,6 +1608,20 @@ OGRFeature *OGRGenSQLResultsLayer::TranslateFeature(OGRFeature *poSrcFeat)
 
         OGRLayer *poJoinLayer = papoTableLayers[psJoinInfo->secondary_table];
 
+        if (!m_bHashJoinsPrepared)
+            PrepareHashJoins();
+        if (m_anHashJoinFilteredFeatures[iJoin] == m_nHashJoinMinFeatures)
+        {
+            m_anHashJoinFilteredFeatures[iJoin] = -1;
+            m_apoHashJoins[iJoin] = BuildHashJoin(psJoinInfo);
+        }
+        if (m_apoHashJoins[iJoin])
+        {
+            apoFeatures.push_back(
+                m_apoHashJoins[iJoin]->GetJoinFeature(poSrcFeat, poJoinLayer));
+            continue;
+        }
+
         osFilter = GetFilterForJoin(psJoinInfo->poExpr, poSrcFeat, poJoinLayer,
                                     psJoinInfo->secondary_table);
         // CPLDebug("OGR", "Filter = %s\n", osFilter.c_str());
@@ -1333,6 +1640,16 @@ OGRFeature *OGRGenSQLResultsLayer::TranslateFeature(OGRFeature *poSrcFeat)
             poJoinFeature = poJoinLayer->GetNextFeature();
 
         apoFeatures.push_back(poJoinFeature);
+
+        if (m_anHashJoinFilteredFeatures[iJoin] >= 0)
+        {
+            // Drivers that translate attribute filters use their own
+            // indexes and comparison rules: keep using filters with them.
+            if (poJoinLayer->GetAttrQuery() == nullptr)
+                m_anHashJoinFilteredFeatures[iJoin] = -1;
+            else
+                m_anHashJoinFilteredFeatures[iJoin]++;
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -1594,7 +1911,7 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
         return nullptr;
 
     CreateOrderByIndex();
-    if (panFIDIndex == nullptr && nIteratedFeatures < 0 &&
+    if (!HasOrderByIndex() && nIteratedFeatures < 0 &&
         psSelectInfo->offset > 0 && psSelectInfo->query_mode == SWQM_RECORDSET)
     {
         poSrcLayer->SetNextByIndex(psSelectInfo->offset);
@@ -1620,7 +1937,7 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
     while (true)
     {
         std::unique_ptr<OGRFeature> poSrcFeat;
-        if (panFIDIndex != nullptr)
+        if (HasOrderByIndex())
         {
             /* --------------------------------------------------------------------
              */
@@ -1633,7 +1950,8 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
             if (nNextIndexFID >= static_cast<GIntBig>(nIndexSize))
                 return nullptr;
 
-            poSrcFeat.reset(poSrcLayer->GetFeature(panFIDIndex[nNextIndexFID]));
+            poSrcFeat.reset(
+                poSrcLayer->GetFeature(GetOrderByIndexFID(nNextIndexFID)));
             nNextIndexFID++;
         }
         else
@@ -1931,8 +2249,10 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
 /*      this in memory copy of the order-by fields to create the        */
 /*      required index.                                                 */
 /*                                                                      */
-/*      Keeping all the key values in memory will *not* scale up to     */
-/*      very large input datasets.                                      */
+/*      When the key values do not fit in OGR_SQL_ORDER_BY_MAX_MEMORY,  */
+/*      sorted runs are spilled to a temporary file, and merged into    */
+/*      a temporary file of sorted FIDs.  With a LIMIT clause, only     */
+/*      the OFFSET + LIMIT best records are kept in a heap.             */
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::CreateOrderByIndex()
@@ -1997,6 +2317,35 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         return;
     }
 
+    GIntBig nMaxMemory = CPLGetUsablePhysicalRAM() / 4;
+    const char *pszMaxMemory =
+        CPLGetConfigOption("OGR_SQL_ORDER_BY_MAX_MEMORY", nullptr);
+    if (pszMaxMemory)
+        nMaxMemory = CPLAtoGIntBig(pszMaxMemory);
+    if (nMaxMemory <= 0)
+        nMaxMemory = std::numeric_limits<GIntBig>::max();
+
+    // Memory used per record, not counting the content of strings
+    const size_t nRecordSize =
+        sizeof(OGRField) * nOrderItems + 3 * sizeof(GIntBig);
+
+    /* -------------------------------------------------------------------- */
+    /*      Optimize ORDER BY ... LIMIT n [OFFSET m] case by only keeping   */
+    /*      the n + m best records.                                         */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->limit > 0 && psSelectInfo->offset >= 0 &&
+        psSelectInfo->limit <
+            nMaxMemory / static_cast<GIntBig>(nRecordSize) -
+                psSelectInfo->offset &&
+        static_cast<GUIntBig>(psSelectInfo->limit + psSelectInfo->offset) <
+            std::numeric_limits<size_t>::max() / nRecordSize)
+    {
+        CreateOrderByIndexTopK(
+            static_cast<size_t>(psSelectInfo->limit + psSelectInfo->offset));
+        ResetReading();
+        return;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate set of key values, and the output index.               */
     /* -------------------------------------------------------------------- */
@@ -2014,6 +2363,72 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     OGRFeature *poSrcFeat = nullptr;
     nIndexSize = 0;
 
+    // State of the external sort
+    VSILFILE *fpRuns = nullptr;
+    std::string osRunsFilename;
+    std::vector<std::pair<vsi_l_offset, size_t>> aoRuns;
+    GIntBig nSpilledRecords = 0;
+    GIntBig nMemory = 0;
+
+    const auto CloseRuns = [&fpRuns, &osRunsFilename]()
+    {
+        if (fpRuns)
+        {
+            VSIFCloseL(fpRuns);
+            VSIUnlink(osRunsFilename.c_str());
+            fpRuns = nullptr;
+        }
+    };
+
+    // Sort the records currently in memory, and write them as a new run
+    // of the temporary file.
+    const auto SpillRun =
+        [this, &fpRuns, &osRunsFilename, &aoRuns, &nSpilledRecords, &nMemory,
+         &pasIndexFields, &panFIDList, nOrderItems]()
+    {
+        if (fpRuns == nullptr)
+        {
+            osRunsFilename = CPLGenerateTempFilename("ogr_sql_order_by");
+            fpRuns = VSIFOpenL(osRunsFilename.c_str(), "wb+");
+            if (fpRuns == nullptr)
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                         osRunsFilename.c_str());
+                return false;
+            }
+            CPLDebug("GenSQL", "ORDER BY index exceeds "
+                               "OGR_SQL_ORDER_BY_MAX_MEMORY. Using a "
+                               "temporary file");
+        }
+
+        panFIDIndex = static_cast<GIntBig *>(
+            VSI_MALLOC_VERBOSE(sizeof(GIntBig) * nIndexSize));
+        GIntBig *panMerged = static_cast<GIntBig *>(
+            VSI_MALLOC_VERBOSE(sizeof(GIntBig) * nIndexSize));
+        bool bOK = panFIDIndex != nullptr && panMerged != nullptr;
+        if (bOK)
+        {
+            for (size_t i = 0; i < nIndexSize; i++)
+                panFIDIndex[i] = static_cast<GIntBig>(i);
+            SortIndexSection(pasIndexFields, panMerged, 0, nIndexSize);
+
+            VSIFSeekL(fpRuns, 0, SEEK_END);
+            aoRuns.emplace_back(VSIFTellL(fpRuns), nIndexSize);
+            bOK = WriteSortRun(fpRuns, pasIndexFields, panFIDList,
+                               nSpilledRecords, nIndexSize);
+        }
+        VSIFree(panMerged);
+        CPLFree(panFIDIndex);
+        panFIDIndex = nullptr;
+
+        FreeIndexFields(pasIndexFields, nIndexSize, false);
+        memset(pasIndexFields, 0, sizeof(OGRField) * nOrderItems * nIndexSize);
+        nSpilledRecords += nIndexSize;
+        nIndexSize = 0;
+        nMemory = 0;
+        return bOK;
+    };
+
     while ((poSrcFeat = poSrcLayer->GetNextFeature()) != nullptr)
     {
         if (nIndexSize == nFeaturesAlloc)
@@ -2079,11 +2494,42 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         panFIDList[nIndexSize] = poSrcFeat->GetFID();
         delete poSrcFeat;
 
+        nMemory += static_cast<GIntBig>(
+            nRecordSize +
+            GetIndexFieldsMemory(pasIndexFields + nIndexSize * nOrderItems));
         nIndexSize++;
+
+        if (nMemory > nMaxMemory && !SpillRun())
+        {
+            CloseRuns();
+            FreeIndexFields(pasIndexFields, nIndexSize);
+            VSIFree(panFIDList);
+            nIndexSize = 0;
+            return;
+        }
     }
 
     // CPLDebug("GenSQL", "CreateOrderByIndex() = %d features", nIndexSize);
 
+    /* -------------------------------------------------------------------- */
+    /*      Merge the runs of the external sort.                            */
+    /* -------------------------------------------------------------------- */
+    if (fpRuns != nullptr)
+    {
+        bool bOK = nIndexSize == 0 || SpillRun();
+        FreeIndexFields(pasIndexFields, 0);
+        VSIFree(panFIDList);
+        bOK = bOK && MergeSortRuns(fpRuns, aoRuns);
+        CloseRuns();
+        if (!bOK)
+            InvalidateOrderByIndex();
+        // Keep the index considered valid, even on error, to avoid trying
+        // to build it again at each GetNextFeature() call.
+        bOrderByValid = TRUE;
+        ResetReading();
+        return;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Initialize panFIDIndex                                          */
     /* -------------------------------------------------------------------- */
@@ -2148,6 +2594,449 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     ResetReading();
 }
 
+/************************************************************************/
+/*                       CreateOrderByIndexTopK()                       */
+/*                                                                      */
+/*      Build the ORDER BY index with only the nK first records, by     */
+/*      maintaining a max-heap of the best records read so far.         */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::CreateOrderByIndexTopK(size_t nK)
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+    const int nOrderItems = psSelectInfo->order_specs;
+
+    // Slot nK is used to read the current record
+    std::vector<OGRField> asKeys;
+    std::vector<GIntBig> anFIDs;
+    std::vector<GIntBig> anSeqs;
+    std::vector<size_t> anHeap;
+    try
+    {
+        asKeys.resize((nK + 1) * nOrderItems);
+        anFIDs.resize(nK + 1);
+        anSeqs.resize(nK + 1);
+        anHeap.reserve(nK);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate ORDER BY index");
+        nIndexSize = 0;
+        return false;
+    }
+
+    // Records that compare equal are ordered by reading order, as done by
+    // the stable SortIndexSection().
+    const auto Less = [this, &asKeys, &anSeqs, nOrderItems](size_t a, size_t b)
+    {
+        const int nRes =
+            Compare(&asKeys[a * nOrderItems], &asKeys[b * nOrderItems]);
+        return nRes < 0 || (nRes == 0 && anSeqs[a] < anSeqs[b]);
+    };
+
+    OGRFeature *poSrcFeat = nullptr;
+    GIntBig nSeq = 0;
+    while ((poSrcFeat = poSrcLayer->GetNextFeature()) != nullptr)
+    {
+        const size_t iSlot = anHeap.size() < nK ? anHeap.size() : nK;
+        OGRField *pasFields = &asKeys[iSlot * nOrderItems];
+        ReadIndexFields(poSrcFeat, nOrderItems, pasFields);
+        anFIDs[iSlot] = poSrcFeat->GetFID();
+        anSeqs[iSlot] = nSeq++;
+        delete poSrcFeat;
+
+        if (iSlot < nK)
+        {
+            anHeap.push_back(iSlot);
+            std::push_heap(anHeap.begin(), anHeap.end(), Less);
+            continue;
+        }
+
+        // Replace the worst record of the heap if the current one is better
+        if (Less(nK, anHeap.front()))
+        {
+            std::pop_heap(anHeap.begin(), anHeap.end(), Less);
+            const size_t iWorst = anHeap.back();
+            FreeIndexFields(&asKeys[iWorst * nOrderItems], 1, false);
+            memcpy(&asKeys[iWorst * nOrderItems], pasFields,
+                   sizeof(OGRField) * nOrderItems);
+            anFIDs[iWorst] = anFIDs[nK];
+            anSeqs[iWorst] = anSeqs[nK];
+            std::push_heap(anHeap.begin(), anHeap.end(), Less);
+        }
+        else
+        {
+            FreeIndexFields(pasFields, 1, false);
+        }
+        memset(pasFields, 0, sizeof(OGRField) * nOrderItems);
+    }
+
+    std::sort(anHeap.begin(), anHeap.end(), Less);
+
+    nIndexSize = anHeap.size();
+    bool bAlreadySorted = true;
+    for (size_t i = 0; i < nIndexSize; i++)
+    {
+        if (anSeqs[anHeap[i]] != static_cast<GIntBig>(i))
+            bAlreadySorted = false;
+    }
+
+    // See comment at the end of CreateOrderByIndex()
+    if (!bAlreadySorted)
+    {
+        panFIDIndex = static_cast<GIntBig *>(
+            VSI_MALLOC_VERBOSE(sizeof(GIntBig) * nIndexSize));
+    }
+    if (panFIDIndex)
+    {
+        for (size_t i = 0; i < nIndexSize; i++)
+            panFIDIndex[i] = anFIDs[anHeap[i]];
+    }
+    else
+    {
+        nIndexSize = 0;
+    }
+
+    for (size_t i = 0; i < anHeap.size(); i++)
+        FreeIndexFields(&asKeys[i * nOrderItems], 1, false);
+
+    return bAlreadySorted || panFIDIndex != nullptr;
+}
+
+/************************************************************************/
+/*                          IsStringOrderKey()                          */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::IsStringOrderKey(int iKey)
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+    const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
+    if (psKeyDef->field_index >= iFIDFieldIndex)
+    {
+        return SpecialFieldTypes[psKeyDef->field_index - iFIDFieldIndex] ==
+               SWQ_STRING;
+    }
+    return poSrcLayer->GetLayerDefn()
+               ->GetFieldDefn(psKeyDef->field_index)
+               ->GetType() == OFTString;
+}
+
+/************************************************************************/
+/*                        GetIndexFieldsMemory()                        */
+/*                                                                      */
+/*      Return the memory used by the strings of a record.              */
+/************************************************************************/
+
+size_t
+OGRGenSQLResultsLayer::GetIndexFieldsMemory(const OGRField *pasIndexFields)
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+    size_t nSize = 0;
+    for (int iKey = 0; iKey < psSelectInfo->order_specs; iKey++)
+    {
+        const OGRField *psField = pasIndexFields + iKey;
+        if (IsStringOrderKey(iKey) && !OGR_RawField_IsUnset(psField) &&
+            !OGR_RawField_IsNull(psField))
+        {
+            nSize += strlen(psField->String) + 1;
+        }
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                            WriteSortRun()                            */
+/*                                                                      */
+/*      Write the records of pasIndexFields in the order of             */
+/*      panFIDIndex at the current position of fp. Each record is       */
+/*      made of the key values, the FID and the position of the         */
+/*      record in the source layer.                                     */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::WriteSortRun(VSILFILE *fp,
+                                         const OGRField *pasIndexFields,
+                                         const GIntBig *panFIDList,
+                                         GIntBig nFirstSeq, size_t nEntries)
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+    const int nOrderItems = psSelectInfo->order_specs;
+    std::vector<bool> abStringKey;
+    for (int iKey = 0; iKey < nOrderItems; iKey++)
+        abStringKey.push_back(IsStringOrderKey(iKey));
+
+    std::vector<GByte> abyBuffer;
+    const auto Append = [&abyBuffer](const void *pData, size_t nSize)
+    {
+        const GByte *pabyData = static_cast<const GByte *>(pData);
+        abyBuffer.insert(abyBuffer.end(), pabyData, pabyData + nSize);
+    };
+
+    for (size_t i = 0; i < nEntries; i++)
+    {
+        const size_t iEntry = static_cast<size_t>(panFIDIndex[i]);
+        const OGRField *pasFields = pasIndexFields + iEntry * nOrderItems;
+        for (int iKey = 0; iKey < nOrderItems; iKey++)
+        {
+            const OGRField *psField = pasFields + iKey;
+            if (abStringKey[iKey])
+            {
+                const GByte bIsString = !OGR_RawField_IsUnset(psField) &&
+                                        !OGR_RawField_IsNull(psField);
+                Append(&bIsString, 1);
+                if (bIsString)
+                {
+                    const uint32_t nLen =
+                        static_cast<uint32_t>(strlen(psField->String));
+                    Append(&nLen, sizeof(nLen));
+                    Append(psField->String, nLen);
+                    continue;
+                }
+            }
+            Append(psField, sizeof(OGRField));
+        }
+        const GIntBig nSeq = nFirstSeq + static_cast<GIntBig>(iEntry);
+        Append(&panFIDList[iEntry], sizeof(GIntBig));
+        Append(&nSeq, sizeof(GIntBig));
+
+        if (abyBuffer.size() >= 1024 * 1024 || i + 1 == nEntries)
+        {
+            if (VSIFWriteL(abyBuffer.data(), 1, abyBuffer.size(), fp) !=
+                abyBuffer.size())
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Cannot write ORDER BY temporary file");
+                return false;
+            }
+            abyBuffer.clear();
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       OGRGenSQLSortRunReader                         */
+/************************************************************************/
+
+namespace
+{
+// Buffered reader of one run of the temporary file of the external sort
+struct OGRGenSQLSortRunReader
+{
+    VSILFILE *fp = nullptr;
+    vsi_l_offset nOffset = 0;
+    vsi_l_offset nEndOffset = 0;
+    std::vector<GByte> abyBuffer{};
+    size_t nBufferPos = 0;
+    size_t nRemainingRecords = 0;
+
+    // Current record
+    std::vector<OGRField> asFields{};
+    GIntBig nFID = 0;
+    GIntBig nSeq = 0;
+
+    bool Read(void *pDst, size_t nSize);
+    bool ReadRecord(const std::vector<bool> &abStringKey);
+};
+
+bool OGRGenSQLSortRunReader::Read(void *pDst, size_t nSize)
+{
+    constexpr size_t BUFFER_SIZE = 65536;
+    GByte *pabyDst = static_cast<GByte *>(pDst);
+    while (nSize > 0)
+    {
+        if (nBufferPos == abyBuffer.size())
+        {
+            const size_t nToRead = static_cast<size_t>(
+                std::min<vsi_l_offset>(BUFFER_SIZE, nEndOffset - nOffset));
+            if (nToRead == 0)
+                return false;
+            abyBuffer.resize(nToRead);
+            if (VSIFSeekL(fp, nOffset, SEEK_SET) != 0 ||
+                VSIFReadL(abyBuffer.data(), 1, nToRead, fp) != nToRead)
+                return false;
+            nOffset += nToRead;
+            nBufferPos = 0;
+        }
+        const size_t nToCopy = std::min(nSize, abyBuffer.size() - nBufferPos);
+        memcpy(pabyDst, abyBuffer.data() + nBufferPos, nToCopy);
+        nBufferPos += nToCopy;
+        pabyDst += nToCopy;
+        nSize -= nToCopy;
+    }
+    return true;
+}
+
+// The strings of asFields must have been freed by the caller
+bool OGRGenSQLSortRunReader::ReadRecord(const std::vector<bool> &abStringKey)
+{
+    memset(asFields.data(), 0, sizeof(OGRField) * asFields.size());
+    for (size_t iKey = 0; iKey < asFields.size(); iKey++)
+    {
+        OGRField *psField = &asFields[iKey];
+        if (abStringKey[iKey])
+        {
+            GByte bIsString = 0;
+            if (!Read(&bIsString, 1))
+                return false;
+            if (bIsString)
+            {
+                uint32_t nLen = 0;
+                if (!Read(&nLen, sizeof(nLen)))
+                    return false;
+                char *pszStr = static_cast<char *>(
+                    VSI_MALLOC_VERBOSE(static_cast<size_t>(nLen) + 1));
+                if (pszStr == nullptr)
+                    return false;
+                psField->String = pszStr;
+                pszStr[nLen] = '\0';
+                if (!Read(pszStr, nLen))
+                    return false;
+                continue;
+            }
+        }
+        if (!Read(psField, sizeof(OGRField)))
+            return false;
+    }
+    nRemainingRecords--;
+    return Read(&nFID, sizeof(nFID)) && Read(&nSeq, sizeof(nSeq));
+}
+}  // namespace
+
+/************************************************************************/
+/*                           MergeSortRuns()                            */
+/*                                                                      */
+/*      Merge the sorted runs of fpRuns, and write the resulting FIDs   */
+/*      in a temporary file.                                            */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::MergeSortRuns(
+    VSILFILE *fpRuns,
+    const std::vector<std::pair<vsi_l_offset, size_t>> &aoRuns)
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+    const int nOrderItems = psSelectInfo->order_specs;
+    std::vector<bool> abStringKey;
+    for (int iKey = 0; iKey < nOrderItems; iKey++)
+        abStringKey.push_back(IsStringOrderKey(iKey));
+
+    VSIFSeekL(fpRuns, 0, SEEK_END);
+    const vsi_l_offset nFileSize = VSIFTellL(fpRuns);
+
+    std::vector<OGRGenSQLSortRunReader> aoReaders(aoRuns.size());
+    for (size_t i = 0; i < aoRuns.size(); i++)
+    {
+        auto &oReader = aoReaders[i];
+        oReader.fp = fpRuns;
+        oReader.nOffset = aoRuns[i].first;
+        oReader.nEndOffset =
+            i + 1 < aoRuns.size() ? aoRuns[i + 1].first : nFileSize;
+        oReader.nRemainingRecords = aoRuns[i].second;
+        oReader.asFields.resize(nOrderItems);
+    }
+
+    const auto Greater = [this, &aoReaders](size_t a, size_t b)
+    {
+        const int nRes = Compare(aoReaders[a].asFields.data(),
+                                 aoReaders[b].asFields.data());
+        return nRes > 0 || (nRes == 0 && aoReaders[a].nSeq > aoReaders[b].nSeq);
+    };
+    std::vector<size_t> anHeap;
+
+    bool bOK = true;
+    for (size_t i = 0; bOK && i < aoReaders.size(); i++)
+    {
+        if (aoReaders[i].nRemainingRecords > 0)
+        {
+            bOK = aoReaders[i].ReadRecord(abStringKey);
+            anHeap.push_back(i);
+            std::push_heap(anHeap.begin(), anHeap.end(), Greater);
+        }
+    }
+
+    m_osSortedFIDsFilename = CPLGenerateTempFilename("ogr_sql_sorted_fids");
+    m_fpSortedFIDs = VSIFOpenL(m_osSortedFIDsFilename.c_str(), "wb+");
+    if (m_fpSortedFIDs == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 m_osSortedFIDsFilename.c_str());
+        bOK = false;
+    }
+
+    std::vector<GIntBig> anFIDs;
+    nIndexSize = 0;
+    bool bAlreadySorted = true;
+    while (bOK && !anHeap.empty())
+    {
+        std::pop_heap(anHeap.begin(), anHeap.end(), Greater);
+        auto &oReader = aoReaders[anHeap.back()];
+        if (oReader.nSeq != static_cast<GIntBig>(nIndexSize))
+            bAlreadySorted = false;
+        anFIDs.push_back(oReader.nFID);
+        nIndexSize++;
+
+        FreeIndexFields(oReader.asFields.data(), 1, false);
+        if (oReader.nRemainingRecords > 0)
+        {
+            bOK = oReader.ReadRecord(abStringKey);
+            std::push_heap(anHeap.begin(), anHeap.end(), Greater);
+        }
+        else
+        {
+            memset(oReader.asFields.data(), 0, sizeof(OGRField) * nOrderItems);
+            anHeap.pop_back();
+        }
+
+        if (anFIDs.size() == 65536 || anHeap.empty())
+        {
+            bOK = bOK && VSIFWriteL(anFIDs.data(), sizeof(GIntBig),
+                                    anFIDs.size(),
+                                    m_fpSortedFIDs) == anFIDs.size();
+            anFIDs.clear();
+        }
+    }
+
+    for (auto &oReader : aoReaders)
+        FreeIndexFields(oReader.asFields.data(), 1, false);
+
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Error while merging ORDER BY temporary file");
+        return false;
+    }
+
+    // See comment at the end of CreateOrderByIndex()
+    if (bAlreadySorted)
+    {
+        VSIFCloseL(m_fpSortedFIDs);
+        VSIUnlink(m_osSortedFIDsFilename.c_str());
+        m_fpSortedFIDs = nullptr;
+        nIndexSize = 0;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         GetOrderByIndexFID()                         */
+/************************************************************************/
+
+GIntBig OGRGenSQLResultsLayer::GetOrderByIndexFID(GIntBig nIndex)
+{
+    if (panFIDIndex != nullptr)
+        return panFIDIndex[nIndex];
+
+    GIntBig nFID = OGRNullFID;
+    if (VSIFSeekL(m_fpSortedFIDs,
+                  static_cast<vsi_l_offset>(nIndex) * sizeof(GIntBig),
+                  SEEK_SET) != 0 ||
+        VSIFReadL(&nFID, sizeof(GIntBig), 1, m_fpSortedFIDs) != 1)
+    {
+        return OGRNullFID;
+    }
+    return nFID;
+}
+
 /************************************************************************/
 /*                          SortIndexSection()                          */
 /*                                                                      */
@@ -2428,6 +3317,13 @@ void OGRGenSQLResultsLayer::InvalidateOrderByIndex()
     CPLFree(panFIDIndex);
     panFIDIndex = nullptr;
 
+    if (m_fpSortedFIDs)
+    {
+        VSIFCloseL(m_fpSortedFIDs);
+        VSIUnlink(m_osSortedFIDsFilename.c_str());
+        m_fpSortedFIDs = nullptr;
+    }
+
     nIndexSize = 0;
     bOrderByValid = FALSE;
 }
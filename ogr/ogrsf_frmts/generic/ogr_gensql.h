@@ -36,6 +36,9 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -75,6 +78,10 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig *panFIDIndex;
     int bOrderByValid;
 
+    // Sorted FIDs, when the ORDER BY index did not fit in memory
+    VSILFILE *m_fpSortedFIDs = nullptr;
+    std::string m_osSortedFIDsFilename{};
+
     GIntBig nNextIndexFID;
     OGRFeature *poSummaryFeature;
 
@@ -86,12 +93,40 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig nIteratedFeatures;
     std::vector<CPLString> m_oDistinctList;
 
+    // Hash tables over the join key of secondary layers. One (possibly
+    // null) entry per join, built once a number of primary features have
+    // been joined with attribute filters evaluated by OGR.
+    struct HashJoin;
+    std::vector<std::unique_ptr<HashJoin>> m_apoHashJoins{};
+    // Per join, number of primary features joined with an attribute
+    // filter, or -1 if no hash table must be built.
+    std::vector<int> m_anHashJoinFilteredFeatures{};
+    int m_nHashJoinMinFeatures = 0;
+    bool m_bHashJoinsPrepared = false;
+
     int PrepareSummary();
 
+    void PrepareHashJoins();
+    std::unique_ptr<HashJoin> BuildHashJoin(swq_join_def *psJoinInfo);
+
     OGRFeature *TranslateFeature(OGRFeature *);
     void CreateOrderByIndex();
+    bool CreateOrderByIndexTopK(size_t nK);
+    bool HasOrderByIndex() const
+    {
+        return panFIDIndex != nullptr || m_fpSortedFIDs != nullptr;
+    }
+    GIntBig GetOrderByIndexFID(GIntBig nIndex);
     void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
                          OGRField *pasIndexFields);
+    bool IsStringOrderKey(int iKey);
+    size_t GetIndexFieldsMemory(const OGRField *pasIndexFields);
+    bool WriteSortRun(VSILFILE *fp, const OGRField *pasIndexFields,
+                      const GIntBig *panFIDList, GIntBig nFirstSeq,
+                      size_t nEntries);
+    bool MergeSortRuns(VSILFILE *fpRuns,
+                       const std::vector<std::pair<vsi_l_offset, size_t>>
+                           &aoRuns);
     void SortIndexSection(const OGRField *pasIndexFields, GIntBig *panMerged,
                           size_t nStart, size_t nEntries);
     void FreeIndexFields(OGRField *pasIndexFields, size_t l_nIndexSize,
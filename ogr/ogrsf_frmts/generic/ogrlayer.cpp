@@ -35,11 +35,18 @@
 #include "ograpispy.h"
 #include "ogr_recordbatch.h"
 #include "ograrrowarrayhelper.h"
+#include "gdal_thread_pool.h"
 
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <limits>
+#include <memory>
 #include <set>
+#include <utility>
+#include <vector>
 
 struct OGRLayer::Private
 {
@@ -2205,6 +2212,591 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
         return poGeom;
 }
 
+/************************************************************************/
+/*                          OGROverlaySTRTree                           */
+/************************************************************************/
+
+/** Static R-tree over feature envelopes, bulk loaded with the
+ * Sort-Tile-Recursive algorithm, used by the multi-threaded implementation
+ * of the layer overlay methods. */
+class OGROverlaySTRTree
+{
+    static constexpr size_t NODE_CAPACITY = 16;
+
+    struct Node
+    {
+        OGREnvelope sEnv{};
+        // Index of the first child in the level below, or of the first item
+        // in m_anItems for leaves
+        size_t nFirst = 0;
+        size_t nCount = 0;
+    };
+
+    std::vector<OGREnvelope> m_asItemEnv{};
+    std::vector<size_t> m_anItems{};
+    // m_aaoLevels[0] are the leaves, m_aaoLevels.back() contains the root
+    std::vector<std::vector<Node>> m_aaoLevels{};
+
+    static std::vector<size_t> STRSort(const std::vector<OGREnvelope> &asEnv);
+
+  public:
+    explicit OGROverlaySTRTree(std::vector<OGREnvelope> &&asItemEnv);
+
+    void Search(const OGREnvelope &sEnv, std::vector<size_t> &anItems) const;
+};
+
+constexpr size_t OGROverlaySTRTree::NODE_CAPACITY;
+
+/************************************************************************/
+/*                              STRSort()                               */
+/************************************************************************/
+
+/** Returns the order in which the envelopes must be packed in nodes: sorted
+ * by X center into vertical slices, and each slice sorted by Y center. */
+std::vector<size_t>
+OGROverlaySTRTree::STRSort(const std::vector<OGREnvelope> &asEnv)
+{
+    const size_t nCount = asEnv.size();
+    std::vector<size_t> anOrder(nCount);
+    for (size_t i = 0; i < nCount; ++i)
+        anOrder[i] = i;
+
+    std::sort(anOrder.begin(), anOrder.end(),
+              [&asEnv](size_t a, size_t b)
+              {
+                  return asEnv[a].MinX + asEnv[a].MaxX <
+                         asEnv[b].MinX + asEnv[b].MaxX;
+              });
+
+    const size_t nNodes = (nCount + NODE_CAPACITY - 1) / NODE_CAPACITY;
+    const size_t nSlices = static_cast<size_t>(
+        std::ceil(std::sqrt(static_cast<double>(nNodes))));
+    const size_t nSliceSize = nSlices * NODE_CAPACITY;
+    for (size_t i = 0; i < nCount; i += nSliceSize)
+    {
+        std::sort(anOrder.begin() + i,
+                  anOrder.begin() + std::min(nCount, i + nSliceSize),
+                  [&asEnv](size_t a, size_t b)
+                  {
+                      return asEnv[a].MinY + asEnv[a].MaxY <
+                             asEnv[b].MinY + asEnv[b].MaxY;
+                  });
+    }
+    return anOrder;
+}
+
+/************************************************************************/
+/*                          OGROverlaySTRTree()                         */
+/************************************************************************/
+
+OGROverlaySTRTree::OGROverlaySTRTree(std::vector<OGREnvelope> &&asItemEnv)
+    : m_asItemEnv(std::move(asItemEnv))
+{
+    m_anItems = STRSort(m_asItemEnv);
+
+    std::vector<Node> aoNodes;
+    for (size_t i = 0; i < m_anItems.size(); i += NODE_CAPACITY)
+    {
+        Node oNode;
+        oNode.nFirst = i;
+        oNode.nCount = std::min(NODE_CAPACITY, m_anItems.size() - i);
+        for (size_t j = i; j < i + oNode.nCount; ++j)
+            oNode.sEnv.Merge(m_asItemEnv[m_anItems[j]]);
+        aoNodes.push_back(oNode);
+    }
+
+    while (aoNodes.size() > 1)
+    {
+        std::vector<OGREnvelope> asNodeEnv;
+        asNodeEnv.reserve(aoNodes.size());
+        for (const auto &oNode : aoNodes)
+            asNodeEnv.push_back(oNode.sEnv);
+
+        std::vector<Node> aoSortedNodes;
+        aoSortedNodes.reserve(aoNodes.size());
+        for (const size_t i : STRSort(asNodeEnv))
+            aoSortedNodes.push_back(aoNodes[i]);
+
+        std::vector<Node> aoParents;
+        for (size_t i = 0; i < aoSortedNodes.size(); i += NODE_CAPACITY)
+        {
+            Node oParent;
+            oParent.nFirst = i;
+            oParent.nCount = std::min(NODE_CAPACITY, aoSortedNodes.size() - i);
+            for (size_t j = i; j < i + oParent.nCount; ++j)
+                oParent.sEnv.Merge(aoSortedNodes[j].sEnv);
+            aoParents.push_back(oParent);
+        }
+
+        m_aaoLevels.push_back(std::move(aoSortedNodes));
+        aoNodes = std::move(aoParents);
+    }
+    if (!aoNodes.empty())
+        m_aaoLevels.push_back(std::move(aoNodes));
+}
+
+/************************************************************************/
+/*                               Search()                               */
+/************************************************************************/
+
+/** Returns in anItems the indices, in increasing order, of the items whose
+ * envelope intersects sEnv. */
+void OGROverlaySTRTree::Search(const OGREnvelope &sEnv,
+                               std::vector<size_t> &anItems) const
+{
+    anItems.clear();
+    if (m_aaoLevels.empty())
+        return;
+
+    // Stack of (level, node index) pairs
+    std::vector<std::pair<size_t, size_t>> aoStack;
+    aoStack.emplace_back(m_aaoLevels.size() - 1, 0);
+    while (!aoStack.empty())
+    {
+        const size_t iLevel = aoStack.back().first;
+        const Node &oNode = m_aaoLevels[iLevel][aoStack.back().second];
+        aoStack.pop_back();
+        if (!oNode.sEnv.Intersects(sEnv))
+            continue;
+        for (size_t i = oNode.nFirst; i < oNode.nFirst + oNode.nCount; ++i)
+        {
+            if (iLevel > 0)
+                aoStack.emplace_back(iLevel - 1, i);
+            else if (m_asItemEnv[m_anItems[i]].Intersects(sEnv))
+                anItems.push_back(m_anItems[i]);
+        }
+    }
+    std::sort(anItems.begin(), anItems.end());
+}
+
+/************************************************************************/
+/*                  multi-threaded layer overlay methods                */
+/************************************************************************/
+
+// How a feature of the scanned layer is combined with the features of the
+// indexed layer that it intersects
+enum class OGROverlayKernel
+{
+    INTERSECTION,  // one result for each intersecting feature
+    IDENTITY,      // INTERSECTION, plus the part not covered by any feature
+    DIFFERENCE,    // the part not covered by any feature
+    CLIP,          // the part covered by the union of the features
+};
+
+struct OGROverlayParams
+{
+    OGROverlayKernel eKernel = OGROverlayKernel::INTERSECTION;
+    OGRFeatureDefn *poDefnResult = nullptr;
+    const int *mapScanned = nullptr;
+    const int *mapIndexed = nullptr;
+    const OGRGeometry *pGeometryIndexedFilter = nullptr;
+    bool bSkipFailures = false;
+    bool bPromoteToMulti = false;
+    bool bUsePreparedGeometries = true;
+    bool bPretestContainment = false;
+    bool bKeepLowerDimGeom = true;
+    std::vector<OGRFeatureUniquePtr> apoIndexed{};
+    std::unique_ptr<OGROverlaySTRTree> poTree{};
+};
+
+struct OGROverlayFeature
+{
+    OGRFeatureUniquePtr poFeature{};
+    std::vector<OGRFeatureUniquePtr> apoResults{};
+    bool bFailed = false;
+};
+
+struct OGROverlayJob
+{
+    const OGROverlayParams *psParams = nullptr;
+    std::vector<OGROverlayFeature> *paoBatch = nullptr;
+    size_t nStart = 0;
+    size_t nEnd = 0;
+};
+
+/** Returns the number of threads set with the NUM_THREADS option, or 0 if
+ * the sequential implementation must be used. */
+static int get_overlay_num_threads(CSLConstList papszOptions)
+{
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads == nullptr)
+        return 0;
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    return std::max(1, std::min(128, nThreads));
+}
+
+static void add_overlay_result(const OGROverlayParams &sParams,
+                               OGROverlayFeature &oFeature, OGRFeature *y,
+                               OGRGeometryUniquePtr &&poGeom)
+{
+    OGRFeatureUniquePtr z(new OGRFeature(sParams.poDefnResult));
+    z->SetFieldsFrom(oFeature.poFeature.get(), sParams.mapScanned);
+    if (y)
+        z->SetFieldsFrom(y, sParams.mapIndexed);
+    if (sParams.bPromoteToMulti)
+        poGeom.reset(promote_to_multi(poGeom.release()));
+    z->SetGeometryDirectly(poGeom.release());
+    oFeature.apoResults.push_back(std::move(z));
+}
+
+/** Computes the result features of a feature of the scanned layer, with
+ * the same semantics as the sequential implementation. Returns false on a
+ * failure that must interrupt the processing. */
+static bool process_overlay_feature(const OGROverlayParams &sParams,
+                                    OGROverlayFeature &oFeature)
+{
+    OGRGeometry *x_geom = oFeature.poFeature->GetGeometryRef();
+    if (!x_geom)
+        return true;
+
+    const auto Failed = [&sParams]()
+    {
+        if (!sParams.bSkipFailures)
+            return true;
+        CPLErrorReset();
+        return false;
+    };
+
+    // The indexed features must intersect the same geometry as the spatial
+    // filter set by set_filter_from()
+    OGRGeometry *poFilterGeom = x_geom;
+    OGRGeometryUniquePtr poFilterGeomOwner;
+    if (sParams.pGeometryIndexedFilter)
+    {
+        CPLErrorReset();
+        if (x_geom->Intersects(sParams.pGeometryIndexedFilter))
+            poFilterGeomOwner.reset(
+                x_geom->Intersection(sParams.pGeometryIndexedFilter));
+        if (CPLGetLastErrorType() != CE_None && Failed())
+            return false;
+        if (!poFilterGeomOwner)
+            return true;
+        poFilterGeom = poFilterGeomOwner.get();
+    }
+
+    OGREnvelope sEnv;
+    poFilterGeom->getEnvelope(&sEnv);
+    std::vector<size_t> anCandidates;
+    sParams.poTree->Search(sEnv, anCandidates);
+
+    OGRPreparedGeometryUniquePtr poPreparedFilterGeom;
+    if (sParams.bUsePreparedGeometries && !anCandidates.empty())
+    {
+        poPreparedFilterGeom.reset(
+            OGRCreatePreparedGeometry(OGRGeometry::ToHandle(poFilterGeom)));
+    }
+
+    const OGROverlayKernel eKernel = sParams.eKernel;
+    OGRGeometryUniquePtr poRemaining;
+    if (eKernel == OGROverlayKernel::IDENTITY ||
+        eKernel == OGROverlayKernel::DIFFERENCE)
+    {
+        poRemaining.reset(x_geom->clone());
+    }
+    OGRGeometryUniquePtr poCovered;
+
+    for (const size_t iIndexed : anCandidates)
+    {
+        OGRFeature *y = sParams.apoIndexed[iIndexed].get();
+        OGRGeometry *y_geom = y->GetGeometryRef();
+
+        CPLErrorReset();
+        const bool bIntersects =
+            poPreparedFilterGeom
+                ? CPL_TO_BOOL(OGRPreparedGeometryIntersects(
+                      poPreparedFilterGeom.get(),
+                      OGRGeometry::ToHandle(y_geom)))
+                : CPL_TO_BOOL(poFilterGeom->Intersects(y_geom));
+        if (CPLGetLastErrorType() != CE_None)
+        {
+            if (Failed())
+                return false;
+            continue;
+        }
+        if (!bIntersects)
+            continue;
+
+        if (eKernel == OGROverlayKernel::INTERSECTION ||
+            eKernel == OGROverlayKernel::IDENTITY)
+        {
+            OGRGeometryUniquePtr z_geom;
+            if (eKernel == OGROverlayKernel::INTERSECTION &&
+                sParams.bPretestContainment && poPreparedFilterGeom &&
+                poFilterGeom == x_geom)
+            {
+                CPLErrorReset();
+                if (OGRPreparedGeometryContains(poPreparedFilterGeom.get(),
+                                                OGRGeometry::ToHandle(y_geom)))
+                {
+                    z_geom.reset(y_geom->clone());
+                }
+                if (CPLGetLastErrorType() != CE_None)
+                {
+                    if (Failed())
+                        return false;
+                    continue;
+                }
+            }
+            if (!z_geom)
+            {
+                CPLErrorReset();
+                z_geom.reset(x_geom->Intersection(y_geom));
+                if (CPLGetLastErrorType() != CE_None || z_geom == nullptr)
+                {
+                    if (Failed())
+                        return false;
+                    continue;
+                }
+                if (z_geom->IsEmpty() ||
+                    (!sParams.bKeepLowerDimGeom &&
+                     (x_geom->getDimension() == y_geom->getDimension() &&
+                      z_geom->getDimension() < x_geom->getDimension())))
+                {
+                    continue;
+                }
+            }
+            add_overlay_result(sParams, oFeature, y, std::move(z_geom));
+        }
+
+        if (poRemaining)
+        {
+            CPLErrorReset();
+            OGRGeometryUniquePtr poRemainingNew(
+                poRemaining->Difference(y_geom));
+            if (CPLGetLastErrorType() != CE_None || poRemainingNew == nullptr)
+            {
+                if (Failed())
+                    return false;
+            }
+            else
+            {
+                poRemaining.swap(poRemainingNew);
+                if (eKernel == OGROverlayKernel::DIFFERENCE &&
+                    poRemaining->IsEmpty())
+                {
+                    break;
+                }
+            }
+        }
+        else if (eKernel == OGROverlayKernel::CLIP)
+        {
+            if (!poCovered)
+            {
+                poCovered.reset(y_geom->clone());
+                continue;
+            }
+            CPLErrorReset();
+            OGRGeometryUniquePtr poCoveredNew(poCovered->Union(y_geom));
+            if (CPLGetLastErrorType() != CE_None || poCoveredNew == nullptr)
+            {
+                if (Failed())
+                    return false;
+            }
+            else
+            {
+                poCovered.swap(poCoveredNew);
+            }
+        }
+    }
+
+    if (poCovered)
+    {
+        CPLErrorReset();
+        OGRGeometryUniquePtr poIntersection(
+            x_geom->Intersection(poCovered.get()));
+        if (CPLGetLastErrorType() != CE_None || poIntersection == nullptr)
+        {
+            if (Failed())
+                return false;
+        }
+        else if (!poIntersection->IsEmpty())
+        {
+            add_overlay_result(sParams, oFeature, nullptr,
+                               std::move(poIntersection));
+        }
+    }
+    else if (poRemaining && !poRemaining->IsEmpty())
+    {
+        add_overlay_result(sParams, oFeature, nullptr, std::move(poRemaining));
+    }
+    return true;
+}
+
+static void process_overlay_job(void *pData)
+{
+    auto psJob = static_cast<OGROverlayJob *>(pData);
+    for (size_t i = psJob->nStart; i < psJob->nEnd; ++i)
+    {
+        auto &oFeature = (*psJob->paoBatch)[i];
+        oFeature.bFailed = !process_overlay_feature(*psJob->psParams, oFeature);
+        if (oFeature.bFailed)
+            break;
+    }
+}
+
+/** Multi-threaded implementation of a pass of the layer overlay methods.
+ *
+ * The features of pLayerIndexed, which must be filtered by
+ * pGeometryIndexedFilter, are loaded in memory and indexed in a R-tree.
+ * The features of pLayerScanned are then read by batches, whose features
+ * are processed by the threads of the global thread pool, and the results
+ * are written to pLayerResult in the order of pLayerScanned. bLastPass must
+ * be set for the last pass of the method, to report its completion.
+ */
+static OGRErr overlay_parallel(OGROverlayKernel eKernel,
+                               OGRLayer *pLayerScanned,
+                               OGRLayer *pLayerIndexed,
+                               const OGRGeometry *pGeometryIndexedFilter,
+                               OGRLayer *pLayerResult, const int *mapScanned,
+                               const int *mapIndexed, bool bKeepLowerDimGeom,
+                               CSLConstList papszOptions,
+                               GDALProgressFunc pfnProgress, void *pProgressArg,
+                               double &progress_counter, double progress_max,
+                               bool bLastPass)
+{
+    OGROverlayParams sParams;
+    sParams.eKernel = eKernel;
+    sParams.poDefnResult = pLayerResult->GetLayerDefn();
+    sParams.mapScanned = mapScanned;
+    sParams.mapIndexed = mapIndexed;
+    sParams.pGeometryIndexedFilter = pGeometryIndexedFilter;
+    sParams.bSkipFailures =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
+    sParams.bPromoteToMulti = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
+    sParams.bUsePreparedGeometries =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions,
+                                         "USE_PREPARED_GEOMETRIES", "YES")) &&
+        OGRHasPreparedGeometrySupport();
+    sParams.bPretestContainment = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "PRETEST_CONTAINMENT", "NO"));
+    sParams.bKeepLowerDimGeom = bKeepLowerDimGeom;
+
+    // Load and index the features of the indexed layer
+    std::vector<OGREnvelope> asEnv;
+    pLayerIndexed->ResetReading();
+    OGRFeature *poFeature;
+    while ((poFeature = pLayerIndexed->GetNextFeature()) != nullptr)
+    {
+        OGRFeatureUniquePtr y(poFeature);
+        const OGRGeometry *y_geom = y->GetGeometryRef();
+        if (!y_geom || y_geom->IsEmpty())
+            continue;
+        OGREnvelope sEnv;
+        y_geom->getEnvelope(&sEnv);
+        asEnv.push_back(sEnv);
+        sParams.apoIndexed.push_back(std::move(y));
+    }
+    sParams.poTree.reset(new OGROverlaySTRTree(std::move(asEnv)));
+
+    const int nThreads = get_overlay_num_threads(papszOptions);
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+
+    // Several jobs per thread, to balance the load between threads when
+    // the cost of the features is uneven
+    const int nJobs = poJobQueue ? 4 * nThreads : 1;
+    const size_t nBatchSize = static_cast<size_t>(64) * nJobs;
+    std::vector<OGROverlayJob> asJobs(nJobs);
+    const auto ReadBatch =
+        [pLayerScanned, nBatchSize](std::vector<OGROverlayFeature> &aoBatch)
+    {
+        aoBatch.clear();
+        OGRFeature *x;
+        while (aoBatch.size() < nBatchSize &&
+               (x = pLayerScanned->GetNextFeature()) != nullptr)
+        {
+            aoBatch.emplace_back();
+            aoBatch.back().poFeature.reset(x);
+        }
+    };
+    const auto SubmitBatch = [&](std::vector<OGROverlayFeature> &aoBatch)
+    {
+        const size_t nChunkSize = (aoBatch.size() + nJobs - 1) / nJobs;
+        for (int i = 0; i < nJobs; ++i)
+        {
+            OGROverlayJob &sJob = asJobs[i];
+            sJob.psParams = &sParams;
+            sJob.paoBatch = &aoBatch;
+            sJob.nStart = std::min(aoBatch.size(), i * nChunkSize);
+            sJob.nEnd = std::min(aoBatch.size(), sJob.nStart + nChunkSize);
+            if (sJob.nStart == sJob.nEnd)
+                continue;
+            if (poJobQueue)
+                poJobQueue->SubmitJob(process_overlay_job, &sJob);
+            else
+                process_overlay_job(&sJob);
+        }
+    };
+
+    // The next batch is read and processed while the results of the current
+    // one are written
+    OGRErr ret = OGRERR_NONE;
+    std::vector<OGROverlayFeature> aoBatches[2];
+    int iCurBatch = 0;
+    pLayerScanned->ResetReading();
+    ReadBatch(aoBatches[iCurBatch]);
+    SubmitBatch(aoBatches[iCurBatch]);
+    while (!aoBatches[iCurBatch].empty())
+    {
+        auto &aoNextBatch = aoBatches[1 - iCurBatch];
+        ReadBatch(aoNextBatch);
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+        SubmitBatch(aoNextBatch);
+
+        for (auto &oFeature : aoBatches[iCurBatch])
+        {
+            if (pfnProgress)
+            {
+                double p = progress_counter / progress_max;
+                if (p > 0 && !pfnProgress(p, "", pProgressArg))
+                {
+                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                    ret = OGRERR_FAILURE;
+                    break;
+                }
+                progress_counter += 1.0;
+            }
+            if (oFeature.bFailed)
+            {
+                ret = OGRERR_FAILURE;
+                break;
+            }
+            for (auto &z : oFeature.apoResults)
+            {
+                ret = pLayerResult->CreateFeature(z.get());
+                if (ret != OGRERR_NONE)
+                {
+                    if (!sParams.bSkipFailures)
+                        break;
+                    CPLErrorReset();
+                    ret = OGRERR_NONE;
+                }
+            }
+            if (ret != OGRERR_NONE)
+                break;
+        }
+        aoBatches[iCurBatch].clear();
+        if (ret != OGRERR_NONE)
+            break;
+        iCurBatch = 1 - iCurBatch;
+    }
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+
+    if (ret == OGRERR_NONE && bLastPass && pfnProgress &&
+        !pfnProgress(1.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        ret = OGRERR_FAILURE;
+    }
+    return ret;
+}
+
 /************************************************************************/
 /*                          Intersection()                              */
 /************************************************************************/
@@ -2250,6 +2842,11 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method layer in memory, index them with a R-tree,
+ *     and process the features of the input layer with the specified
+ *     number of threads. The features of the result layer are the same,
+ *     and in the same order, as without this option.
  * </ul>
  *
  * This method is the same as the C function OGR_L_Intersection().
@@ -2337,6 +2934,17 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         }
     }
 
+    if (get_overlay_num_threads(papszOptions) > 0)
+    {
+        ret = overlay_parallel(OGROverlayKernel::INTERSECTION, this,
+                               pLayerMethod, pGeometryMethodFilter,
+                               pLayerResult, mapInput, mapMethod,
+                               CPL_TO_BOOL(bKeepLowerDimGeom), papszOptions,
+                               pfnProgress, pProgressArg, progress_counter,
+                               progress_max, true);
+        goto done;
+    }
+
     for (auto &&x : this)
     {
 
@@ -2563,6 +3171,11 @@ done:
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method layer in memory, index them with a R-tree,
+ *     and process the features of the input layer with the specified
+ *     number of threads. The features of the result layer are the same,
+ *     and in the same order, as without this option.
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Intersection().
@@ -2651,6 +3264,11 @@ OGRErr OGR_L_Intersection(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method and input layers in memory, index them
+ *     with a R-tree, and process the features with the specified number
+ *     of threads. The features of the result layer are the same, and in
+ *     the same order, as without this option.
  * </ul>
  *
  * This method is the same as the C function OGR_L_Union().
@@ -2739,6 +3357,22 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         }
     }
 
+    if (get_overlay_num_threads(papszOptions) > 0)
+    {
+        ret = overlay_parallel(OGROverlayKernel::IDENTITY, this, pLayerMethod,
+                               pGeometryMethodFilter, pLayerResult, mapInput,
+                               mapMethod, CPL_TO_BOOL(bKeepLowerDimGeom),
+                               papszOptions, pfnProgress, pProgressArg,
+                               progress_counter, progress_max, false);
+        if (ret == OGRERR_NONE)
+            ret = overlay_parallel(OGROverlayKernel::DIFFERENCE, pLayerMethod,
+                                   this, pGeometryInputFilter, pLayerResult,
+                                   mapMethod, nullptr, true, papszOptions,
+                                   pfnProgress, pProgressArg, progress_counter,
+                                   progress_max, true);
+        goto done;
+    }
+
     // add features based on input layer
     for (auto &&x : this)
     {
@@ -3097,6 +3731,11 @@ done:
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method and input layers in memory, index them
+ *     with a R-tree, and process the features with the specified number
+ *     of threads. The features of the result layer are the same, and in
+ *     the same order, as without this option.
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Union().
@@ -3176,6 +3815,11 @@ OGRErr OGR_L_Union(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method and input layers in memory, index them
+ *     with a R-tree, and process the features with the specified number
+ *     of threads. The features of the result layer are the same, and in
+ *     the same order, as without this option.
  * </ul>
  *
  * This method is the same as the C function OGR_L_SymDifference().
@@ -3248,6 +3892,22 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (get_overlay_num_threads(papszOptions) > 0)
+    {
+        ret = overlay_parallel(OGROverlayKernel::DIFFERENCE, this, pLayerMethod,
+                               pGeometryMethodFilter, pLayerResult, mapInput,
+                               nullptr, true, papszOptions, pfnProgress,
+                               pProgressArg, progress_counter, progress_max,
+                               false);
+        if (ret == OGRERR_NONE)
+            ret = overlay_parallel(OGROverlayKernel::DIFFERENCE, pLayerMethod,
+                                   this, pGeometryInputFilter, pLayerResult,
+                                   mapMethod, nullptr, true, papszOptions,
+                                   pfnProgress, pProgressArg, progress_counter,
+                                   progress_max, true);
+        goto done;
+    }
+
     // add features based on input layer
     for (auto &&x : this)
     {
@@ -3504,6 +4164,11 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method and input layers in memory, index them
+ *     with a R-tree, and process the features with the specified number
+ *     of threads. The features of the result layer are the same, and in
+ *     the same order, as without this option.
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::SymDifference().
@@ -3591,6 +4256,11 @@ OGRErr OGR_L_SymDifference(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method layer in memory, index them with a R-tree,
+ *     and process the features of the input layer with the specified
+ *     number of threads. The features of the result layer are the same,
+ *     and in the same order, as without this option.
  * </ul>
  *
  * This method is the same as the C function OGR_L_Identity().
@@ -3673,6 +4343,16 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (get_overlay_num_threads(papszOptions) > 0)
+    {
+        ret = overlay_parallel(OGROverlayKernel::IDENTITY, this, pLayerMethod,
+                               pGeometryMethodFilter, pLayerResult, mapInput,
+                               mapMethod, CPL_TO_BOOL(bKeepLowerDimGeom),
+                               papszOptions, pfnProgress, pProgressArg,
+                               progress_counter, progress_max, true);
+        goto done;
+    }
+
     // split the features in input layer to the result layer
     for (auto &&x : this)
     {
@@ -3917,6 +4597,11 @@ done:
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method layer in memory, index them with a R-tree,
+ *     and process the features of the input layer with the specified
+ *     number of threads. The features of the result layer are the same,
+ *     and in the same order, as without this option.
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Identity().
@@ -3996,6 +4681,11 @@ OGRErr OGR_L_Identity(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method layer in memory, index them with a R-tree,
+ *     and process the features of the input layer with the specified
+ *     number of threads. The features of the result layer are the same,
+ *     and in the same order, as without this option.
  * </ul>
  *
  * This method is the same as the C function OGR_L_Update().
@@ -4064,6 +4754,18 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (get_overlay_num_threads(papszOptions) > 0)
+    {
+        ret = overlay_parallel(OGROverlayKernel::DIFFERENCE, this, pLayerMethod,
+                               pGeometryMethodFilter, pLayerResult, mapInput,
+                               nullptr, true, papszOptions, pfnProgress,
+                               pProgressArg, progress_counter, progress_max,
+                               false);
+        if (ret != OGRERR_NONE)
+            goto done;
+        goto add_method_features;
+    }
+
     // add clipped features from the input layer
     for (auto &&x : this)
     {
@@ -4165,6 +4867,7 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         }
     }
 
+add_method_features:
     // restore the original filter and add features from the update layer
     pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
     for (auto &&y : pLayerMethod)
@@ -4261,6 +4964,11 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method layer in memory, index them with a R-tree,
+ *     and process the features of the input layer with the specified
+ *     number of threads. The features of the result layer are the same,
+ *     and in the same order, as without this option.
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Update().
@@ -4333,6 +5041,11 @@ OGRErr OGR_L_Update(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method layer in memory, index them with a R-tree,
+ *     and process the features of the input layer with the specified
+ *     number of threads. The features of the result layer are the same,
+ *     and in the same order, as without this option.
  * </ul>
  *
  * This method is the same as the C function OGR_L_Clip().
@@ -4393,6 +5106,17 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
 
     poDefnResult = pLayerResult->GetLayerDefn();
+
+    if (get_overlay_num_threads(papszOptions) > 0)
+    {
+        ret = overlay_parallel(OGROverlayKernel::CLIP, this, pLayerMethod,
+                               pGeometryMethodFilter, pLayerResult, mapInput,
+                               nullptr, true, papszOptions, pfnProgress,
+                               pProgressArg, progress_counter, progress_max,
+                               true);
+        goto done;
+    }
+
     for (auto &&x : this)
     {
 
@@ -4558,6 +5282,11 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method layer in memory, index them with a R-tree,
+ *     and process the features of the input layer with the specified
+ *     number of threads. The features of the result layer are the same,
+ *     and in the same order, as without this option.
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Clip().
@@ -4630,6 +5359,11 @@ OGRErr OGR_L_Clip(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method layer in memory, index them with a R-tree,
+ *     and process the features of the input layer with the specified
+ *     number of threads. The features of the result layer are the same,
+ *     and in the same order, as without this option.
  * </ul>
  *
  * This method is the same as the C function OGR_L_Erase().
@@ -4691,6 +5425,16 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (get_overlay_num_threads(papszOptions) > 0)
+    {
+        ret = overlay_parallel(OGROverlayKernel::DIFFERENCE, this, pLayerMethod,
+                               pGeometryMethodFilter, pLayerResult, mapInput,
+                               nullptr, true, papszOptions, pfnProgress,
+                               pProgressArg, progress_counter, progress_max,
+                               true);
+        goto done;
+    }
+
     for (auto &&x : this)
     {
 
@@ -4834,6 +5578,11 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.7) Set to load the
+ *     features of the method layer in memory, index them with a R-tree,
+ *     and process the features of the input layer with the specified
+ *     number of threads. The features of the result layer are the same,
+ *     and in the same order, as without this option.
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Erase().
@@ -6909,6 +7658,849 @@ bool OGR_L_GetArrowStream(OGRLayerH hLayer, struct ArrowArrayStream *out_stream,
                                                         papszOptions);
 }
 
+/************************************************************************/
+/*                    OGRLayer::WriteArrowBatch()                       */
+/************************************************************************/
+
+namespace
+{
+enum class OGRArrowBatchType
+{
+    BOOL,
+    INT8,
+    UINT8,
+    INT16,
+    UINT16,
+    INT32,
+    UINT32,
+    INT64,
+    UINT64,
+    FLOAT32,
+    FLOAT64,
+    STRING,
+    LARGE_STRING,
+    BINARY,
+    LARGE_BINARY,
+    FIXED_BINARY,
+    DATE32,
+    DATE64,
+    TIME32,
+    TIME64,
+    TIMESTAMP,
+    LIST,
+    LARGE_LIST,
+};
+
+struct OGRArrowBatchColumn
+{
+    const struct ArrowSchema *psSchema = nullptr;
+    const struct ArrowArray *psArray = nullptr;
+    OGRArrowBatchType eType = OGRArrowBatchType::BOOL;
+    OGRArrowBatchType eItemType = OGRArrowBatchType::BOOL;
+    int nFixedWidth = 0;
+    int64_t nUnitsPerSec = 1;
+    int nTZFlag = 0;
+    int nTZOffsetMin = 0;
+    int iField = -1;
+    int iGeomField = -1;
+    bool bIsFID = false;
+};
+}  // namespace
+
+/** Decode an Arrow C data interface format string into the subset of types
+ * handled by the generic WriteArrowBatch() implementation.
+ */
+static bool ParseArrowBatchFormat(const char *pszFormat,
+                                  OGRArrowBatchColumn &oCol,
+                                  OGRArrowBatchType &eType)
+{
+    if (pszFormat[0] != '\0' && pszFormat[1] == '\0')
+    {
+        switch (pszFormat[0])
+        {
+            case 'b':
+                eType = OGRArrowBatchType::BOOL;
+                return true;
+            case 'c':
+                eType = OGRArrowBatchType::INT8;
+                return true;
+            case 'C':
+                eType = OGRArrowBatchType::UINT8;
+                return true;
+            case 's':
+                eType = OGRArrowBatchType::INT16;
+                return true;
+            case 'S':
+                eType = OGRArrowBatchType::UINT16;
+                return true;
+            case 'i':
+                eType = OGRArrowBatchType::INT32;
+                return true;
+            case 'I':
+                eType = OGRArrowBatchType::UINT32;
+                return true;
+            case 'l':
+                eType = OGRArrowBatchType::INT64;
+                return true;
+            case 'L':
+                eType = OGRArrowBatchType::UINT64;
+                return true;
+            case 'f':
+                eType = OGRArrowBatchType::FLOAT32;
+                return true;
+            case 'g':
+                eType = OGRArrowBatchType::FLOAT64;
+                return true;
+            case 'u':
+                eType = OGRArrowBatchType::STRING;
+                return true;
+            case 'U':
+                eType = OGRArrowBatchType::LARGE_STRING;
+                return true;
+            case 'z':
+                eType = OGRArrowBatchType::BINARY;
+                return true;
+            case 'Z':
+                eType = OGRArrowBatchType::LARGE_BINARY;
+                return true;
+            default:
+                return false;
+        }
+    }
+    if (STARTS_WITH(pszFormat, "w:"))
+    {
+        oCol.nFixedWidth = atoi(pszFormat + strlen("w:"));
+        eType = OGRArrowBatchType::FIXED_BINARY;
+        return oCol.nFixedWidth >= 0;
+    }
+    if (strcmp(pszFormat, "tdD") == 0)
+    {
+        eType = OGRArrowBatchType::DATE32;
+        return true;
+    }
+    if (strcmp(pszFormat, "tdm") == 0)
+    {
+        eType = OGRArrowBatchType::DATE64;
+        oCol.nUnitsPerSec = 1000;
+        return true;
+    }
+    if (STARTS_WITH(pszFormat, "tt") && pszFormat[2] != '\0' &&
+        pszFormat[3] == '\0')
+    {
+        switch (pszFormat[2])
+        {
+            case 's':
+                eType = OGRArrowBatchType::TIME32;
+                oCol.nUnitsPerSec = 1;
+                return true;
+            case 'm':
+                eType = OGRArrowBatchType::TIME32;
+                oCol.nUnitsPerSec = 1000;
+                return true;
+            case 'u':
+                eType = OGRArrowBatchType::TIME64;
+                oCol.nUnitsPerSec = 1000 * 1000;
+                return true;
+            case 'n':
+                eType = OGRArrowBatchType::TIME64;
+                oCol.nUnitsPerSec = 1000 * 1000 * 1000;
+                return true;
+            default:
+                return false;
+        }
+    }
+    if (STARTS_WITH(pszFormat, "ts") && pszFormat[2] != '\0' &&
+        pszFormat[3] == ':')
+    {
+        eType = OGRArrowBatchType::TIMESTAMP;
+        switch (pszFormat[2])
+        {
+            case 's':
+                oCol.nUnitsPerSec = 1;
+                break;
+            case 'm':
+                oCol.nUnitsPerSec = 1000;
+                break;
+            case 'u':
+                oCol.nUnitsPerSec = 1000 * 1000;
+                break;
+            case 'n':
+                oCol.nUnitsPerSec = 1000 * 1000 * 1000;
+                break;
+            default:
+                return false;
+        }
+        // Values are always UTC instants when a time zone is set. For a
+        // fixed offset, convert them back to local time so that the offset
+        // can be carried by the OGR TZFlag.
+        const char *pszTZ = pszFormat + 4;
+        if (pszTZ[0] == '\0')
+        {
+            oCol.nTZFlag = 0;
+        }
+        else if ((pszTZ[0] == '+' || pszTZ[0] == '-') && strlen(pszTZ) == 6 &&
+                 pszTZ[3] == ':')
+        {
+            const int nSign = pszTZ[0] == '+' ? 1 : -1;
+            oCol.nTZOffsetMin =
+                nSign * (atoi(pszTZ + 1) * 60 + atoi(pszTZ + 4));
+            oCol.nTZFlag = 100 + oCol.nTZOffsetMin / 15;
+        }
+        else
+        {
+            oCol.nTZFlag = 100;
+        }
+        return true;
+    }
+    if (strcmp(pszFormat, "+l") == 0)
+    {
+        eType = OGRArrowBatchType::LIST;
+        return true;
+    }
+    if (strcmp(pszFormat, "+L") == 0)
+    {
+        eType = OGRArrowBatchType::LARGE_LIST;
+        return true;
+    }
+    return false;
+}
+
+static inline bool IsArrowBatchTypeNumeric(OGRArrowBatchType eType)
+{
+    return eType <= OGRArrowBatchType::FLOAT64;
+}
+
+static inline bool IsArrowBatchTypeBinary(OGRArrowBatchType eType)
+{
+    return eType >= OGRArrowBatchType::STRING &&
+           eType <= OGRArrowBatchType::FIXED_BINARY;
+}
+
+static inline bool IsArrowBatchNull(const struct ArrowArray *psArray,
+                                    int64_t nIdx)
+{
+    if (psArray->null_count == 0 || psArray->buffers[0] == nullptr)
+        return false;
+    const uint8_t *pabyNull =
+        static_cast<const uint8_t *>(psArray->buffers[0]);
+    return (pabyNull[nIdx / 8] & (1 << (nIdx % 8))) == 0;
+}
+
+static int64_t GetArrowBatchInteger(OGRArrowBatchType eType,
+                                    const struct ArrowArray *psArray,
+                                    int64_t nIdx)
+{
+    const void *pData = psArray->buffers[1];
+    switch (eType)
+    {
+        case OGRArrowBatchType::BOOL:
+            return (static_cast<const uint8_t *>(pData)[nIdx / 8] &
+                    (1 << (nIdx % 8))) != 0;
+        case OGRArrowBatchType::INT8:
+            return static_cast<const int8_t *>(pData)[nIdx];
+        case OGRArrowBatchType::UINT8:
+            return static_cast<const uint8_t *>(pData)[nIdx];
+        case OGRArrowBatchType::INT16:
+            return static_cast<const int16_t *>(pData)[nIdx];
+        case OGRArrowBatchType::UINT16:
+            return static_cast<const uint16_t *>(pData)[nIdx];
+        case OGRArrowBatchType::INT32:
+        case OGRArrowBatchType::DATE32:
+        case OGRArrowBatchType::TIME32:
+            return static_cast<const int32_t *>(pData)[nIdx];
+        case OGRArrowBatchType::UINT32:
+            return static_cast<const uint32_t *>(pData)[nIdx];
+        case OGRArrowBatchType::INT64:
+        case OGRArrowBatchType::DATE64:
+        case OGRArrowBatchType::TIME64:
+        case OGRArrowBatchType::TIMESTAMP:
+            return static_cast<const int64_t *>(pData)[nIdx];
+        case OGRArrowBatchType::UINT64:
+            return static_cast<int64_t>(
+                static_cast<const uint64_t *>(pData)[nIdx]);
+        case OGRArrowBatchType::FLOAT32:
+            return static_cast<int64_t>(
+                static_cast<const float *>(pData)[nIdx]);
+        case OGRArrowBatchType::FLOAT64:
+            return static_cast<int64_t>(
+                static_cast<const double *>(pData)[nIdx]);
+        default:
+            break;
+    }
+    return 0;
+}
+
+static double GetArrowBatchReal(OGRArrowBatchType eType,
+                                const struct ArrowArray *psArray, int64_t nIdx)
+{
+    if (eType == OGRArrowBatchType::FLOAT32)
+        return static_cast<const float *>(psArray->buffers[1])[nIdx];
+    if (eType == OGRArrowBatchType::FLOAT64)
+        return static_cast<const double *>(psArray->buffers[1])[nIdx];
+    if (eType == OGRArrowBatchType::UINT64)
+        return static_cast<double>(
+            static_cast<const uint64_t *>(psArray->buffers[1])[nIdx]);
+    return static_cast<double>(GetArrowBatchInteger(eType, psArray, nIdx));
+}
+
+static const GByte *GetArrowBatchBinary(OGRArrowBatchType eType,
+                                        int nFixedWidth,
+                                        const struct ArrowArray *psArray,
+                                        int64_t nIdx, size_t &nLen)
+{
+    if (eType == OGRArrowBatchType::FIXED_BINARY)
+    {
+        nLen = static_cast<size_t>(nFixedWidth);
+        return static_cast<const GByte *>(psArray->buffers[1]) +
+               nIdx * nFixedWidth;
+    }
+    const GByte *pabyData = static_cast<const GByte *>(psArray->buffers[2]);
+    if (eType == OGRArrowBatchType::LARGE_STRING ||
+        eType == OGRArrowBatchType::LARGE_BINARY)
+    {
+        const int64_t *panOffsets =
+            static_cast<const int64_t *>(psArray->buffers[1]);
+        nLen = static_cast<size_t>(panOffsets[nIdx + 1] - panOffsets[nIdx]);
+        return pabyData + panOffsets[nIdx];
+    }
+    const int32_t *panOffsets =
+        static_cast<const int32_t *>(psArray->buffers[1]);
+    nLen = static_cast<size_t>(panOffsets[nIdx + 1] - panOffsets[nIdx]);
+    return pabyData + panOffsets[nIdx];
+}
+
+static void SetArrowBatchDateTime(OGRFeature &oFeature, int iField,
+                                  int64_t nVal,
+                                  const OGRArrowBatchColumn &oCol)
+{
+    int64_t nSec = nVal / oCol.nUnitsPerSec;
+    int64_t nRem = nVal % oCol.nUnitsPerSec;
+    if (nRem < 0)
+    {
+        nRem += oCol.nUnitsPerSec;
+        --nSec;
+    }
+    if (oCol.eType == OGRArrowBatchType::TIME32 ||
+        oCol.eType == OGRArrowBatchType::TIME64)
+    {
+        oFeature.SetField(
+            iField, 0, 0, 0, static_cast<int>(nSec / 3600),
+            static_cast<int>((nSec / 60) % 60),
+            static_cast<float>(static_cast<double>(nSec % 60) +
+                               static_cast<double>(nRem) / oCol.nUnitsPerSec),
+            0);
+        return;
+    }
+    if (oCol.eType == OGRArrowBatchType::DATE32)
+        nSec *= 86400;
+    nSec += static_cast<int64_t>(oCol.nTZOffsetMin) * 60;
+    struct tm brokenDown;
+    CPLUnixTimeToYMDHMS(nSec, &brokenDown);
+    oFeature.SetField(
+        iField, brokenDown.tm_year + 1900, brokenDown.tm_mon + 1,
+        brokenDown.tm_mday, brokenDown.tm_hour, brokenDown.tm_min,
+        static_cast<float>(brokenDown.tm_sec +
+                           static_cast<double>(nRem) / oCol.nUnitsPerSec),
+        oCol.nTZFlag);
+}
+
+/** Set a list field from an Arrow list (or large list) array element. The
+ * scratch vectors are owned by the caller so that their allocations are
+ * reused from one row to the next.
+ */
+static void SetArrowBatchList(OGRFeature &oFeature, int iField,
+                              const OGRArrowBatchColumn &oCol, int64_t nIdx,
+                              std::vector<int> &anTmp,
+                              std::vector<GIntBig> &anTmp64,
+                              std::vector<double> &adfTmp,
+                              CPLStringList &aosTmp)
+{
+    int64_t nStart;
+    int64_t nEnd;
+    if (oCol.eType == OGRArrowBatchType::LARGE_LIST)
+    {
+        const int64_t *panOffsets =
+            static_cast<const int64_t *>(oCol.psArray->buffers[1]);
+        nStart = panOffsets[nIdx];
+        nEnd = panOffsets[nIdx + 1];
+    }
+    else
+    {
+        const int32_t *panOffsets =
+            static_cast<const int32_t *>(oCol.psArray->buffers[1]);
+        nStart = panOffsets[nIdx];
+        nEnd = panOffsets[nIdx + 1];
+    }
+    const struct ArrowArray *psItems = oCol.psArray->children[0];
+    nStart += psItems->offset;
+    nEnd += psItems->offset;
+    const auto eItemType = oCol.eItemType;
+
+    switch (oFeature.GetFieldDefnRef(iField)->GetType())
+    {
+        case OFTIntegerList:
+        {
+            anTmp.clear();
+            for (int64_t i = nStart; i < nEnd; ++i)
+                anTmp.push_back(static_cast<int>(
+                    GetArrowBatchInteger(eItemType, psItems, i)));
+            oFeature.SetField(iField, static_cast<int>(anTmp.size()),
+                              anTmp.data());
+            break;
+        }
+
+        case OFTInteger64List:
+        {
+            anTmp64.clear();
+            for (int64_t i = nStart; i < nEnd; ++i)
+                anTmp64.push_back(static_cast<GIntBig>(
+                    GetArrowBatchInteger(eItemType, psItems, i)));
+            oFeature.SetField(iField, static_cast<int>(anTmp64.size()),
+                              anTmp64.data());
+            break;
+        }
+
+        case OFTRealList:
+        {
+            adfTmp.clear();
+            for (int64_t i = nStart; i < nEnd; ++i)
+                adfTmp.push_back(GetArrowBatchReal(eItemType, psItems, i));
+            oFeature.SetField(iField, static_cast<int>(adfTmp.size()),
+                              adfTmp.data());
+            break;
+        }
+
+        default:
+        {
+            aosTmp.Clear();
+            for (int64_t i = nStart; i < nEnd; ++i)
+            {
+                if (IsArrowBatchTypeBinary(eItemType))
+                {
+                    size_t nLen = 0;
+                    const GByte *pabyData = GetArrowBatchBinary(
+                        eItemType, 0, psItems, i, nLen);
+                    aosTmp.AddString(
+                        std::string(reinterpret_cast<const char *>(pabyData),
+                                    nLen)
+                            .c_str());
+                }
+                else if (eItemType == OGRArrowBatchType::FLOAT32 ||
+                         eItemType == OGRArrowBatchType::FLOAT64)
+                {
+                    aosTmp.AddString(CPLSPrintf(
+                        "%.17g", GetArrowBatchReal(eItemType, psItems, i)));
+                }
+                else
+                {
+                    aosTmp.AddString(CPLSPrintf(
+                        CPL_FRMT_GIB, static_cast<GIntBig>(GetArrowBatchInteger(
+                                          eItemType, psItems, i))));
+                }
+            }
+            oFeature.SetField(iField, aosTmp.List());
+            break;
+        }
+    }
+}
+
+/** Return whether an Arrow schema has the ogc.wkb extension name. */
+static bool IsArrowSchemaOGCWKB(const struct ArrowSchema *psSchema)
+{
+    const char *pszMetadata = psSchema->metadata;
+    if (pszMetadata == nullptr)
+        return false;
+    int32_t nKeys = 0;
+    memcpy(&nKeys, pszMetadata, sizeof(int32_t));
+    pszMetadata += sizeof(int32_t);
+    for (int32_t i = 0; i < nKeys; ++i)
+    {
+        int32_t nKeyLen = 0;
+        memcpy(&nKeyLen, pszMetadata, sizeof(int32_t));
+        pszMetadata += sizeof(int32_t);
+        const std::string osKey(pszMetadata, nKeyLen);
+        pszMetadata += nKeyLen;
+        int32_t nValueLen = 0;
+        memcpy(&nValueLen, pszMetadata, sizeof(int32_t));
+        pszMetadata += sizeof(int32_t);
+        const std::string osValue(pszMetadata, nValueLen);
+        pszMetadata += nValueLen;
+        if (osKey == "ARROW:extension:name" && osValue == "ogc.wkb")
+            return true;
+    }
+    return false;
+}
+
+/** Writes a batch of rows from an ArrowArray.
+ *
+ * This is semantically close to calling CreateFeature() with multiple
+ * features at once.
+ *
+ * The ArrowArray must be of type struct (format=+s), and its children
+ * generally map to a OGR attribute or geometry field (unless they are
+ * identified as the FID column). Mapping is done by name: columns whose name
+ * does not match an existing field are ignored with a warning. Geometry
+ * columns must be binary columns encoded as WKB. A binary column that does not
+ * match a geometry field name, but carries the ARROW:extension:name=ogc.wkb
+ * metadata, is mapped to the first geometry field when the layer has a single
+ * one.
+ *
+ * The ownership of the array is not transferred: the caller remains
+ * responsible for calling its release callback.
+ *
+ * The default implementation creates a single OGRFeature that is re-used for
+ * all rows of the batch, and calls CreateFeature() on it. Drivers may provide
+ * a faster implementation, in which case they advertise the
+ * OLCFastWriteArrowBatch capability. Drivers are also free to fall back to
+ * the default implementation when the schema of the batch does not allow
+ * their fast path.
+ *
+ * Options may be driver specific. The default implementation recognizes the
+ * following options:
+ * <ul>
+ * <li>FID=name. Name of the FID column in the array. If not provided,
+ *     GetFIDColumn() is used. If the layer has no FID column name, a column
+ *     named OGC_FID is used, consistently with GetArrowStream(). FID values
+ *     are passed to CreateFeature(); whether they are honored is driver
+ *     specific.</li>
+ * <li>GEOMETRY_NAME=name. Name of the column to use as the geometry of the
+ *     first geometry field.</li>
+ * </ul>
+ *
+ * This method is the same as the C function OGR_L_WriteArrowBatch().
+ *
+ * @param schema Schema of array. Must *not* be NULL.
+ * @param array Array of type struct. Must *not* be NULL.
+ * @param papszOptions Options. NULL terminated list of key=value options.
+ * @return true in case of success.
+ * @since GDAL 3.7
+ */
+bool OGRLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                               struct ArrowArray *array,
+                               CSLConstList papszOptions)
+{
+    if (strcmp(schema->format, "+s") != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "WriteArrowBatch(): schema format '%s' is not '+s'",
+                 schema->format);
+        return false;
+    }
+    if (schema->n_children != array->n_children)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "WriteArrowBatch(): number of children of schema and array "
+                 "differ");
+        return false;
+    }
+
+    const auto poLayerDefn = GetLayerDefn();
+    const char *pszFIDName = CSLFetchNameValueDef(
+        papszOptions, "FID",
+        GetFIDColumn()[0] != '\0' ? GetFIDColumn() : "OGC_FID");
+    const char *pszGeomName = CSLFetchNameValue(papszOptions, "GEOMETRY_NAME");
+
+    std::vector<OGRArrowBatchColumn> aoColumns;
+    std::vector<const struct ArrowSchema *> apoUnmatchedWKB;
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        OGRArrowBatchColumn oCol;
+        oCol.psSchema = schema->children[i];
+        oCol.psArray = array->children[i];
+        const char *pszName = oCol.psSchema->name ? oCol.psSchema->name : "";
+
+        if (oCol.psArray->length < array->offset + array->length)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "WriteArrowBatch(): array of column %s is too short",
+                     pszName);
+            return false;
+        }
+        if (!ParseArrowBatchFormat(oCol.psSchema->format, oCol, oCol.eType))
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "WriteArrowBatch(): unsupported format '%s' for column %s",
+                     oCol.psSchema->format, pszName);
+            return false;
+        }
+        if (oCol.eType == OGRArrowBatchType::LIST ||
+            oCol.eType == OGRArrowBatchType::LARGE_LIST)
+        {
+            OGRArrowBatchColumn oItem;
+            if (oCol.psSchema->n_children != 1 ||
+                oCol.psArray->n_children != 1 ||
+                !ParseArrowBatchFormat(oCol.psSchema->children[0]->format,
+                                       oItem, oCol.eItemType) ||
+                !(IsArrowBatchTypeNumeric(oCol.eItemType) ||
+                  oCol.eItemType == OGRArrowBatchType::STRING ||
+                  oCol.eItemType == OGRArrowBatchType::LARGE_STRING))
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "WriteArrowBatch(): unsupported list type for "
+                         "column %s",
+                         pszName);
+                return false;
+            }
+        }
+        const int nMinBuffers =
+            (IsArrowBatchTypeBinary(oCol.eType) &&
+             oCol.eType != OGRArrowBatchType::FIXED_BINARY)
+                ? 3
+                : 2;
+        if (oCol.psArray->n_buffers < nMinBuffers)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "WriteArrowBatch(): unexpected number of buffers for "
+                     "column %s",
+                     pszName);
+            return false;
+        }
+
+        if (EQUAL(pszName, pszFIDName) &&
+            oCol.eType <= OGRArrowBatchType::UINT64)
+        {
+            oCol.bIsFID = true;
+        }
+        else if (IsArrowBatchTypeBinary(oCol.eType) &&
+                 oCol.eType != OGRArrowBatchType::STRING &&
+                 oCol.eType != OGRArrowBatchType::LARGE_STRING &&
+                 ((oCol.iGeomField = poLayerDefn->GetGeomFieldIndex(
+                       pszName)) >= 0 ||
+                  (pszGeomName && EQUAL(pszName, pszGeomName) &&
+                   poLayerDefn->GetGeomFieldCount() > 0) ||
+                  (poLayerDefn->GetGeomFieldCount() > 0 &&
+                   poLayerDefn->GetGeomFieldDefn(0)->GetNameRef()[0] ==
+                       '\0' &&
+                   EQUAL(pszName, "wkb_geometry"))))
+        {
+            if (oCol.iGeomField < 0)
+                oCol.iGeomField = 0;
+        }
+        else if ((oCol.iField = poLayerDefn->GetFieldIndex(pszName)) < 0)
+        {
+            if (IsArrowBatchTypeBinary(oCol.eType) &&
+                IsArrowSchemaOGCWKB(oCol.psSchema))
+            {
+                apoUnmatchedWKB.push_back(oCol.psSchema);
+                oCol.iGeomField = -2;
+            }
+            else
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "WriteArrowBatch(): field %s does not exist in "
+                         "layer %s. Ignoring it",
+                         pszName, GetDescription());
+                continue;
+            }
+        }
+        aoColumns.push_back(oCol);
+    }
+
+    // Map a single ogc.wkb column whose name does not match to the single
+    // geometry field of the layer.
+    for (auto &oCol : aoColumns)
+    {
+        if (oCol.iGeomField == -2)
+        {
+            if (apoUnmatchedWKB.size() == 1 &&
+                poLayerDefn->GetGeomFieldCount() == 1 &&
+                std::none_of(aoColumns.begin(), aoColumns.end(),
+                             [](const OGRArrowBatchColumn &oOther)
+                             { return oOther.iGeomField == 0; }))
+            {
+                oCol.iGeomField = 0;
+            }
+            else
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "WriteArrowBatch(): geometry column %s does not "
+                         "exist in layer %s. Ignoring it",
+                         oCol.psSchema->name, GetDescription());
+                oCol.iGeomField = -1;
+            }
+        }
+    }
+
+    OGRFeature oFeature(poLayerDefn);
+    std::string osTmp;
+    std::vector<int> anTmp;
+    std::vector<GIntBig> anTmp64;
+    std::vector<double> adfTmp;
+    CPLStringList aosTmp;
+    for (int64_t iRow = 0; iRow < array->length; ++iRow)
+    {
+        oFeature.SetFID(OGRNullFID);
+        for (const auto &oCol : aoColumns)
+        {
+            const int64_t nIdx = oCol.psArray->offset + array->offset + iRow;
+            const bool bIsNull = IsArrowBatchNull(oCol.psArray, nIdx);
+            if (oCol.bIsFID)
+            {
+                if (!bIsNull)
+                    oFeature.SetFID(static_cast<GIntBig>(
+                        GetArrowBatchInteger(oCol.eType, oCol.psArray, nIdx)));
+                continue;
+            }
+            if (oCol.iGeomField >= 0)
+            {
+                OGRGeometry *poGeom = nullptr;
+                if (!bIsNull)
+                {
+                    size_t nLen = 0;
+                    const GByte *pabyWKB = GetArrowBatchBinary(
+                        oCol.eType, oCol.nFixedWidth, oCol.psArray, nIdx, nLen);
+                    if (OGRGeometryFactory::createFromWkb(
+                            pabyWKB,
+                            poLayerDefn->GetGeomFieldDefn(oCol.iGeomField)
+                                ->GetSpatialRef(),
+                            &poGeom, nLen) != OGRERR_NONE)
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "WriteArrowBatch(): invalid WKB content at "
+                                 "row " CPL_FRMT_GIB " of column %s",
+                                 static_cast<GIntBig>(iRow),
+                                 oCol.psSchema->name);
+                        return false;
+                    }
+                }
+                oFeature.SetGeomFieldDirectly(oCol.iGeomField, poGeom);
+                continue;
+            }
+            if (oCol.iField < 0)
+                continue;
+            if (bIsNull)
+            {
+                oFeature.SetFieldNull(oCol.iField);
+                continue;
+            }
+            switch (oCol.eType)
+            {
+                case OGRArrowBatchType::BOOL:
+                case OGRArrowBatchType::INT8:
+                case OGRArrowBatchType::UINT8:
+                case OGRArrowBatchType::INT16:
+                case OGRArrowBatchType::UINT16:
+                case OGRArrowBatchType::INT32:
+                    oFeature.SetField(oCol.iField,
+                                      static_cast<int>(GetArrowBatchInteger(
+                                          oCol.eType, oCol.psArray, nIdx)));
+                    break;
+
+                case OGRArrowBatchType::UINT32:
+                case OGRArrowBatchType::INT64:
+                case OGRArrowBatchType::UINT64:
+                    oFeature.SetField(oCol.iField,
+                                      static_cast<GIntBig>(GetArrowBatchInteger(
+                                          oCol.eType, oCol.psArray, nIdx)));
+                    break;
+
+                case OGRArrowBatchType::FLOAT32:
+                case OGRArrowBatchType::FLOAT64:
+                    oFeature.SetField(
+                        oCol.iField,
+                        GetArrowBatchReal(oCol.eType, oCol.psArray, nIdx));
+                    break;
+
+                case OGRArrowBatchType::STRING:
+                case OGRArrowBatchType::LARGE_STRING:
+                {
+                    size_t nLen = 0;
+                    const GByte *pabyData = GetArrowBatchBinary(
+                        oCol.eType, 0, oCol.psArray, nIdx, nLen);
+                    osTmp.assign(reinterpret_cast<const char *>(pabyData),
+                                 nLen);
+                    oFeature.SetField(oCol.iField, osTmp.c_str());
+                    break;
+                }
+
+                case OGRArrowBatchType::BINARY:
+                case OGRArrowBatchType::LARGE_BINARY:
+                case OGRArrowBatchType::FIXED_BINARY:
+                {
+                    size_t nLen = 0;
+                    const GByte *pabyData = GetArrowBatchBinary(
+                        oCol.eType, oCol.nFixedWidth, oCol.psArray, nIdx, nLen);
+                    oFeature.SetField(oCol.iField, static_cast<int>(nLen),
+                                      pabyData);
+                    break;
+                }
+
+                case OGRArrowBatchType::DATE32:
+                case OGRArrowBatchType::DATE64:
+                case OGRArrowBatchType::TIME32:
+                case OGRArrowBatchType::TIME64:
+                case OGRArrowBatchType::TIMESTAMP:
+                    SetArrowBatchDateTime(
+                        oFeature, oCol.iField,
+                        GetArrowBatchInteger(oCol.eType, oCol.psArray, nIdx),
+                        oCol);
+                    break;
+
+                case OGRArrowBatchType::LIST:
+                case OGRArrowBatchType::LARGE_LIST:
+                    SetArrowBatchList(oFeature, oCol.iField, oCol, nIdx, anTmp,
+                                      anTmp64, adfTmp, aosTmp);
+                    break;
+            }
+        }
+        if (CreateFeature(&oFeature) != OGRERR_NONE)
+            return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                      OGR_L_WriteArrowBatch()                         */
+/************************************************************************/
+
+/** Writes a batch of rows from an ArrowArray.
+ *
+ * This is semantically close to calling OGR_L_CreateFeature() with multiple
+ * features at once.
+ *
+ * The ArrowArray must be of type struct (format=+s), and its children
+ * generally map to a OGR attribute or geometry field (unless they are
+ * identified as the FID column). Mapping is done by name. Geometry columns
+ * must be binary columns encoded as WKB.
+ *
+ * The ownership of the array is not transferred: the caller remains
+ * responsible for calling its release callback.
+ *
+ * Layers that have a specialized implementation advertise the
+ * OLCFastWriteArrowBatch capability.
+ *
+ * Options may be driver specific. The default implementation recognizes the
+ * following options:
+ * <ul>
+ * <li>FID=name. Name of the FID column in the array. If not provided,
+ *     OGR_L_GetFIDColumn() is used. If the layer has no FID column name,
+ *     a column named OGC_FID is used, consistently with
+ *     OGR_L_GetArrowStream().</li>
+ * <li>GEOMETRY_NAME=name. Name of the column to use as the geometry of the
+ *     first geometry field.</li>
+ * </ul>
+ *
+ * This method is the same as the C++ method OGRLayer::WriteArrowBatch().
+ *
+ * @param hLayer Layer.
+ * @param schema Schema of array. Must *not* be NULL.
+ * @param array Array of type struct. Must *not* be NULL.
+ * @param papszOptions Options. NULL terminated list of key=value options.
+ * @return true in case of success.
+ * @since GDAL 3.7
+ */
+bool OGR_L_WriteArrowBatch(OGRLayerH hLayer, const struct ArrowSchema *schema,
+                           struct ArrowArray *array, char **papszOptions)
+{
+    VALIDATE_POINTER1(hLayer, "OGR_L_WriteArrowBatch", false);
+    VALIDATE_POINTER1(schema, "OGR_L_WriteArrowBatch", false);
+    VALIDATE_POINTER1(array, "OGR_L_WriteArrowBatch", false);
+
+    return OGRLayer::FromHandle(hLayer)->WriteArrowBatch(schema, array,
+                                                         papszOptions);
+}
+
 /************************************************************************/
 /*                     OGRLayer::GetGeometryTypes()                     */
 /************************************************************************/
@@ -79,6 +79,8 @@ class OGRGeoJSONLayer final : public OGRMemLayer
     virtual OGRFeature *GetNextFeature() override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
     virtual GIntBig GetFeatureCount(int bForce) override;
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
 
     OGRErr ISetFeature(OGRFeature *poFeature) override;
     OGRErr ICreateFeature(OGRFeature *poFeature) override;
@@ -124,6 +126,7 @@ class OGRGeoJSONLayer final : public OGRMemLayer
 
     bool IngestAll();
     void TerminateAppendSession();
+    bool CanReadArrowArrayNatively();
 };
 
 /************************************************************************/
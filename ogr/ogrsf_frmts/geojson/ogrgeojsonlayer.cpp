@@ -28,6 +28,7 @@
  ****************************************************************************/
 
 #include <algorithm>
+#include <memory>
 
 #if !DEBUG_JSON
 #ifdef __clang__
@@ -48,6 +49,7 @@
 
 #include "ogr_geojson.h"
 #include "ogrgeojsonreader.h"
+#include "ograrrowarrayhelper.h"
 
 /************************************************************************/
 /*                       STATIC MEMBERS DEFINITION                      */
@@ -178,6 +180,287 @@ OGRFeature *OGRGeoJSONLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                     CanReadArrowArrayNatively()                      */
+/*                                                                      */
+/*      Whether GetNextArrowArray() can translate the GeoJSON objects   */
+/*      of the streaming reader directly into Arrow arrays, instead of  */
+/*      going through OGRFeature.                                       */
+/************************************************************************/
+
+bool OGRGeoJSONLayer::CanReadArrowArrayNatively()
+{
+    if (poReader_ == nullptr || m_poAttrQuery != nullptr ||
+        !poReader_->HasSimpleFeatureLayout() ||
+        CPLTestBool(CPLGetConfigOption("OGR_GEOJSON_STREAM_BASE_IMPL", "NO")))
+    {
+        return false;
+    }
+
+    OGRFeatureDefn *poFeatureDefn = GetLayerDefn();
+    for (int i = 0; i < poFeatureDefn->GetFieldCount(); i++)
+    {
+        const OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        const OGRFieldType eType = poFieldDefn->GetType();
+        const OGRFieldSubType eSubType = poFieldDefn->GetSubType();
+        if (!((eSubType == OFSTNone &&
+               (eType == OFTString || eType == OFTInteger ||
+                eType == OFTInteger64 || eType == OFTReal ||
+                eType == OFTDate || eType == OFTDateTime)) ||
+              (eSubType == OFSTBoolean && eType == OFTInteger) ||
+              (eSubType == OFSTJSON && eType == OFTString)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/************************************************************************/
+
+int OGRGeoJSONLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                       struct ArrowArray *out_array)
+{
+    if (!CanReadArrowArrayNatively())
+    {
+        return OGRMemLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    if (bHasAppendedFeatures_)
+    {
+        ResetReading();
+    }
+
+    OGRFeatureDefn *poFeatureDefn = GetLayerDefn();
+    OGRArrowArrayHelper sHelper(poDS_, poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    const int iGeomArrowField =
+        sHelper.nGeomFieldCount > 0 ? sHelper.mapOGRGeomFieldToArrowField[0]
+                                    : -1;
+    const bool bNeedGeometry =
+        iGeomArrowField >= 0 || m_poFilterGeom != nullptr;
+    const int iFIDField =
+        sFIDColumn_.empty() ? -1 : poFeatureDefn->GetFieldIndex(sFIDColumn_);
+    const int iIdField = poFeatureDefn->GetFieldIndexCaseSensitive("id");
+    const bool bFeatureLevelIdAsFID = poReader_->IsFeatureLevelIdAsFID();
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    int errorErrno = 0;
+    int iFeat = 0;
+    while (iFeat < sHelper.nMaxBatchSize)
+    {
+        json_object *poObj = poReader_->GetNextFeatureObject(this);
+        if (poObj == nullptr)
+            break;
+
+        /* -------------------------------------------------------------- */
+        /*      Properties, or top-level members if there is no           */
+        /*      "properties" member, as in OGRGeoJSONBaseReader::         */
+        /*      ReadFeature().                                            */
+        /* -------------------------------------------------------------- */
+        json_object *poObjProps =
+            OGRGeoJSONFindMemberByName(poObj, "properties");
+        json_object *poObjAttrs = poObj;
+        if (poObjProps != nullptr)
+        {
+            poObjAttrs = json_object_get_type(poObjProps) == json_type_object
+                             ? poObjProps
+                             : nullptr;
+        }
+
+        json_object *poObjId = OGRGeoJSONFindMemberByName(poObj, "id");
+        GIntBig nFID = OGRNullFID;
+        if (poObjId != nullptr && bFeatureLevelIdAsFID)
+        {
+            nFID = static_cast<GIntBig>(json_object_get_int64(poObjId));
+        }
+        else if (iFIDField >= 0 && poObjProps != nullptr &&
+                 poObjAttrs == poObjProps)
+        {
+            json_object *poVal = CPL_json_object_object_get(
+                poObjProps,
+                poFeatureDefn->GetFieldDefn(iFIDField)->GetNameRef());
+            if (poVal != nullptr)
+                nFID = static_cast<GIntBig>(json_object_get_int64(poVal));
+        }
+        if (nFID == OGRNullFID)
+        {
+            nFID = nNextFID_;
+            nNextFID_++;
+        }
+
+        /* -------------------------------------------------------------- */
+        /*      Geometry, and spatial filter.                             */
+        /* -------------------------------------------------------------- */
+        std::unique_ptr<OGRGeometry> poGeom;
+        if (bNeedGeometry)
+        {
+            json_object *poObjGeom =
+                OGRGeoJSONFindMemberByName(poObj, "geometry");
+            if (poObjGeom != nullptr)
+            {
+                poGeom.reset(
+                    poReader_->ReadGeometry(poObjGeom, GetSpatialRef()));
+            }
+        }
+        if (m_poFilterGeom != nullptr && !FilterGeometry(poGeom.get()))
+        {
+            json_object_put(poObj);
+            continue;
+        }
+
+        if (sHelper.panFIDValues)
+            sHelper.panFIDValues[iFeat] = nFID;
+
+        if (iGeomArrowField >= 0)
+        {
+            if (poGeom)
+            {
+                const size_t nWKBSize = poGeom->WkbSize();
+                GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                    iGeomArrowField, iFeat, nWKBSize);
+                if (outPtr == nullptr)
+                    errorErrno = ENOMEM;
+                else
+                    poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            }
+            else if (!sHelper.SetNull(iGeomArrowField, iFeat))
+            {
+                errorErrno = ENOMEM;
+            }
+        }
+
+        /* -------------------------------------------------------------- */
+        /*      Attributes.                                               */
+        /* -------------------------------------------------------------- */
+        for (int iField = 0; errorErrno == 0 && iField < sHelper.nFieldCount;
+             iField++)
+        {
+            const int iArrowField = sHelper.mapOGRFieldToArrowField[iField];
+            if (iArrowField < 0)
+                continue;
+            auto psArray = out_array->children[iArrowField];
+            const OGRFieldDefn *poFieldDefn =
+                poFeatureDefn->GetFieldDefn(iField);
+            const OGRFieldType eType = poFieldDefn->GetType();
+
+            json_object *poVal = nullptr;
+            bool bIsNull = true;
+            if (poObjAttrs != nullptr &&
+                json_object_object_get_ex(poObjAttrs,
+                                          poFieldDefn->GetNameRef(), &poVal))
+            {
+                bIsNull = poVal == nullptr;
+            }
+            else if (iField == iIdField && poObjId != nullptr &&
+                     !bFeatureLevelIdAsFID)
+            {
+                // Feature-level "id" as a regular field
+                poVal = poObjId;
+                bIsNull = false;
+            }
+
+            if (!bIsNull)
+            {
+                switch (eType)
+                {
+                    case OFTString:
+                    {
+                        const char *pszVal = json_object_get_string(poVal);
+                        const size_t nLen = strlen(pszVal);
+                        GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                            iArrowField, iFeat, nLen);
+                        if (outPtr == nullptr)
+                            errorErrno = ENOMEM;
+                        else
+                            memcpy(outPtr, pszVal, nLen);
+                        break;
+                    }
+
+                    case OFTInteger:
+                    {
+                        const int nVal = json_object_get_int(poVal);
+                        if (poFieldDefn->GetSubType() != OFSTBoolean)
+                            sHelper.SetInt32(psArray, iFeat, nVal);
+                        else if (nVal != 0)
+                            sHelper.SetBoolOn(psArray, iFeat);
+                        break;
+                    }
+
+                    case OFTInteger64:
+                        sHelper.SetInt64(psArray, iFeat,
+                                         json_object_get_int64(poVal));
+                        break;
+
+                    case OFTReal:
+                        sHelper.SetDouble(psArray, iFeat,
+                                          json_object_get_double(poVal));
+                        break;
+
+                    case OFTDate:
+                    case OFTDateTime:
+                    {
+                        OGRField sField;
+                        if (!OGRParseDate(json_object_get_string(poVal),
+                                          &sField, 0))
+                            bIsNull = true;
+                        else if (eType == OFTDate)
+                            sHelper.SetDate(psArray, iFeat, brokenDown,
+                                            sField);
+                        else
+                            sHelper.SetDateTime(psArray, iFeat, brokenDown,
+                                                sField);
+                        break;
+                    }
+
+                    default:
+                        CPLAssert(false);
+                        break;
+                }
+            }
+
+            if (bIsNull)
+            {
+                if (sHelper.abNullableFields[iField])
+                {
+                    if (!sHelper.SetNull(iArrowField, iFeat))
+                        errorErrno = ENOMEM;
+                }
+                else if (eType == OFTString)
+                {
+                    sHelper.SetEmptyStringOrBinary(psArray, iFeat);
+                }
+            }
+        }
+
+        json_object_put(poObj);
+        if (errorErrno != 0)
+            break;
+
+        nFeatureReadSinceReset_++;
+        iFeat++;
+    }
+
+    if (errorErrno != 0 || iFeat == 0)
+    {
+        sHelper.ClearArray();
+        return errorErrno;
+    }
+
+    sHelper.Shrink(iFeat);
+    return 0;
+}
+
 /************************************************************************/
 /*                          GetFeatureCount()                           */
 /************************************************************************/
@@ -451,6 +734,8 @@ int OGRGeoJSONLayer::TestCapability(const char *pszCap)
         return TRUE;
     else if (EQUAL(pszCap, OLCStringsAsUTF8))
         return TRUE;
+    else if (EQUAL(pszCap, OLCFastGetArrowStream))
+        return CanReadArrowArrayNatively();
     return OGRMemLayer::TestCapability(pszCap);
 }
 
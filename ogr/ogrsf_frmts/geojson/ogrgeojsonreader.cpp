@@ -100,6 +100,12 @@ class OGRGeoJSONReaderStreamingParser : public CPLJSonStreamingParser
     std::vector<OGRFeature *> m_apoFeatures;
     size_t m_nCurFeatureIdx;
 
+    // When set, features are kept as json_object instead of being
+    // translated to OGRFeature.
+    bool m_bKeepFeatureObjects = false;
+    std::vector<json_object *> m_apoFeatureObjects{};
+    size_t m_nCurFeatureObjectIdx = 0;
+
     bool m_bStartFeature = false;
     bool m_bEndFeature = false;
 
@@ -138,6 +144,12 @@ class OGRGeoJSONReaderStreamingParser : public CPLJSonStreamingParser
 
     OGRFeature *GetNextFeature();
     json_object *StealRootObject();
+
+    void SetKeepFeatureObjects(bool bKeep)
+    {
+        m_bKeepFeatureObjects = bKeep;
+    }
+    json_object *GetNextFeatureObject();
     inline bool IsTypeKnown() const
     {
         return m_bIsTypeKnown;
@@ -344,6 +356,8 @@ OGRGeoJSONReaderStreamingParser::~OGRGeoJSONReaderStreamingParser()
         json_object_put(m_poCurObj);
     for (size_t i = 0; i < m_apoFeatures.size(); i++)
         delete m_apoFeatures[i];
+    for (size_t i = 0; i < m_apoFeatureObjects.size(); i++)
+        json_object_put(m_apoFeatureObjects[i]);
 }
 
 /************************************************************************/
@@ -377,6 +391,24 @@ OGRFeature *OGRGeoJSONReaderStreamingParser::GetNextFeature()
     return nullptr;
 }
 
+/************************************************************************/
+/*                        GetNextFeatureObject()                        */
+/************************************************************************/
+
+json_object *OGRGeoJSONReaderStreamingParser::GetNextFeatureObject()
+{
+    if (m_nCurFeatureObjectIdx < m_apoFeatureObjects.size())
+    {
+        json_object *poObj = m_apoFeatureObjects[m_nCurFeatureObjectIdx];
+        m_apoFeatureObjects[m_nCurFeatureObjectIdx] = nullptr;
+        m_nCurFeatureObjectIdx++;
+        return poObj;
+    }
+    m_nCurFeatureObjectIdx = 0;
+    m_apoFeatureObjects.clear();
+    return nullptr;
+}
+
 /************************************************************************/
 /*                            AppendObject()                            */
 /************************************************************************/
@@ -495,6 +527,10 @@ void OGRGeoJSONReaderStreamingParser::EndObject()
                 }
             }
         }
+        else if (m_bKeepFeatureObjects)
+        {
+            m_apoFeatureObjects.push_back(json_object_get(m_poCurObj));
+        }
         else
         {
             OGRFeature *poFeat =
@@ -1103,12 +1139,11 @@ void OGRGeoJSONReader::ResetReading()
 }
 
 /************************************************************************/
-/*                           GetNextFeature()                           */
+/*                    StartStreamingParserIfNeeded()                    */
 /************************************************************************/
 
-OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer)
+void OGRGeoJSONReader::StartStreamingParserIfNeeded(OGRGeoJSONLayer *poLayer)
 {
-    CPLAssert(fp_);
     if (poStreamingParser_ == nullptr)
     {
         poStreamingParser_ = new OGRGeoJSONReaderStreamingParser(
@@ -1117,40 +1152,75 @@ OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer)
         bFirstSeg_ = true;
         bJSonPLikeWrapper_ = false;
     }
+}
 
-    OGRFeature *poFeat = poStreamingParser_->GetNextFeature();
-    if (poFeat)
-        return poFeat;
+/************************************************************************/
+/*                          ParseNextChunk()                            */
+/*                                                                      */
+/*      Feed the next buffer of the file to the streaming parser.       */
+/*      Return false in case of error.                                  */
+/************************************************************************/
 
-    while (true)
+bool OGRGeoJSONReader::ParseNextChunk(bool &bFinished)
+{
+    size_t nRead = VSIFReadL(pabyBuffer_, 1, nBufferSize_, fp_);
+    bFinished = nRead < nBufferSize_;
+    size_t nSkip = 0;
+    if (bFirstSeg_)
     {
-        size_t nRead = VSIFReadL(pabyBuffer_, 1, nBufferSize_, fp_);
-        const bool bFinished = nRead < nBufferSize_;
-        size_t nSkip = 0;
-        if (bFirstSeg_)
-        {
-            bFirstSeg_ = false;
-            nSkip = SkipPrologEpilogAndUpdateJSonPLikeWrapper(nRead);
-        }
-        if (bFinished && bJSonPLikeWrapper_ && nRead - nSkip > 0)
-            nRead--;
-        if (!poStreamingParser_->Parse(
-                reinterpret_cast<const char *>(pabyBuffer_ + nSkip),
-                nRead - nSkip, bFinished) ||
-            poStreamingParser_->ExceptionOccurred())
-        {
-            break;
-        }
+        bFirstSeg_ = false;
+        nSkip = SkipPrologEpilogAndUpdateJSonPLikeWrapper(nRead);
+    }
+    if (bFinished && bJSonPLikeWrapper_ && nRead - nSkip > 0)
+        nRead--;
+    return poStreamingParser_->Parse(
+               reinterpret_cast<const char *>(pabyBuffer_ + nSkip),
+               nRead - nSkip, bFinished) &&
+           !poStreamingParser_->ExceptionOccurred();
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer)
+{
+    CPLAssert(fp_);
+    StartStreamingParserIfNeeded(poLayer);
+    poStreamingParser_->SetKeepFeatureObjects(false);
 
+    OGRFeature *poFeat = poStreamingParser_->GetNextFeature();
+    bool bFinished = false;
+    while (poFeat == nullptr && !bFinished && ParseNextChunk(bFinished))
+    {
         poFeat = poStreamingParser_->GetNextFeature();
-        if (poFeat)
-            return poFeat;
+    }
 
-        if (bFinished)
-            break;
+    return poFeat;
+}
+
+/************************************************************************/
+/*                        GetNextFeatureObject()                        */
+/************************************************************************/
+
+/** Return the next GeoJSON Feature object of the FeatureCollection, to be
+ * released with json_object_put(), without translating it to OGRFeature
+ * as GetNextFeature() does.
+ */
+json_object *OGRGeoJSONReader::GetNextFeatureObject(OGRGeoJSONLayer *poLayer)
+{
+    CPLAssert(fp_);
+    StartStreamingParserIfNeeded(poLayer);
+    poStreamingParser_->SetKeepFeatureObjects(true);
+
+    json_object *poObj = poStreamingParser_->GetNextFeatureObject();
+    bool bFinished = false;
+    while (poObj == nullptr && !bFinished && ParseNextChunk(bFinished))
+    {
+        poObj = poStreamingParser_->GetNextFeatureObject();
     }
 
-    return nullptr;
+    return poObj;
 }
 
 /************************************************************************/
@@ -116,6 +116,19 @@ class OGRGeoJSONBaseReader
     OGRFeature *ReadFeature(OGRLayer *poLayer, json_object *poObj,
                             const char *pszSerializedObj);
 
+    // Whether ReadFeature() does nothing more than mapping the members of
+    // "properties" to the fields of the same name, "id" to the FID or
+    // the "id" field, and "geometry" to the geometry.
+    bool HasSimpleFeatureLayout() const
+    {
+        return !bStoreNativeData_ && !bAttributesSkip_ &&
+               !bFlattenNestedAttributes_ && !bIsGeocouchSpatiallistFormat;
+    }
+    bool IsFeatureLevelIdAsFID() const
+    {
+        return bFeatureLevelIdAsFID_;
+    }
+
   protected:
     bool bGeometryPreserve_ = true;
     bool bAttributesSkip_ = false;
@@ -173,6 +186,7 @@ class OGRGeoJSONReader : public OGRGeoJSONBaseReader
 
     void ResetReading();
     OGRFeature *GetNextFeature(OGRGeoJSONLayer *poLayer);
+    json_object *GetNextFeatureObject(OGRGeoJSONLayer *poLayer);
     OGRFeature *GetFeature(OGRGeoJSONLayer *poLayer, GIntBig nFID);
     bool IngestAll(OGRGeoJSONLayer *poLayer);
 
@@ -223,6 +237,9 @@ class OGRGeoJSONReader : public OGRGeoJSONBaseReader
 
     void ReadFeatureCollection(OGRGeoJSONLayer *poLayer, json_object *poObj);
     size_t SkipPrologEpilogAndUpdateJSonPLikeWrapper(size_t nRead);
+
+    void StartStreamingParserIfNeeded(OGRGeoJSONLayer *poLayer);
+    bool ParseNextChunk(bool &bFinished);
 };
 
 void OGRGeoJSONReaderSetField(OGRLayer *poLayer, OGRFeature *poFeature,
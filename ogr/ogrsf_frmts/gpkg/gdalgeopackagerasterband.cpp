@@ -31,9 +31,12 @@
 #include "gdal_alg_priv.h"
 #include "ogrsqlitevfs.h"
 #include "cpl_error.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #if !defined(DEBUG_VERBOSE) && defined(DEBUG_VERBOSE_GPKG)
 #define DEBUG_VERBOSE
@@ -1231,6 +1234,257 @@ retry:
     return CE_None;
 }
 
+/************************************************************************/
+/*                     PreloadTilesMultiThreaded()                      */
+/************************************************************************/
+
+// Fetch the blobs of the tiles intersecting a RasterIO() request with a
+// single SQL query, decode them concurrently on the global thread pool, and
+// store them in the block cache where IReadBlock() will find them.
+// This is a best effort: tiles that are not handled here, or whose decoding
+// emits an error or a warning, are read by IReadBlock() as usual.
+void GDALGPKGMBTilesLikePseudoDataset::PreloadTilesMultiThreaded(
+    int nXOff, int nYOff, int nXSize, int nYSize, int nBufXSize, int nBufYSize)
+{
+    if (m_pabyCachedTiles == nullptr || IGetUpdate() ||
+        m_nShiftXPixelsMod != 0 || m_nShiftYPixelsMod != 0)
+    {
+        return;
+    }
+
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads =
+        std::min(128, EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                       : atoi(pszNumThreads));
+    if (nThreads <= 1)
+        return;
+
+    // Downsampling requests will likely be served by overviews
+    GDALRasterBand *poBand1 = IGetRasterBand(1);
+    if ((nBufXSize < nXSize || nBufYSize < nYSize) &&
+        poBand1->GetOverviewCount() > 0)
+    {
+        return;
+    }
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand1->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBands = IGetRasterCount();
+    const int nBlockXStart = nXOff / nBlockXSize;
+    const int nBlockXEnd = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nBlockYStart = nYOff / nBlockYSize;
+    const int nBlockYEnd = (nYOff + nYSize - 1) / nBlockYSize;
+    const size_t nBandBlockSize =
+        static_cast<size_t>(nBlockXSize) * nBlockYSize * m_nDTSize;
+    const int nTileBands = m_eDT == GDT_Byte ? 4 : 1;
+
+    // Preloaded tiles must stay in the block cache until they are consumed.
+    // Arbitrarily use at most half of the remaining cache size.
+    const GIntBig nCacheAvailable =
+        (GDALGetCacheMax64() - GDALGetCacheUsed64()) / 2;
+    const GIntBig nMaxTiles =
+        nCacheAvailable / static_cast<GIntBig>(nTileBands * nBandBlockSize);
+
+    struct TileJob
+    {
+        GDALGPKGMBTilesLikePseudoDataset *poTPD = nullptr;
+        int nRow = 0;
+        int nCol = 0;
+        double dfTileOffset = 0.0;
+        double dfTileScale = 1.0;
+        std::vector<GByte> abyRawData{};
+        std::vector<GByte> abyTileData{};
+        CPLString osMemFileName{};
+        bool bOK = false;
+    };
+
+    // Collect the tiles that are not already cached
+    const int nColMin = nBlockXStart + m_nShiftXTiles;
+    const int nColMax = nBlockXEnd + m_nShiftXTiles;
+    const int nRowMin = nBlockYStart + m_nShiftYTiles;
+    const int nRowMax = nBlockYEnd + m_nShiftYTiles;
+    const int nCols = nColMax - nColMin + 1;
+    std::vector<int> anTileIdx(
+        static_cast<size_t>(nCols) * (nRowMax - nRowMin + 1), -1);
+    std::vector<TileJob> asTiles;
+    for (int nRow = nRowMin; nRow <= nRowMax; ++nRow)
+    {
+        for (int nCol = nColMin; nCol <= nColMax; ++nCol)
+        {
+            if (nRow < 0 || nCol < 0 || nRow >= m_nTileMatrixHeight ||
+                nCol >= m_nTileMatrixWidth ||
+                static_cast<GIntBig>(asTiles.size()) >= nMaxTiles)
+            {
+                continue;
+            }
+            auto poBand =
+                cpl::down_cast<GDALGPKGMBTilesLikeRasterBand *>(poBand1);
+            GDALRasterBlock *poBlock = poBand->AccessibleTryGetLockedBlockRef(
+                nCol - m_nShiftXTiles, nRow - m_nShiftYTiles);
+            if (poBlock)
+            {
+                poBlock->DropLock();
+                continue;
+            }
+            anTileIdx[static_cast<size_t>(nRow - nRowMin) * nCols + nCol -
+                      nColMin] = static_cast<int>(asTiles.size());
+            TileJob sJob;
+            sJob.poTPD = this;
+            sJob.nRow = nRow;
+            sJob.nCol = nCol;
+            asTiles.emplace_back(std::move(sJob));
+        }
+    }
+    if (asTiles.size() < 2)
+        return;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (poThreadPool == nullptr)
+        return;
+
+    // Make sure that the color table and nodata value, which are lazily
+    // established, are set before being used by the worker threads.
+    poBand1->GetColorTable();
+    poBand1->GetNoDataValue();
+
+    const int nRowTop1 = GetRowFromIntoTopConvention(nRowMin);
+    const int nRowTop2 = GetRowFromIntoTopConvention(nRowMax);
+    char *pszSQL = sqlite3_mprintf(
+        "SELECT tile_row, tile_column, tile_data%s FROM \"%w\" "
+        "WHERE zoom_level = %d AND tile_row >= %d AND tile_row <= %d AND "
+        "tile_column >= %d AND tile_column <= %d%s",
+        m_eDT != GDT_Byte ? ", id" : "",  // MBTiles do not have an id
+        m_osRasterTable.c_str(), m_nZoomLevel, std::min(nRowTop1, nRowTop2),
+        std::max(nRowTop1, nRowTop2), nColMin, nColMax,
+        !m_osWHERE.empty() ? CPLSPrintf(" AND (%s)", m_osWHERE.c_str()) : "");
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    sqlite3_free(pszSQL);
+    if (rc != SQLITE_OK)
+        return;
+
+    std::vector<void *> apJobs;
+    while (sqlite3_step(hStmt) == SQLITE_ROW)
+    {
+        const int nRow =
+            GetRowFromIntoTopConvention(sqlite3_column_int(hStmt, 0));
+        const int nCol = sqlite3_column_int(hStmt, 1);
+        if (nRow < nRowMin || nRow > nRowMax || nCol < nColMin ||
+            nCol > nColMax || sqlite3_column_type(hStmt, 2) != SQLITE_BLOB)
+        {
+            continue;
+        }
+        const int nIdx = anTileIdx[static_cast<size_t>(nRow - nRowMin) * nCols +
+                                   nCol - nColMin];
+        if (nIdx < 0 || !asTiles[nIdx].abyRawData.empty())
+            continue;
+        TileJob &sJob = asTiles[nIdx];
+        const int nBytes = sqlite3_column_bytes(hStmt, 2);
+        const GByte *pabyRawData =
+            static_cast<const GByte *>(sqlite3_column_blob(hStmt, 2));
+        try
+        {
+            sJob.abyRawData.assign(pabyRawData, pabyRawData + nBytes);
+            sJob.abyTileData.resize(nTileBands * nBandBlockSize);
+        }
+        catch (const std::exception &)
+        {
+            sJob.abyRawData.clear();
+            break;
+        }
+        if (m_eDT != GDT_Byte)
+        {
+            GetTileOffsetAndScale(sqlite3_column_int64(hStmt, 3),
+                                  sJob.dfTileOffset, sJob.dfTileScale);
+        }
+        sJob.osMemFileName.Printf("/vsimem/gpkg_read_tile_%p_%d_%d", this,
+                                  nRow, nCol);
+        apJobs.push_back(&sJob);
+    }
+    sqlite3_finalize(hStmt);
+    if (apJobs.size() < 2)
+        return;
+
+    const auto JobFunc = [](void *pData)
+    {
+        TileJob *psJob = static_cast<TileJob *>(pData);
+        // The tile is already decoded in a job of the global thread pool:
+        // prevent the tile driver from submitting and waiting for its own
+        // jobs to it.
+        CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", "1", false);
+        VSILFILE *fp = VSIFileFromMemBuffer(
+            psJob->osMemFileName.c_str(), psJob->abyRawData.data(),
+            psJob->abyRawData.size(), FALSE);
+        VSIFCloseL(fp);
+        // Errors and warnings are silenced here, and the tile is left
+        // for IReadBlock() to emit them again in the calling thread.
+        CPLPushErrorHandler(CPLQuietErrorHandler);
+        const auto nErrorCounter = CPLGetErrorCounter();
+        psJob->bOK = psJob->poTPD->ReadTile(psJob->osMemFileName,
+                                            psJob->abyTileData.data(),
+                                            psJob->dfTileOffset,
+                                            psJob->dfTileScale) == CE_None &&
+                     CPLGetErrorCounter() == nErrorCounter;
+        CPLPopErrorHandler();
+        VSIUnlink(psJob->osMemFileName.c_str());
+        psJob->abyRawData.clear();
+    };
+
+    CPLDebug("GPKG", "Decoding %d tiles with up to %d threads",
+             static_cast<int>(apJobs.size()), nThreads);
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (void *pJob : apJobs)
+    {
+        if (!poJobQueue->SubmitJob(JobFunc, pJob))
+            break;
+    }
+    poJobQueue->WaitCompletion();
+
+    for (const void *pJob : apJobs)
+    {
+        const TileJob *psJob = static_cast<const TileJob *>(pJob);
+        if (!psJob->bOK)
+            continue;
+        for (int iBand = 1; iBand <= nBands; iBand++)
+        {
+            GDALRasterBlock *poBlock =
+                IGetRasterBand(iBand)->GetLockedBlockRef(
+                    psJob->nCol - m_nShiftXTiles, psJob->nRow - m_nShiftYTiles,
+                    TRUE);
+            if (poBlock == nullptr)
+                continue;
+            if (!poBlock->GetDirty())
+            {
+                memcpy(poBlock->GetDataRef(),
+                       psJob->abyTileData.data() + (iBand - 1) * nBandBlockSize,
+                       nBandBlockSize);
+            }
+            poBlock->DropLock();
+        }
+    }
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GDALGPKGMBTilesLikeRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read)
+    {
+        m_poTPD->PreloadTilesMultiThreaded(nXOff, nYOff, nXSize, nYSize,
+                                           nBufXSize, nBufYSize);
+    }
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
+}
+
 /************************************************************************/
 /*                       WEBPSupports4Bands()                           */
 /************************************************************************/
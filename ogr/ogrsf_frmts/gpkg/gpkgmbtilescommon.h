@@ -133,6 +133,8 @@ class GDALGPKGMBTilesLikePseudoDataset
     CPLErr ReadTile(const CPLString &osMemFileName, GByte *pabyTileData,
                     double dfTileOffset, double dfTileScale,
                     bool *pbIsLossyFormat = nullptr);
+    void PreloadTilesMultiThreaded(int nXOff, int nYOff, int nXSize,
+                                   int nYSize, int nBufXSize, int nBufYSize);
     GByte *ReadTile(int nRow, int nCol);
     GByte *ReadTile(int nRow, int nCol, GByte *pabyData,
                     bool *pbIsLossyFormat = nullptr);
@@ -179,6 +181,11 @@ class GDALGPKGMBTilesLikeRasterBand : public GDALPamRasterBand
                               void *pData) override;
     virtual CPLErr IWriteBlock(int nBlockXOff, int nBlockYOff,
                                void *pData) override;
+    virtual CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                             int nXSize, int nYSize, void *pData, int nBufXSize,
+                             int nBufYSize, GDALDataType eBufType,
+                             GSpacing nPixelSpace, GSpacing nLineSpace,
+                             GDALRasterIOExtraArg *psExtraArg) override;
     virtual CPLErr FlushCache(bool bAtClosing) override;
 
     virtual GDALColorTable *GetColorTable() override;
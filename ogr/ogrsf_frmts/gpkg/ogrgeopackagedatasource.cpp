@@ -1069,6 +1069,12 @@ CPLErr GDALGeoPackageDataset::IRasterIO(
     GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
 
 {
+    if (eRWFlag == GF_Read)
+    {
+        PreloadTilesMultiThreaded(nXOff, nYOff, nXSize, nYSize, nBufXSize,
+                                  nBufYSize);
+    }
+
     CPLErr eErr = OGRSQLiteBaseDataSource::IRasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
         eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
@@ -2339,6 +2339,30 @@ OGRErr OGRGeoPackageTableLayer::ICreateFeature(OGRFeature *poFeature)
     return CreateOrUpsertFeature(poFeature, /* bUpsert=*/false);
 }
 
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+bool OGRGeoPackageTableLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                              struct ArrowArray *array,
+                                              CSLConstList papszOptions)
+{
+    // The generic implementation re-uses a single OGRFeature and the
+    // prepared INSERT statement of CreateOrUpsertFeature(). Wrapping the whole
+    // batch in a single transaction avoids a commit per row, which dominates
+    // the cost of bulk loads otherwise.
+    // As rows still go through OGRFeature, OLCFastWriteArrowBatch is not
+    // advertised.
+    if (m_poDS->SoftStartTransaction() != OGRERR_NONE)
+        return false;
+    if (!OGRGeoPackageLayer::WriteArrowBatch(schema, array, papszOptions))
+    {
+        m_poDS->SoftRollbackTransaction();
+        return false;
+    }
+    return m_poDS->SoftCommitTransaction() == OGRERR_NONE;
+}
+
 /************************************************************************/
 /*                  SetDeferredSpatialIndexCreation()                   */
 /************************************************************************/
@@ -56,6 +56,8 @@ class OGRLayerAttrIndex;
 class OGRSFDriver;
 
 struct ArrowArrayStream;
+struct ArrowSchema;
+struct ArrowArray;
 
 /************************************************************************/
 /*                               OGRLayer                               */
@@ -188,6 +190,9 @@ class CPL_DLL OGRLayer : public GDALMajorObject
     virtual GDALDataset *GetDataset();
     virtual bool GetArrowStream(struct ArrowArrayStream *out_stream,
                                 CSLConstList papszOptions = nullptr);
+    virtual bool WriteArrowBatch(const struct ArrowSchema *schema,
+                                 struct ArrowArray *array,
+                                 CSLConstList papszOptions = nullptr);
 
     OGRErr SetFeature(OGRFeature *poFeature) CPL_WARN_UNUSED_RESULT;
     OGRErr CreateFeature(OGRFeature *poFeature) CPL_WARN_UNUSED_RESULT;
@@ -309,6 +314,12 @@ class CPL_DLL OGRLayer : public GDALMajorObject
     {
         return m_pszAttrQueryString;
     }
+    // Non-null if the attribute filter is evaluated by OGR, rather than
+    // translated by the driver.
+    const OGRFeatureQuery *GetAttrQuery() const
+    {
+        return m_poAttrQuery;
+    }
     //! @endcond
 
     /** Convert a OGRLayer* to a OGRLayerH.
@@ -2789,6 +2789,8 @@ class FileGDBOGRGeometryConverterImpl final : public FileGDBOGRGeometryConverter
     virtual ~FileGDBOGRGeometryConverterImpl();
 
     virtual OGRGeometry *GetAsGeometry(const OGRField *psField) override;
+    virtual bool GetAsISOWKB(const OGRField *psField,
+                             std::vector<GByte> &abyWKB) override;
 };
 
 /************************************************************************/
@@ -3918,6 +3920,176 @@ FileGDBOGRGeometryConverterImpl::GetAsGeometry(const OGRField *psField)
     return nullptr;
 }
 
+/************************************************************************/
+/*                             XYWKBSetter                              */
+/************************************************************************/
+
+class XYWKBSetter
+{
+    GByte *pabyOut;
+    size_t nStride;
+
+  public:
+    XYWKBSetter(GByte *pabyOutIn, size_t nStrideIn)
+        : pabyOut(pabyOutIn), nStride(nStrideIn)
+    {
+    }
+
+    void set(int i, double dfX, double dfY)
+    {
+        GByte *pabyPoint = pabyOut + static_cast<size_t>(i) * nStride;
+        CPL_LSBPTR64(&dfX);
+        CPL_LSBPTR64(&dfY);
+        memcpy(pabyPoint, &dfX, sizeof(double));
+        memcpy(pabyPoint + sizeof(double), &dfY, sizeof(double));
+    }
+};
+
+/************************************************************************/
+/*                           WriteWKBHeader()                           */
+/************************************************************************/
+
+static GByte *WriteWKBUInt32(GByte *pabyOut, GUInt32 nVal)
+{
+    CPL_LSBPTR32(&nVal);
+    memcpy(pabyOut, &nVal, sizeof(GUInt32));
+    return pabyOut + sizeof(GUInt32);
+}
+
+static GByte *WriteWKBHeader(GByte *pabyOut, OGRwkbGeometryType eType)
+{
+    pabyOut[0] = static_cast<GByte>(wkbNDR);
+    return WriteWKBUInt32(pabyOut + 1, static_cast<GUInt32>(eType));
+}
+
+/************************************************************************/
+/*                            GetAsISOWKB()                             */
+/************************************************************************/
+
+bool FileGDBOGRGeometryConverterImpl::GetAsISOWKB(const OGRField *psField,
+                                                  std::vector<GByte> &abyWKB)
+{
+    constexpr size_t WKB_HEADER_SIZE = 1 + sizeof(GUInt32);
+    constexpr size_t WKB_XY_SIZE = 2 * sizeof(double);
+
+    GByte *pabyCur = psField->Binary.paData;
+    GByte *pabyEnd = pabyCur + psField->Binary.nCount;
+    GUInt32 nGeomType, nPoints, nParts, nCurves;
+
+    ReadVarUInt32NoCheck(pabyCur, nGeomType);
+
+    // Only 2D geometries without curves are handled here.
+    if ((nGeomType & (EXT_SHAPE_Z_FLAG | EXT_SHAPE_M_FLAG |
+                      EXT_SHAPE_CURVE_FLAG)) != 0)
+        return false;
+
+    switch (nGeomType & 0xff)
+    {
+        case SHPT_POINT:
+        case SHPT_GENERALPOINT:
+        {
+            GUIntBig x, y;
+            ReadVarUInt64NoCheck(pabyCur, x);
+            ReadVarUInt64NoCheck(pabyCur, y);
+
+            const double dfX =
+                CPLUnsanitizedAdd<GUIntBig>(x, -1) / poGeomField->GetXYScale() +
+                poGeomField->GetXOrigin();
+            const double dfY =
+                CPLUnsanitizedAdd<GUIntBig>(y, -1) / poGeomField->GetXYScale() +
+                poGeomField->GetYOrigin();
+
+            abyWKB.resize(WKB_HEADER_SIZE + WKB_XY_SIZE);
+            XYWKBSetter setter(WriteWKBHeader(abyWKB.data(), wkbPoint), 0);
+            setter.set(0, dfX, dfY);
+            return true;
+        }
+
+        case SHPT_MULTIPOINT:
+        {
+            if (!ReadVarUInt32Silent(pabyCur, pabyEnd, nPoints) ||
+                nPoints == 0 || nPoints > (GUInt32)(pabyEnd - pabyCur))
+                return false;
+            if (!SkipVarUInt(pabyCur, pabyEnd, 4))
+                return false;
+
+            constexpr size_t WKB_POINT_SIZE = WKB_HEADER_SIZE + WKB_XY_SIZE;
+            abyWKB.resize(WKB_HEADER_SIZE + sizeof(GUInt32) +
+                          nPoints * WKB_POINT_SIZE);
+            GByte *pabyOut = WriteWKBHeader(abyWKB.data(), wkbMultiPoint);
+            pabyOut = WriteWKBUInt32(pabyOut, nPoints);
+            for (GUInt32 i = 0; i < nPoints; i++)
+            {
+                WriteWKBHeader(pabyOut + i * WKB_POINT_SIZE, wkbPoint);
+            }
+            GIntBig dx = 0;
+            GIntBig dy = 0;
+            XYWKBSetter setter(pabyOut + WKB_HEADER_SIZE, WKB_POINT_SIZE);
+            return CPL_TO_BOOL(ReadXYArray<XYWKBSetter>(
+                setter, pabyCur, pabyEnd, nPoints, dx, dy));
+        }
+
+        case SHPT_ARC:
+        case SHPT_GENERALPOLYLINE:
+        case SHPT_POLYGON:
+        case SHPT_GENERALPOLYGON:
+        {
+            const bool bIsPolygon = (nGeomType & 0xff) == SHPT_POLYGON ||
+                                    (nGeomType & 0xff) == SHPT_GENERALPOLYGON;
+            if (!ReadPartDefs(pabyCur, pabyEnd, nPoints, nParts, nCurves,
+                              false, false) ||
+                nPoints == 0 || nParts == 0)
+                return false;
+            // Polygons with several parts require ring organization.
+            if (bIsPolygon && nParts > 1)
+                return false;
+
+            // Lines and polygons are promoted to MultiLineString and
+            // MultiPolygon, as done by OGROpenFileGDBLayer.
+            size_t nSize = WKB_HEADER_SIZE + sizeof(GUInt32);
+            if (bIsPolygon)
+                nSize += WKB_HEADER_SIZE + sizeof(GUInt32);
+            nSize += nParts * (bIsPolygon ? sizeof(GUInt32)
+                                          : WKB_HEADER_SIZE + sizeof(GUInt32));
+            nSize += static_cast<size_t>(nPoints) * WKB_XY_SIZE;
+            abyWKB.resize(nSize);
+
+            GByte *pabyOut = abyWKB.data();
+            if (bIsPolygon)
+            {
+                pabyOut = WriteWKBHeader(pabyOut, wkbMultiPolygon);
+                pabyOut = WriteWKBUInt32(pabyOut, 1);
+                pabyOut = WriteWKBHeader(pabyOut, wkbPolygon);
+                pabyOut = WriteWKBUInt32(pabyOut, 1);
+            }
+            else
+            {
+                pabyOut = WriteWKBHeader(pabyOut, wkbMultiLineString);
+                pabyOut = WriteWKBUInt32(pabyOut, nParts);
+            }
+
+            GIntBig dx = 0;
+            GIntBig dy = 0;
+            for (GUInt32 i = 0; i < nParts; i++)
+            {
+                if (!bIsPolygon)
+                    pabyOut = WriteWKBHeader(pabyOut, wkbLineString);
+                pabyOut = WriteWKBUInt32(pabyOut, panPointCount[i]);
+                XYWKBSetter setter(pabyOut, WKB_XY_SIZE);
+                if (!ReadXYArray<XYWKBSetter>(setter, pabyCur, pabyEnd,
+                                              panPointCount[i], dx, dy))
+                    return false;
+                pabyOut += static_cast<size_t>(panPointCount[i]) * WKB_XY_SIZE;
+            }
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                           BuildConverter()                           */
 /************************************************************************/
@@ -739,6 +739,13 @@ class FileGDBOGRGeometryConverter
 
     virtual OGRGeometry *GetAsGeometry(const OGRField *psField) = 0;
 
+    // Decode 2D points, multipoints, lines and single-ring polygons without
+    // curves directly as ISO WKB, with lines and polygons promoted to
+    // MultiLineString and MultiPolygon. Returns false for other geometries
+    // or on error, in which case GetAsGeometry() must be used.
+    virtual bool GetAsISOWKB(const OGRField *psField,
+                             std::vector<GByte> &abyWKB) = 0;
+
     static FileGDBOGRGeometryConverter *
     BuildConverter(const FileGDBGeomField *poGeomField);
     static OGRwkbGeometryType
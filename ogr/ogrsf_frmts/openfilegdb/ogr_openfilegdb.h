@@ -139,6 +139,7 @@ class OGROpenFileGDBLayer final : public OGRLayer
     std::unique_ptr<OGRFeatureDefn> m_poFeatureDefnBackup{};
 
     int BuildLayerDefinition();
+    bool CanUseFastArrowStream() const;
     int BuildGeometryColumnGDBv10(const std::string &osParentDefinition);
     OGRFeature *GetCurrentFeature();
 
@@ -252,6 +253,8 @@ class OGROpenFileGDBLayer final : public OGRLayer
     virtual void ResetReading() override;
     virtual OGRFeature *GetNextFeature() override;
     virtual OGRFeature *GetFeature(GIntBig nFeatureId) override;
+    virtual int GetNextArrowArray(struct ArrowArrayStream *,
+                                  struct ArrowArray *out_array) override;
     virtual OGRErr SetNextByIndex(GIntBig nIndex) override;
 
     virtual GIntBig GetFeatureCount(int bForce = TRUE) override;
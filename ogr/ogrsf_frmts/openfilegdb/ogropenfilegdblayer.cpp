@@ -52,6 +52,7 @@
 #include "ogrsf_frmts.h"
 #include "filegdbtable.h"
 #include "ogr_swq.h"
+#include "ograrrowarrayhelper.h"
 
 /************************************************************************/
 /*                      OGROpenFileGDBLayer()                           */
@@ -1626,6 +1627,38 @@ void OGROpenFileGDBLayer::BuildCombinedIterator()
     }
 }
 
+/***********************************************************************/
+/*                       PromoteToMultiGeometry()                      */
+/*                                                                     */
+/*      Lines and polygons are reported as multi geometries.           */
+/***********************************************************************/
+
+static OGRGeometry *PromoteToMultiGeometry(OGRGeometry *poGeom)
+{
+    if (poGeom == nullptr)
+        return nullptr;
+
+    const OGRwkbGeometryType eFlattenType =
+        wkbFlatten(poGeom->getGeometryType());
+    if (eFlattenType == wkbPolygon)
+        poGeom = OGRGeometryFactory::forceToMultiPolygon(poGeom);
+    else if (eFlattenType == wkbCurvePolygon)
+    {
+        OGRMultiSurface *poMS = new OGRMultiSurface();
+        poMS->addGeometryDirectly(poGeom);
+        poGeom = poMS;
+    }
+    else if (eFlattenType == wkbLineString)
+        poGeom = OGRGeometryFactory::forceToMultiLineString(poGeom);
+    else if (eFlattenType == wkbCompoundCurve)
+    {
+        OGRMultiCurve *poMC = new OGRMultiCurve();
+        poMC->addGeometryDirectly(poGeom);
+        poGeom = poMC;
+    }
+    return poGeom;
+}
+
 /***********************************************************************/
 /*                         GetCurrentFeature()                         */
 /***********************************************************************/
@@ -1677,30 +1710,10 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
                     return nullptr;
                 }
 
-                OGRGeometry *poGeom = m_poGeomConverter->GetAsGeometry(psField);
+                OGRGeometry *poGeom = PromoteToMultiGeometry(
+                    m_poGeomConverter->GetAsGeometry(psField));
                 if (poGeom != nullptr)
                 {
-                    OGRwkbGeometryType eFlattenType =
-                        wkbFlatten(poGeom->getGeometryType());
-                    if (eFlattenType == wkbPolygon)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiPolygon(poGeom);
-                    else if (eFlattenType == wkbCurvePolygon)
-                    {
-                        OGRMultiSurface *poMS = new OGRMultiSurface();
-                        poMS->addGeometryDirectly(poGeom);
-                        poGeom = poMS;
-                    }
-                    else if (eFlattenType == wkbLineString)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiLineString(poGeom);
-                    else if (eFlattenType == wkbCompoundCurve)
-                    {
-                        OGRMultiCurve *poMC = new OGRMultiCurve();
-                        poMC->addGeometryDirectly(poGeom);
-                        poGeom = poMC;
-                    }
-
                     poGeom->assignSpatialReference(
                         m_poFeatureDefn->GetGeomFieldDefn(0)->GetSpatialRef());
 
@@ -1862,6 +1875,321 @@ OGRFeature *OGROpenFileGDBLayer::GetNextFeature()
     }
 }
 
+/***********************************************************************/
+/*                       CanUseFastArrowStream()                       */
+/*                                                                     */
+/*      Whether GetNextArrowArray() can use its specialized            */
+/*      implementation, rather than the generic one of OGRLayer.       */
+/***********************************************************************/
+
+bool OGROpenFileGDBLayer::CanUseFastArrowStream() const
+{
+    if (m_poAttrQuery != nullptr ||
+        (m_poFilterGeom != nullptr &&
+         (m_iGeomFieldIdx < 0 ||
+          m_poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())) ||
+        m_poLyrTable->HasDeletedFeaturesListed() ||
+        CPLTestBool(
+            CPLGetConfigOption("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "NO")))
+    {
+        return false;
+    }
+    for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); i++)
+    {
+        const OGRFieldDefn *poFieldDefn = m_poFeatureDefn->GetFieldDefn(i);
+        const OGRFieldSubType eSubType = poFieldDefn->GetSubType();
+        switch (poFieldDefn->GetType())
+        {
+            case OFTInteger:
+                if (eSubType != OFSTNone && eSubType != OFSTInt16)
+                    return false;
+                break;
+            case OFTReal:
+                if (eSubType != OFSTNone && eSubType != OFSTFloat32)
+                    return false;
+                break;
+            case OFTString:
+            case OFTBinary:
+            case OFTDateTime:
+                if (eSubType != OFSTNone)
+                    return false;
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+/***********************************************************************/
+/*                         GetNextArrowArray()                         */
+/***********************************************************************/
+
+int OGROpenFileGDBLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                           struct ArrowArray *out_array)
+{
+    if (!BuildLayerDefinition())
+    {
+        memset(out_array, 0, sizeof(*out_array));
+        return EINVAL;
+    }
+
+    if (!CanUseFastArrowStream())
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    if (m_bEOF)
+    {
+        memset(out_array, 0, sizeof(*out_array));
+        return 0;
+    }
+
+    // The legacy in-memory spatial index is only built by GetNextFeature()
+    if (m_eSpatialIndexState == SPI_IN_BUILDING)
+        m_eSpatialIndexState = SPI_INVALID;
+
+    OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    FileGDBIterator *poIterator = m_poCombinedIterator ? m_poCombinedIterator
+                                  : m_poSpatialIndexIterator
+                                      ? m_poSpatialIndexIterator
+                                      : m_poAttributeIterator;
+
+    const int iGeomArrowField = sHelper.nGeomFieldCount > 0
+                                    ? sHelper.mapOGRGeomFieldToArrowField[0]
+                                    : -1;
+
+    std::vector<GByte> abyWKB;
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    int errorErrno = 0;
+    int iFeat = 0;
+    while (iFeat < sHelper.nMaxBatchSize)
+    {
+        /* -------------------------------------------------------------- */
+        /*      Select the next row, as GetNextFeature() does.            */
+        /* -------------------------------------------------------------- */
+        int iRow = -1;
+        if (m_nFilteredFeatureCount >= 0)
+        {
+            if (m_iCurFeat >= m_nFilteredFeatureCount)
+                break;
+            iRow = static_cast<int>(reinterpret_cast<GUIntptr_t>(
+                m_pahFilteredFeatures[m_iCurFeat++]));
+        }
+        else if (poIterator != nullptr)
+        {
+            iRow = poIterator->GetNextRowSortedByFID();
+            if (iRow < 0)
+                break;
+        }
+        else
+        {
+            if (m_iCurFeat == m_poLyrTable->GetTotalRecordCount())
+                break;
+            m_iCurFeat = m_poLyrTable->GetAndSelectNextNonEmptyRow(m_iCurFeat);
+            if (m_iCurFeat < 0)
+            {
+                m_bEOF = TRUE;
+                break;
+            }
+            iRow = m_iCurFeat;
+            m_iCurFeat++;
+        }
+        if ((m_nFilteredFeatureCount >= 0 || poIterator != nullptr) &&
+            !m_poLyrTable->SelectRow(iRow))
+        {
+            if (m_poLyrTable->HasGotError())
+            {
+                m_bEOF = TRUE;
+                break;
+            }
+            continue;
+        }
+
+        /* -------------------------------------------------------------- */
+        /*      Geometry, and spatial filter evaluation.                  */
+        /* -------------------------------------------------------------- */
+        std::unique_ptr<OGRGeometry> poGeom;
+        bool bHasWKB = false;
+        if (iGeomArrowField >= 0)
+        {
+            const OGRField *psField =
+                m_poLyrTable->GetFieldValue(m_iGeomFieldIdx);
+            if (m_poFilterGeom != nullptr)
+            {
+                if (psField == nullptr ||
+                    (m_eSpatialIndexState != SPI_COMPLETED &&
+                     !m_poLyrTable->DoesGeometryIntersectsFilterEnvelope(
+                         psField)))
+                {
+                    continue;
+                }
+                poGeom.reset(PromoteToMultiGeometry(
+                    m_poGeomConverter->GetAsGeometry(psField)));
+                if (!FilterGeometry(poGeom.get()))
+                    continue;
+            }
+            else if (psField != nullptr)
+            {
+                bHasWKB = m_poGeomConverter->GetAsISOWKB(psField, abyWKB);
+                if (!bHasWKB)
+                {
+                    poGeom.reset(PromoteToMultiGeometry(
+                        m_poGeomConverter->GetAsGeometry(psField)));
+                }
+            }
+
+            if (bHasWKB || poGeom)
+            {
+                const size_t nWKBSize =
+                    bHasWKB ? abyWKB.size() : poGeom->WkbSize();
+                GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                    iGeomArrowField, iFeat, nWKBSize);
+                if (outPtr == nullptr)
+                {
+                    errorErrno = ENOMEM;
+                    break;
+                }
+                if (bHasWKB)
+                    memcpy(outPtr, abyWKB.data(), nWKBSize);
+                else
+                    poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            }
+            else if (!sHelper.SetNull(iGeomArrowField, iFeat))
+            {
+                errorErrno = ENOMEM;
+                break;
+            }
+        }
+
+        if (sHelper.panFIDValues)
+            sHelper.panFIDValues[iFeat] = iRow + 1;
+
+        /* -------------------------------------------------------------- */
+        /*      Attributes.                                               */
+        /* -------------------------------------------------------------- */
+        int iOGRIdx = 0;
+        for (int iGDBIdx = 0; iGDBIdx < m_poLyrTable->GetFieldCount();
+             iGDBIdx++)
+        {
+            if (iGDBIdx == m_iGeomFieldIdx ||
+                iGDBIdx == m_poLyrTable->GetObjectIdFieldIdx())
+            {
+                continue;
+            }
+            const int iArrowField = sHelper.mapOGRFieldToArrowField[iOGRIdx];
+            const OGRFieldDefn *poFieldDefn =
+                m_poFeatureDefn->GetFieldDefn(iOGRIdx);
+            const bool bIsNullable = sHelper.abNullableFields[iOGRIdx];
+            iOGRIdx++;
+            if (iArrowField < 0)
+                continue;
+
+            auto psArray = out_array->children[iArrowField];
+            const OGRField *psField = m_poLyrTable->GetFieldValue(iGDBIdx);
+            if (psField == nullptr)
+            {
+                if (bIsNullable)
+                {
+                    if (!sHelper.SetNull(iArrowField, iFeat))
+                    {
+                        errorErrno = ENOMEM;
+                        break;
+                    }
+                }
+                else if (poFieldDefn->GetType() == OFTString ||
+                         poFieldDefn->GetType() == OFTBinary)
+                {
+                    sHelper.SetEmptyStringOrBinary(psArray, iFeat);
+                }
+                continue;
+            }
+
+            switch (poFieldDefn->GetType())
+            {
+                case OFTInteger:
+                    if (poFieldDefn->GetSubType() == OFSTInt16)
+                        sHelper.SetInt16(
+                            psArray, iFeat,
+                            static_cast<int16_t>(psField->Integer));
+                    else
+                        sHelper.SetInt32(psArray, iFeat, psField->Integer);
+                    break;
+
+                case OFTReal:
+                    if (poFieldDefn->GetSubType() == OFSTFloat32)
+                        sHelper.SetFloat(psArray, iFeat,
+                                         static_cast<float>(psField->Real));
+                    else
+                        sHelper.SetDouble(psArray, iFeat, psField->Real);
+                    break;
+
+                case OFTString:
+                case OFTBinary:
+                {
+                    const GByte *pabyData = nullptr;
+                    size_t nLen = 0;
+                    if (poFieldDefn->GetType() == OFTBinary)
+                    {
+                        pabyData = psField->Binary.paData;
+                        nLen = psField->Binary.nCount;
+                    }
+                    else
+                    {
+                        const char *pszStr =
+                            iGDBIdx == m_iFieldToReadAsBinary
+                                ? reinterpret_cast<const char *>(
+                                      psField->Binary.paData)
+                                : psField->String;
+                        pabyData = reinterpret_cast<const GByte *>(pszStr);
+                        nLen = strlen(pszStr);
+                    }
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if (outPtr == nullptr)
+                    {
+                        errorErrno = ENOMEM;
+                        break;
+                    }
+                    memcpy(outPtr, pabyData, nLen);
+                    break;
+                }
+
+                case OFTDateTime:
+                    sHelper.SetDateTime(psArray, iFeat, brokenDown, *psField);
+                    break;
+
+                default:
+                    CPLAssert(false);
+                    break;
+            }
+            if (errorErrno != 0)
+                break;
+        }
+        if (errorErrno != 0)
+            break;
+
+        iFeat++;
+    }
+
+    if (errorErrno != 0 || iFeat == 0)
+    {
+        sHelper.ClearArray();
+        return errorErrno;
+    }
+
+    sHelper.Shrink(iFeat);
+    return 0;
+}
+
 /***********************************************************************/
 /*                          GetFeature()                               */
 /***********************************************************************/
@@ -2165,6 +2493,11 @@ int OGROpenFileGDBLayer::TestCapability(const char *pszCap)
                m_poLyrTable->HasSpatialIndex();
     }
 
+    else if (EQUAL(pszCap, OLCFastGetArrowStream))
+    {
+        return CanUseFastArrowStream();
+    }
+
     return FALSE;
 }
 
@@ -242,6 +242,10 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
     IsSupportedGeometryType(OGRwkbGeometryType eGType) const override;
 
     virtual void FixupGeometryBeforeWriting(OGRGeometry *poGeom) override;
+    virtual bool IsFixupGeometryBeforeWritingNeeded() const override
+    {
+        return m_bForceCounterClockwiseOrientation;
+    }
     virtual bool IsSRSRequired() const override
     {
         return false;
@@ -56,6 +56,12 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding);
 OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape);
+bool SHPReadOGRObjectAsWKB(SHPHandle hSHP, int iShape, SHPObject *psShape,
+                           OGRwkbGeometryType eLayerGeomType,
+                           std::vector<GByte> &abyWKB);
+void SHPAdjustOGRGeometryDimension(OGRGeometry *poGeometry,
+                                   OGRwkbGeometryType eLayerGeomType);
+void SHPParseOGRDate(const char *pszDateValue, OGRField *psField);
 OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
                                       DBFHandle hDBF,
                                       const char *pszSHPEncoding,
@@ -134,6 +140,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     int ResetGeomType(int nNewType);
 
     bool ScanIndices();
+    bool CanUseFastArrowStream() const;
 
     GIntBig *panMatchingFIDs;
     int iMatchingFID;
@@ -236,6 +243,9 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     OGRFeature *GetNextFeature() override;
     OGRErr SetNextByIndex(GIntBig nIndex) override;
 
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
+
     OGRFeature *GetFeature(GIntBig nFeatureId) override;
     OGRErr ISetFeature(OGRFeature *poFeature) override;
     OGRErr DeleteFeature(GIntBig nFID) override;
@@ -52,6 +52,7 @@
 #include "ogr_p.h"
 #include "ogr_spatialref.h"
 #include "ogr_srs_api.h"
+#include "ograrrowarrayhelper.h"
 #include "ogrlayerpool.h"
 #include "ogrsf_frmts.h"
 #include "shapefil.h"
@@ -1020,6 +1021,342 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                       CanUseFastArrowStream()                        */
+/*                                                                      */
+/*      Whether GetNextArrowArray() can use its specialized             */
+/*      implementation, rather than the generic one of OGRLayer.        */
+/************************************************************************/
+
+bool OGRShapeLayer::CanUseFastArrowStream() const
+{
+    if (m_poAttrQuery != nullptr ||
+        (m_poFilterGeom != nullptr &&
+         (hSHP == nullptr || poFeatureDefn->IsGeometryIgnored())) ||
+        CPLTestBool(CPLGetConfigOption("OGR_SHAPE_STREAM_BASE_IMPL", "NO")))
+    {
+        return false;
+    }
+    for (int i = 0; i < poFeatureDefn->GetFieldCount(); i++)
+    {
+        const OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        const OGRFieldType eType = poFieldDefn->GetType();
+        if (poFieldDefn->GetSubType() != OFSTNone ||
+            (eType != OFTString && eType != OFTInteger &&
+             eType != OFTInteger64 && eType != OFTReal && eType != OFTDate))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/*                                                                      */
+/*      Decode DBF records directly into the Arrow buffers, and         */
+/*      shapes directly into WKB, without going through OGRFeature.    */
+/************************************************************************/
+
+int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                     struct ArrowArray *out_array)
+{
+    if (!TouchLayer())
+    {
+        memset(out_array, 0, sizeof(*out_array));
+        return EIO;
+    }
+
+    if (!CanUseFastArrowStream())
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    if (m_poFilterGeom != nullptr && iNextShapeId == 0 &&
+        panMatchingFIDs == nullptr)
+    {
+        ScanIndices();
+    }
+
+    OGRArrowArrayHelper sHelper(poDS, poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    const int iGeomArrowField =
+        sHelper.nGeomFieldCount > 0 ? sHelper.mapOGRGeomFieldToArrowField[0]
+                                    : -1;
+    const OGRwkbGeometryType eLayerGeomType = poFeatureDefn->GetGeomType();
+
+    std::vector<GByte> abyWKB;
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    int errorErrno = 0;
+    int iFeat = 0;
+    while (iFeat < sHelper.nMaxBatchSize)
+    {
+        /* -------------------------------------------------------------- */
+        /*      Select the next candidate shape, as GetNextFeature().     */
+        /* -------------------------------------------------------------- */
+        int iShape = 0;
+        if (panMatchingFIDs != nullptr)
+        {
+            if (panMatchingFIDs[iMatchingFID] == OGRNullFID)
+                break;
+            iShape = static_cast<int>(panMatchingFIDs[iMatchingFID]);
+            iMatchingFID++;
+            if (iShape < 0 || (hSHP != nullptr && iShape >= hSHP->nRecords) ||
+                (hDBF != nullptr && iShape >= hDBF->nRecords) ||
+                (hDBF != nullptr && DBFIsRecordDeleted(hDBF, iShape)))
+            {
+                continue;
+            }
+        }
+        else
+        {
+            if (iNextShapeId >= nTotalShapeCount)
+                break;
+            iShape = iNextShapeId;
+            if (hDBF != nullptr)
+            {
+                if (DBFIsRecordDeleted(hDBF, iShape))
+                {
+                    iNextShapeId++;
+                    continue;
+                }
+                if (VSIFEofL(VSI_SHP_GetVSIL(hDBF->fp)))
+                    break;  // I/O error.
+            }
+            iNextShapeId++;
+        }
+
+        /* -------------------------------------------------------------- */
+        /*      Apply the spatial filter. The shape bounding box is       */
+        /*      enough to accept or reject most shapes, so that the       */
+        /*      OGRGeometry is only built for the remaining ones.         */
+        /* -------------------------------------------------------------- */
+        SHPObject *psShape = nullptr;
+        std::unique_ptr<OGRGeometry> poGeom;
+        if (m_poFilterGeom != nullptr)
+        {
+            psShape = SHPReadObject(hSHP, iShape);
+            if (psShape == nullptr || psShape->nVertices == 0 ||
+                psShape->nSHPType == SHPT_NULL)
+            {
+                // Null or empty geometries never match a spatial filter.
+                if (psShape != nullptr)
+                    SHPDestroyObject(psShape);
+                m_nFeaturesRead++;
+                continue;
+            }
+
+            OGREnvelope sShapeEnv;
+            for (int i = 0; i < psShape->nVertices; i++)
+            {
+                sShapeEnv.Merge(psShape->padfX[i], psShape->padfY[i]);
+            }
+            if (m_sFilterEnvelope.MaxX < sShapeEnv.MinX ||
+                m_sFilterEnvelope.MaxY < sShapeEnv.MinY ||
+                sShapeEnv.MaxX < m_sFilterEnvelope.MinX ||
+                sShapeEnv.MaxY < m_sFilterEnvelope.MinY)
+            {
+                SHPDestroyObject(psShape);
+                continue;
+            }
+
+            m_nFeaturesRead++;
+
+            const bool bNonNullGeom = psShape->nParts > 0 ||
+                                      psShape->nSHPType == SHPT_POINT ||
+                                      psShape->nSHPType == SHPT_POINTZ ||
+                                      psShape->nSHPType == SHPT_POINTM ||
+                                      psShape->nSHPType == SHPT_MULTIPOINT ||
+                                      psShape->nSHPType == SHPT_MULTIPOINTZ ||
+                                      psShape->nSHPType == SHPT_MULTIPOINTM;
+            if (!(bNonNullGeom && m_bFilterIsEnvelope &&
+                  m_sFilterEnvelope.Contains(sShapeEnv)))
+            {
+                poGeom.reset(SHPReadOGRObject(hSHP, iShape, psShape));
+                psShape = nullptr;
+                if (!FilterGeometry(poGeom.get()))
+                    continue;
+                SHPAdjustOGRGeometryDimension(poGeom.get(), eLayerGeomType);
+            }
+        }
+        else
+        {
+            m_nFeaturesRead++;
+        }
+
+        if (sHelper.panFIDValues)
+            sHelper.panFIDValues[iFeat] = iShape;
+
+        /* -------------------------------------------------------------- */
+        /*      Geometry.                                                 */
+        /* -------------------------------------------------------------- */
+        if (iGeomArrowField >= 0 && hSHP != nullptr)
+        {
+            bool bHasGeom = false;
+            const GByte *pabyWKB = nullptr;
+            size_t nWKBSize = 0;
+            if (poGeom)
+            {
+                bHasGeom = true;
+                nWKBSize = poGeom->WkbSize();
+            }
+            else if (SHPReadOGRObjectAsWKB(hSHP, iShape, psShape,
+                                           eLayerGeomType, abyWKB))
+            {
+                bHasGeom = true;
+                pabyWKB = abyWKB.data();
+                nWKBSize = abyWKB.size();
+            }
+            psShape = nullptr;
+
+            if (bHasGeom)
+            {
+                GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                    iGeomArrowField, iFeat, nWKBSize);
+                if (outPtr == nullptr)
+                {
+                    errorErrno = ENOMEM;
+                    break;
+                }
+                if (pabyWKB)
+                    memcpy(outPtr, pabyWKB, nWKBSize);
+                else
+                    poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            }
+            else if (!sHelper.SetNull(iGeomArrowField, iFeat))
+            {
+                errorErrno = ENOMEM;
+                break;
+            }
+        }
+        else if (psShape != nullptr)
+        {
+            SHPDestroyObject(psShape);
+        }
+
+        /* -------------------------------------------------------------- */
+        /*      Attributes.                                               */
+        /* -------------------------------------------------------------- */
+        for (int iField = 0; hDBF != nullptr && iField < sHelper.nFieldCount;
+             iField++)
+        {
+            const int iArrowField = sHelper.mapOGRFieldToArrowField[iField];
+            if (iArrowField < 0)
+                continue;
+            auto psArray = out_array->children[iArrowField];
+            const OGRFieldType eType =
+                poFeatureDefn->GetFieldDefn(iField)->GetType();
+
+            bool bIsNull =
+                eType != OFTString && DBFIsAttributeNULL(hDBF, iShape, iField);
+            const char *pszFieldVal =
+                bIsNull ? nullptr
+                        : DBFReadStringAttribute(hDBF, iShape, iField);
+            // Empty strings, and dates filled with spaces (#4265), are
+            // read as null.
+            if (pszFieldVal == nullptr || pszFieldVal[0] == '\0')
+                bIsNull = true;
+
+            if (bIsNull)
+            {
+                if (sHelper.abNullableFields[iField])
+                {
+                    if (!sHelper.SetNull(iArrowField, iFeat))
+                    {
+                        errorErrno = ENOMEM;
+                        break;
+                    }
+                }
+                else if (eType == OFTString)
+                {
+                    sHelper.SetEmptyStringOrBinary(psArray, iFeat);
+                }
+                continue;
+            }
+
+            switch (eType)
+            {
+                case OFTString:
+                {
+                    char *pszUTF8Field = nullptr;
+                    if (!osEncoding.empty())
+                    {
+                        pszUTF8Field = CPLRecode(
+                            pszFieldVal, osEncoding.c_str(), CPL_ENC_UTF8);
+                        pszFieldVal = pszUTF8Field;
+                    }
+                    const size_t nLen = strlen(pszFieldVal);
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if (outPtr == nullptr)
+                        errorErrno = ENOMEM;
+                    else
+                        memcpy(outPtr, pszFieldVal, nLen);
+                    CPLFree(pszUTF8Field);
+                    break;
+                }
+
+                case OFTInteger:
+                {
+                    const long long nVal64 =
+                        std::strtoll(pszFieldVal, nullptr, 10);
+                    const int nVal32 = nVal64 > INT_MAX   ? INT_MAX
+                                       : nVal64 < INT_MIN ? INT_MIN
+                                                          : static_cast<int>(
+                                                                nVal64);
+                    sHelper.SetInt32(psArray, iFeat, nVal32);
+                    break;
+                }
+
+                case OFTInteger64:
+                    sHelper.SetInt64(psArray, iFeat,
+                                     CPLAtoGIntBigEx(pszFieldVal, false,
+                                                     nullptr));
+                    break;
+
+                case OFTReal:
+                    sHelper.SetDouble(psArray, iFeat,
+                                      CPLStrtod(pszFieldVal, nullptr));
+                    break;
+
+                case OFTDate:
+                {
+                    OGRField sFld;
+                    SHPParseOGRDate(pszFieldVal, &sFld);
+                    sHelper.SetDate(psArray, iFeat, brokenDown, sFld);
+                    break;
+                }
+
+                default:
+                    CPLAssert(false);
+                    break;
+            }
+            if (errorErrno != 0)
+                break;
+        }
+        if (errorErrno != 0)
+            break;
+
+        iFeat++;
+    }
+
+    if (errorErrno != 0 || iFeat == 0)
+    {
+        sHelper.ClearArray();
+        return errorErrno;
+    }
+
+    sHelper.Shrink(iFeat);
+    return 0;
+}
+
 /************************************************************************/
 /*                             GetFeature()                             */
 /************************************************************************/
@@ -1742,6 +2079,9 @@ int OGRShapeLayer::TestCapability(const char *pszCap)
     if (EQUAL(pszCap, OLCFastGetExtent))
         return TRUE;
 
+    if (EQUAL(pszCap, OLCFastGetArrowStream))
+        return CanUseFastArrowStream();
+
     if (EQUAL(pszCap, OLCFastSetNextByIndex))
         return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr;
 
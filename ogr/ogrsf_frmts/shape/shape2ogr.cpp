@@ -53,7 +53,8 @@
 /*                        RingStartEnd                                  */
 /*        Set first and last vertex for given ring.                     */
 /************************************************************************/
-static void RingStartEnd(SHPObject *psShape, int ring, int *start, int *end)
+static void RingStartEnd(const SHPObject *psShape, int ring, int *start,
+                         int *end)
 {
     if (psShape->panPartStart == nullptr)
     {
@@ -1217,6 +1218,299 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
     return poDefn;
 }
 
+/************************************************************************/
+/*                   SHPAdjustOGRGeometryDimension()                    */
+/*                                                                      */
+/*      Set or unset the Z and M flags of a geometry read from a        */
+/*      shape so that they match the layer geometry type.               */
+/************************************************************************/
+
+void SHPAdjustOGRGeometryDimension(OGRGeometry *poGeometry,
+                                   OGRwkbGeometryType eLayerGeomType)
+{
+    if (eLayerGeomType == wkbUnknown)
+        return;
+
+    const OGRwkbGeometryType eGeomInType = poGeometry->getGeometryType();
+    if (wkbHasZ(eLayerGeomType) && !wkbHasZ(eGeomInType))
+    {
+        poGeometry->set3D(TRUE);
+    }
+    else if (!wkbHasZ(eLayerGeomType) && wkbHasZ(eGeomInType))
+    {
+        poGeometry->set3D(FALSE);
+    }
+    if (wkbHasM(eLayerGeomType) && !wkbHasM(eGeomInType))
+    {
+        poGeometry->setMeasured(TRUE);
+    }
+    else if (!wkbHasM(eLayerGeomType) && wkbHasM(eGeomInType))
+    {
+        poGeometry->setMeasured(FALSE);
+    }
+}
+
+/************************************************************************/
+/*                          SHPGetWKBSize2D()                           */
+/*                                                                      */
+/*      Compute the size of the ISO WKB encoding of a 2D shape that     */
+/*      can be written directly from the shapelib vertex arrays.        */
+/*      Returns false if the shape must go through SHPReadOGRObject().  */
+/*      *pnSize is set to 0 if the shape maps to a null geometry.      */
+/************************************************************************/
+
+static bool SHPGetWKBSize2D(const SHPObject *psShape, size_t *pnSize)
+{
+    constexpr size_t WKB_HEADER_SIZE = 1 + sizeof(uint32_t);
+    constexpr size_t WKB_XY_SIZE = 2 * sizeof(double);
+
+    *pnSize = 0;
+    switch (psShape->nSHPType)
+    {
+        case SHPT_POINT:
+            *pnSize = WKB_HEADER_SIZE + WKB_XY_SIZE;
+            return true;
+
+        case SHPT_MULTIPOINT:
+            if (psShape->nVertices > 0)
+            {
+                *pnSize = WKB_HEADER_SIZE + sizeof(uint32_t) +
+                          static_cast<size_t>(psShape->nVertices) *
+                              (WKB_HEADER_SIZE + WKB_XY_SIZE);
+            }
+            return true;
+
+        case SHPT_ARC:
+        {
+            if (psShape->nParts == 0)
+                return true;
+            if (psShape->nParts == 1)
+            {
+                *pnSize = WKB_HEADER_SIZE + sizeof(uint32_t) +
+                          static_cast<size_t>(psShape->nVertices) * WKB_XY_SIZE;
+                return true;
+            }
+            size_t nSize = WKB_HEADER_SIZE + sizeof(uint32_t);
+            for (int iPart = 0; iPart < psShape->nParts; iPart++)
+            {
+                int nStart = 0;
+                int nEnd = 0;
+                RingStartEnd(psShape, iPart, &nStart, &nEnd);
+                if (nEnd + 1 < nStart)
+                    return false;
+                nSize += WKB_HEADER_SIZE + sizeof(uint32_t) +
+                         static_cast<size_t>(nEnd + 1 - nStart) * WKB_XY_SIZE;
+            }
+            *pnSize = nSize;
+            return true;
+        }
+
+        case SHPT_POLYGON:
+        {
+            if (psShape->nParts == 0)
+                return true;
+            // Multi-part polygons require ring organization.
+            if (psShape->nParts > 1)
+                return false;
+            int nStart = 0;
+            int nEnd = 0;
+            RingStartEnd(psShape, 0, &nStart, &nEnd);
+            if (nEnd < nStart)
+                return false;
+            *pnSize = WKB_HEADER_SIZE + 2 * sizeof(uint32_t) +
+                      static_cast<size_t>(nEnd + 1 - nStart) * WKB_XY_SIZE;
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                         SHPWriteWKBHelpers                           */
+/************************************************************************/
+
+static GByte *SHPWriteWKBUInt32(GByte *pabyOut, uint32_t nVal)
+{
+    CPL_LSBPTR32(&nVal);
+    memcpy(pabyOut, &nVal, sizeof(nVal));
+    return pabyOut + sizeof(nVal);
+}
+
+static GByte *SHPWriteWKBHeader(GByte *pabyOut, OGRwkbGeometryType eType)
+{
+    *pabyOut = static_cast<GByte>(wkbNDR);
+    return SHPWriteWKBUInt32(pabyOut + 1, static_cast<uint32_t>(eType));
+}
+
+static GByte *SHPWriteWKBXY(GByte *pabyOut, const double *padfX,
+                            const double *padfY, int nPoints)
+{
+    for (int i = 0; i < nPoints; i++)
+    {
+        double dfX = padfX[i];
+        double dfY = padfY[i];
+        CPL_LSBPTR64(&dfX);
+        CPL_LSBPTR64(&dfY);
+        memcpy(pabyOut, &dfX, sizeof(double));
+        memcpy(pabyOut + sizeof(double), &dfY, sizeof(double));
+        pabyOut += 2 * sizeof(double);
+    }
+    return pabyOut;
+}
+
+static GByte *SHPWriteWKBLineString(GByte *pabyOut, const SHPObject *psShape,
+                                    int nStart, int nPoints)
+{
+    pabyOut = SHPWriteWKBHeader(pabyOut, wkbLineString);
+    pabyOut = SHPWriteWKBUInt32(pabyOut, static_cast<uint32_t>(nPoints));
+    return SHPWriteWKBXY(pabyOut, psShape->padfX + nStart,
+                         psShape->padfY + nStart, nPoints);
+}
+
+/************************************************************************/
+/*                            SHPWriteWKB2D()                           */
+/*                                                                      */
+/*      Write the ISO WKB encoding of a shape for which                 */
+/*      SHPGetWKBSize2D() returned a non-zero size.                     */
+/************************************************************************/
+
+static void SHPWriteWKB2D(const SHPObject *psShape, GByte *pabyOut)
+{
+    switch (psShape->nSHPType)
+    {
+        case SHPT_POINT:
+            pabyOut = SHPWriteWKBHeader(pabyOut, wkbPoint);
+            SHPWriteWKBXY(pabyOut, psShape->padfX, psShape->padfY, 1);
+            break;
+
+        case SHPT_MULTIPOINT:
+            pabyOut = SHPWriteWKBHeader(pabyOut, wkbMultiPoint);
+            pabyOut = SHPWriteWKBUInt32(
+                pabyOut, static_cast<uint32_t>(psShape->nVertices));
+            for (int i = 0; i < psShape->nVertices; i++)
+            {
+                pabyOut = SHPWriteWKBHeader(pabyOut, wkbPoint);
+                pabyOut = SHPWriteWKBXY(pabyOut, psShape->padfX + i,
+                                        psShape->padfY + i, 1);
+            }
+            break;
+
+        case SHPT_ARC:
+            if (psShape->nParts == 1)
+            {
+                SHPWriteWKBLineString(pabyOut, psShape, 0, psShape->nVertices);
+            }
+            else
+            {
+                pabyOut = SHPWriteWKBHeader(pabyOut, wkbMultiLineString);
+                pabyOut = SHPWriteWKBUInt32(
+                    pabyOut, static_cast<uint32_t>(psShape->nParts));
+                for (int iPart = 0; iPart < psShape->nParts; iPart++)
+                {
+                    int nStart = 0;
+                    int nEnd = 0;
+                    RingStartEnd(psShape, iPart, &nStart, &nEnd);
+                    pabyOut = SHPWriteWKBLineString(pabyOut, psShape, nStart,
+                                                    nEnd + 1 - nStart);
+                }
+            }
+            break;
+
+        case SHPT_POLYGON:
+        {
+            int nStart = 0;
+            int nEnd = 0;
+            RingStartEnd(psShape, 0, &nStart, &nEnd);
+            const int nPoints = nEnd + 1 - nStart;
+            pabyOut = SHPWriteWKBHeader(pabyOut, wkbPolygon);
+            pabyOut = SHPWriteWKBUInt32(pabyOut, 1);
+            pabyOut =
+                SHPWriteWKBUInt32(pabyOut, static_cast<uint32_t>(nPoints));
+            SHPWriteWKBXY(pabyOut, psShape->padfX + nStart,
+                          psShape->padfY + nStart, nPoints);
+            break;
+        }
+
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                       SHPReadOGRObjectAsWKB()                        */
+/*                                                                      */
+/*      Read a shape and translate it to ISO WKB, with the same         */
+/*      result as SHPReadOGRObject() followed by exportToWkb(). 2D      */
+/*      points, multipoints, lines and single-ring polygons are         */
+/*      encoded directly from the shape vertices. Takes ownership of    */
+/*      psShape. Returns false if the shape maps to a null geometry.    */
+/************************************************************************/
+
+bool SHPReadOGRObjectAsWKB(SHPHandle hSHP, int iShape, SHPObject *psShape,
+                           OGRwkbGeometryType eLayerGeomType,
+                           std::vector<GByte> &abyWKB)
+{
+    if (psShape == nullptr)
+        psShape = SHPReadObject(hSHP, iShape);
+
+    if (psShape == nullptr)
+        return false;
+
+    size_t nWKBSize = 0;
+    if (!wkbHasZ(eLayerGeomType) && !wkbHasM(eLayerGeomType) &&
+        SHPGetWKBSize2D(psShape, &nWKBSize))
+    {
+        if (nWKBSize != 0)
+        {
+            abyWKB.resize(nWKBSize);
+            SHPWriteWKB2D(psShape, abyWKB.data());
+        }
+        SHPDestroyObject(psShape);
+        return nWKBSize != 0;
+    }
+
+    std::unique_ptr<OGRGeometry> poGeometry(
+        SHPReadOGRObject(hSHP, iShape, psShape));
+    if (poGeometry == nullptr)
+        return false;
+
+    SHPAdjustOGRGeometryDimension(poGeometry.get(), eLayerGeomType);
+    abyWKB.resize(poGeometry->WkbSize());
+    poGeometry->exportToWkb(wkbNDR, abyWKB.data(), wkbVariantIso);
+    return true;
+}
+
+/************************************************************************/
+/*                          SHPParseOGRDate()                           */
+/*                                                                      */
+/*      Parse a DBF date value, either in the YYYYMMDD form or in the   */
+/*      MM/DD/YYYY form written by some software.                       */
+/************************************************************************/
+
+void SHPParseOGRDate(const char *pszDateValue, OGRField *psField)
+{
+    memset(psField, 0, sizeof(*psField));
+
+    if (strlen(pszDateValue) >= 10 && pszDateValue[2] == '/' &&
+        pszDateValue[5] == '/')
+    {
+        psField->Date.Month = static_cast<GByte>(atoi(pszDateValue + 0));
+        psField->Date.Day = static_cast<GByte>(atoi(pszDateValue + 3));
+        psField->Date.Year = static_cast<GInt16>(atoi(pszDateValue + 6));
+    }
+    else
+    {
+        const int nFullDate = atoi(pszDateValue);
+        psField->Date.Year = static_cast<GInt16>(nFullDate / 10000);
+        psField->Date.Month = static_cast<GByte>((nFullDate / 100) % 100);
+        psField->Date.Day = static_cast<GByte>(nFullDate % 100);
+    }
+}
+
 /************************************************************************/
 /*                         SHPReadOGRFeature()                          */
 /************************************************************************/
@@ -1269,30 +1563,9 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
             if (poGeometry)
             {
                 // Set/unset flags.
-                const OGRwkbGeometryType eMyGeomType =
-                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType();
-
-                if (eMyGeomType != wkbUnknown)
-                {
-                    OGRwkbGeometryType eGeomInType =
-                        poGeometry->getGeometryType();
-                    if (wkbHasZ(eMyGeomType) && !wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(TRUE);
-                    }
-                    else if (!wkbHasZ(eMyGeomType) && wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(FALSE);
-                    }
-                    if (wkbHasM(eMyGeomType) && !wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(TRUE);
-                    }
-                    else if (!wkbHasM(eMyGeomType) && wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(FALSE);
-                    }
-                }
+                SHPAdjustOGRGeometryDimension(
+                    poGeometry,
+                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType());
             }
 
             poFeature->SetGeometryDirectly(poGeometry);
@@ -1371,25 +1644,7 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                     continue;
 
                 OGRField sFld;
-                memset(&sFld, 0, sizeof(sFld));
-
-                if (strlen(pszDateValue) >= 10 && pszDateValue[2] == '/' &&
-                    pszDateValue[5] == '/')
-                {
-                    sFld.Date.Month =
-                        static_cast<GByte>(atoi(pszDateValue + 0));
-                    sFld.Date.Day = static_cast<GByte>(atoi(pszDateValue + 3));
-                    sFld.Date.Year =
-                        static_cast<GInt16>(atoi(pszDateValue + 6));
-                }
-                else
-                {
-                    const int nFullDate = atoi(pszDateValue);
-                    sFld.Date.Year = static_cast<GInt16>(nFullDate / 10000);
-                    sFld.Date.Month =
-                        static_cast<GByte>((nFullDate / 100) % 100);
-                    sFld.Date.Day = static_cast<GByte>(nFullDate % 100);
-                }
+                SHPParseOGRDate(pszDateValue, &sFld);
 
                 poFeature->SetField(iField, &sFld);
             }
@@ -0,0 +1,59 @@
+# SPDX-License-Identifier: MIT
+
+# Measure the decoding speed of GRIB2 simple and complex packing, for
+# several bit widths.
+
+import array
+import math
+import timeit
+
+from osgeo import gdal
+
+XSIZE = 2000
+YSIZE = 1000
+
+src_ds = gdal.GetDriverByName("MEM").Create("", XSIZE, YSIZE, 1, gdal.GDT_Float32)
+src_ds.GetRasterBand(1).WriteRaster(
+    0,
+    0,
+    XSIZE,
+    YSIZE,
+    array.array(
+        "f",
+        [1000 * math.sin(i * 0.001) + (i * 7919) % 101 for i in range(XSIZE * YSIZE)],
+    ).tobytes(),
+)
+
+filenames = {}
+for encoding in ("SIMPLE_PACKING", "COMPLEX_PACKING"):
+    for nbits in (8, 12, 16, 24):
+        filename = "/vsimem/grib_unpack_%s_%d.grb2" % (encoding, nbits)
+        options = ["DATA_ENCODING=" + encoding, "NBITS=%d" % nbits]
+        if encoding == "COMPLEX_PACKING":
+            options.append("SPATIAL_DIFFERENCING_ORDER=0")
+        gdal.GetDriverByName("GRIB").CreateCopy(filename, src_ds, options=options)
+        filenames[(encoding, nbits)] = filename
+
+
+def test(encoding, nbits):
+    ds = gdal.Open(filenames[(encoding, nbits)])
+    ds.GetRasterBand(1).ReadRaster()
+
+
+NITERS = 20
+setup = "from __main__ import test"
+for encoding in ("SIMPLE_PACKING", "COMPLEX_PACKING"):
+    for nbits in (8, 12, 16, 24):
+        print(
+            "%s, NBITS=%d: %.3f"
+            % (
+                encoding,
+                nbits,
+                timeit.timeit(
+                    "test('%s', %d)" % (encoding, nbits), setup=setup, number=NITERS
+                ),
+            )
+        )
+
+for filename in filenames.values():
+    gdal.Unlink(filename)
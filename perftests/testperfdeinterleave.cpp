@@ -2,7 +2,7 @@
  * $Id$
  *
  * Project:  GDAL Core
- * Purpose:  Test performance of GDALDeinterleave().
+ * Purpose:  Test performance of GDALDeinterleave() and GDALSwapWords().
  * Author:   Even Rouault, <even dot rouault at spatialys.com>
  *
  ******************************************************************************
@@ -94,6 +94,17 @@ int main(int /* argc */, char * /* argv */[])
             printf("GDALDeinterleave UInt16 4 : %.2f\n",
                    (end - start) * 1.0 / CLOCKS_PER_SEC);
         }
+
+        for (int nWordSize = 2; nWordSize <= 8; nWordSize *= 2)
+        {
+            const auto start = clock();
+            for (int i = 0; i < 2000 * (1024 / SIZE) * (1024 / SIZE); ++i)
+                GDALSwapWordsEx(src, nWordSize, SIZE * SIZE * 4 / nWordSize,
+                                nWordSize);
+            const auto end = clock();
+            printf("GDALSwapWords %d : %.2f\n", nWordSize,
+                   (end - start) * 1.0 / CLOCKS_PER_SEC);
+        }
     }
     CPLSetConfigOption("GDAL_USE_SSSE3", nullptr);
 
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <array>
+#include <limits>
 #include <set>
 #include <map>
 #include <memory>
@@ -47,6 +48,7 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
 #include "cpl_mem_cache.h"
+#include "cpl_sha256.h"
 
 #ifndef S_IRUSR
 #define S_IRUSR 00400
@@ -195,6 +197,346 @@ static int GetMaxRegions()
     return N_MAX_REGIONS_DO_NOT_USE_DIRECTLY;
 }
 
+/************************************************************************/
+/* ==================================================================== */
+/*                       Persistent region cache                        */
+/* ==================================================================== */
+/************************************************************************/
+
+// When CPL_VSIL_CURL_PERSISTENT_CACHE_DIR is set, downloaded regions are
+// also stored in that directory, one file per chunk, so that they can be
+// reused by later processes. Entries are identified by the SHA-256 hash of
+// a key made of the URL (without its signing query parameters), a validator
+// of the remote file content (ETag, or size and modification time) and the
+// chunk size, so a modified remote file results in new entries. Only that
+// hash is stored, so that signed URLs do not end up on disk. Entries are
+// spread among 256 sub-directories to keep directories reasonably small.
+// Files are written in a temporary file and then renamed, so concurrent
+// processes never see partial entries. Each hit updates the last access
+// time stored in the entry, and thus the modification time of the file,
+// which is used for least-recently-used eviction when the total size
+// exceeds CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE.
+
+constexpr char PERSISTENT_CACHE_MAGIC[] = "GDALVCC2";
+constexpr size_t PERSISTENT_CACHE_MAGIC_SIZE = 8;
+constexpr const char *PERSISTENT_CACHE_EXT = ".gdalvcc";
+// Age after which a temporary file is considered to have been left behind
+// by a crashed writer.
+constexpr int PERSISTENT_CACHE_STALE_TMP_DELAY = 3600;
+
+static std::mutex goPersistentCacheMutex;
+static GIntBig gnPersistentCacheBytesWrittenSinceLastScan = -1;
+
+/************************************************************************/
+/*                   VSICurlPersistentCacheGetDir()                     */
+/************************************************************************/
+
+static std::string VSICurlPersistentCacheGetDir()
+{
+    return CPLGetConfigOption("CPL_VSIL_CURL_PERSISTENT_CACHE_DIR", "");
+}
+
+/************************************************************************/
+/*                VSICurlPersistentCacheStripURL()                      */
+/************************************************************************/
+
+// Remove the query parameters of pre-signed URLs (AWS S3, Google Cloud
+// Storage, Azure SAS) that change when the signature is renewed, so that
+// entries survive token rotation. The content of the file is identified
+// by its ETag or size and modification time anyway.
+static std::string VSICurlPersistentCacheStripURL(const char *pszURL)
+{
+    const char *pszQuery = strchr(pszURL, '?');
+    if (pszQuery == nullptr)
+        return pszURL;
+
+    static const char *const apszVolatileParams[] = {
+        "X-Amz-Algorithm",      "X-Amz-Credential",    "X-Amz-Date",
+        "X-Amz-Expires",        "X-Amz-SignedHeaders", "X-Amz-Signature",
+        "X-Amz-Security-Token", "AWSAccessKeyId",      "Signature",
+        "Expires",              "X-Goog-Algorithm",    "X-Goog-Credential",
+        "X-Goog-Date",          "X-Goog-Expires",      "X-Goog-SignedHeaders",
+        "X-Goog-Signature",     "GoogleAccessId"};
+    // Azure shared access signature parameters have short names that could
+    // be used for other purposes, so they are only removed when the
+    // signature itself is present.
+    static const char *const apszAzureSASParams[] = {
+        "sv", "ss", "srt", "sp", "se", "st", "spr", "sig", "skoid",
+        "sktid", "skt", "ske", "sks", "skv", "sr", "si", "sdd"};
+
+    std::string osURL(pszURL, pszQuery - pszURL);
+    const CPLStringList aosParams(CSLTokenizeString2(pszQuery + 1, "&", 0));
+    bool bHasAzureSAS = false;
+    for (const char *pszParam : aosParams)
+    {
+        if (STARTS_WITH(pszParam, "sig="))
+            bHasAzureSAS = true;
+    }
+    bool bFirst = true;
+    for (const char *pszParam : aosParams)
+    {
+        const char *pszEqual = strchr(pszParam, '=');
+        const std::string osName(pszParam, pszEqual ? pszEqual - pszParam
+                                                    : strlen(pszParam));
+        bool bVolatile = false;
+        for (const char *pszVolatileParam : apszVolatileParams)
+        {
+            if (EQUAL(osName.c_str(), pszVolatileParam))
+            {
+                bVolatile = true;
+                break;
+            }
+        }
+        for (const char *pszSASParam : apszAzureSASParams)
+        {
+            if (bHasAzureSAS && osName == pszSASParam)
+            {
+                bVolatile = true;
+                break;
+            }
+        }
+        if (!bVolatile)
+        {
+            osURL += bFirst ? '?' : '&';
+            osURL += pszParam;
+            bFirst = false;
+        }
+    }
+    return osURL;
+}
+
+/************************************************************************/
+/*                VSICurlPersistentCacheGetFilename()                   */
+/************************************************************************/
+
+static std::string
+VSICurlPersistentCacheGetFilename(const std::string &osDir,
+                                  const GByte abyKeyHash[CPL_SHA256_HASH_SIZE],
+                                  vsi_l_offset nOffset)
+{
+    GByte abyData[CPL_SHA256_HASH_SIZE + sizeof(GUInt64)];
+    memcpy(abyData, abyKeyHash, CPL_SHA256_HASH_SIZE);
+    GUInt64 nOffset64 = static_cast<GUInt64>(nOffset);
+    CPL_LSBPTR64(&nOffset64);
+    memcpy(abyData + CPL_SHA256_HASH_SIZE, &nOffset64, sizeof(nOffset64));
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(abyData, sizeof(abyData), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osHex(pszHex);
+    CPLFree(pszHex);
+    // Sub-directory named after the first byte of the hash.
+    const std::string osSubDir(
+        CPLFormFilename(osDir.c_str(), osHex.substr(0, 2).c_str(), nullptr));
+    return CPLFormFilename(osSubDir.c_str(), osHex.c_str(),
+                           PERSISTENT_CACHE_EXT + 1);
+}
+
+/************************************************************************/
+/*                    VSICurlPersistentCacheGet()                       */
+/************************************************************************/
+
+static bool VSICurlPersistentCacheGet(const std::string &osKey,
+                                      vsi_l_offset nOffset, std::string &osData)
+{
+    const std::string osDir(VSICurlPersistentCacheGetDir());
+    if (osDir.empty() || osKey.empty())
+        return false;
+    GByte abyKeyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyKeyHash);
+    const std::string osFilename(
+        VSICurlPersistentCacheGetFilename(osDir, abyKeyHash, nOffset));
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb+");
+    if (fp == nullptr)
+        return false;
+
+    bool bOK = false;
+    char szMagic[PERSISTENT_CACHE_MAGIC_SIZE] = {};
+    GUInt64 nLastAccess = 0;
+    GUInt64 nStoredOffset = 0;
+    GUInt64 nSize = 0;
+    GByte abyStoredKeyHash[CPL_SHA256_HASH_SIZE] = {};
+    if (VSIFReadL(szMagic, 1, sizeof(szMagic), fp) == sizeof(szMagic) &&
+        memcmp(szMagic, PERSISTENT_CACHE_MAGIC, sizeof(szMagic)) == 0 &&
+        VSIFReadL(&nLastAccess, sizeof(nLastAccess), 1, fp) == 1 &&
+        VSIFReadL(&nStoredOffset, sizeof(nStoredOffset), 1, fp) == 1 &&
+        VSIFReadL(&nSize, sizeof(nSize), 1, fp) == 1 &&
+        VSIFReadL(abyStoredKeyHash, sizeof(abyStoredKeyHash), 1, fp) == 1)
+    {
+        CPL_LSBPTR64(&nStoredOffset);
+        CPL_LSBPTR64(&nSize);
+        // Check that the entry is the expected one.
+        if (nStoredOffset == nOffset &&
+            memcmp(abyStoredKeyHash, abyKeyHash, CPL_SHA256_HASH_SIZE) == 0 &&
+            nSize <= static_cast<GUInt64>(INT_MAX))
+        {
+            try
+            {
+                osData.resize(static_cast<size_t>(nSize));
+                bOK = VSIFReadL(&osData[0], 1, osData.size(), fp) ==
+                      osData.size();
+            }
+            catch (const std::exception &)
+            {
+            }
+        }
+    }
+
+    if (bOK)
+    {
+        // Update the last access time. This also updates the modification
+        // time of the file, used for LRU eviction.
+        nLastAccess = static_cast<GUInt64>(time(nullptr));
+        CPL_LSBPTR64(&nLastAccess);
+        if (VSIFSeekL(fp, PERSISTENT_CACHE_MAGIC_SIZE, SEEK_SET) == 0)
+            CPL_IGNORE_RET_VAL(
+                VSIFWriteL(&nLastAccess, sizeof(nLastAccess), 1, fp));
+    }
+    else
+    {
+        osData.clear();
+    }
+    VSIFCloseL(fp);
+    return bOK;
+}
+
+/************************************************************************/
+/*                   VSICurlPersistentCacheEvict()                      */
+/************************************************************************/
+
+// Must be called with goPersistentCacheMutex held.
+static void VSICurlPersistentCacheEvict(const std::string &osDir)
+{
+    const GIntBig nMaxSize = std::max(
+        static_cast<GIntBig>(0),
+        CPLAtoGIntBig(CPLGetConfigOption("CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE",
+                                         "1073741824")));
+
+    struct Entry
+    {
+        std::string osFilename;
+        time_t nMTime;
+        GIntBig nSize;
+    };
+    std::vector<Entry> aoEntries;
+    GIntBig nTotalSize = 0;
+    const time_t nNow = time(nullptr);
+    const CPLStringList aosFiles(VSIReadDirRecursive(osDir.c_str()));
+    for (const char *pszFile : aosFiles)
+    {
+        const char *pszExtension = CPLGetExtension(pszFile);
+        // Temporary files are named {entry}.gdalvcc.{pid}.{tid}.tmp
+        const bool bIsTmp = EQUAL(pszExtension, "tmp") &&
+                            strstr(pszFile, PERSISTENT_CACHE_EXT) != nullptr;
+        if (!bIsTmp && !EQUAL(pszExtension, PERSISTENT_CACHE_EXT + 1))
+            continue;
+        Entry oEntry;
+        oEntry.osFilename = CPLFormFilename(osDir.c_str(), pszFile, nullptr);
+        VSIStatBufL sStat;
+        if (VSIStatL(oEntry.osFilename.c_str(), &sStat) != 0)
+            continue;
+        // Remove temporary files left behind by crashed writers.
+        if (bIsTmp && sStat.st_mtime + PERSISTENT_CACHE_STALE_TMP_DELAY < nNow)
+        {
+            VSIUnlink(oEntry.osFilename.c_str());
+            continue;
+        }
+        oEntry.nMTime = sStat.st_mtime;
+        oEntry.nSize = static_cast<GIntBig>(sStat.st_size);
+        nTotalSize += oEntry.nSize;
+        // Temporary files being written are accounted, but not evicted.
+        if (!bIsTmp)
+            aoEntries.emplace_back(std::move(oEntry));
+    }
+
+    if (nTotalSize > nMaxSize)
+    {
+        // Remove least recently used entries until we are at 90% of the
+        // maximum size, to avoid evicting on each new entry.
+        std::sort(aoEntries.begin(), aoEntries.end(),
+                  [](const Entry &a, const Entry &b)
+                  { return a.nMTime < b.nMTime; });
+        const GIntBig nTargetSize = nMaxSize / 10 * 9;
+        for (const auto &oEntry : aoEntries)
+        {
+            if (nTotalSize <= nTargetSize)
+                break;
+            // Might fail if another process removed it concurrently.
+            VSIUnlink(oEntry.osFilename.c_str());
+            nTotalSize -= oEntry.nSize;
+        }
+    }
+}
+
+/************************************************************************/
+/*                    VSICurlPersistentCachePut()                       */
+/************************************************************************/
+
+static void VSICurlPersistentCachePut(const std::string &osKey,
+                                      vsi_l_offset nOffset, const char *pData,
+                                      size_t nSize)
+{
+    const std::string osDir(VSICurlPersistentCacheGetDir());
+    if (osDir.empty() || osKey.empty())
+        return;
+
+    GByte abyKeyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyKeyHash);
+    const std::string osFilename(
+        VSICurlPersistentCacheGetFilename(osDir, abyKeyHash, nOffset));
+    // Unique name among processes and threads.
+    const std::string osTmpFilename(
+        CPLSPrintf("%s.%d." CPL_FRMT_GIB ".tmp", osFilename.c_str(),
+                   CPLGetCurrentProcessID(), CPLGetPID()));
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        // Only accessible by the current user, as the cached content may
+        // come from authenticated requests.
+        VSIMkdirRecursive(CPLGetPath(osFilename.c_str()), 0700);
+        fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+        if (fp == nullptr)
+        {
+            CPLDebug("VSICURL", "Cannot create %s", osTmpFilename.c_str());
+            return;
+        }
+    }
+
+    GUInt64 nLastAccess = static_cast<GUInt64>(time(nullptr));
+    GUInt64 nOffset64 = static_cast<GUInt64>(nOffset);
+    GUInt64 nSize64 = static_cast<GUInt64>(nSize);
+    CPL_LSBPTR64(&nLastAccess);
+    CPL_LSBPTR64(&nOffset64);
+    CPL_LSBPTR64(&nSize64);
+    bool bOK =
+        VSIFWriteL(PERSISTENT_CACHE_MAGIC, 1, PERSISTENT_CACHE_MAGIC_SIZE,
+                   fp) == PERSISTENT_CACHE_MAGIC_SIZE &&
+        VSIFWriteL(&nLastAccess, sizeof(nLastAccess), 1, fp) == 1 &&
+        VSIFWriteL(&nOffset64, sizeof(nOffset64), 1, fp) == 1 &&
+        VSIFWriteL(&nSize64, sizeof(nSize64), 1, fp) == 1 &&
+        VSIFWriteL(abyKeyHash, sizeof(abyKeyHash), 1, fp) == 1 &&
+        VSIFWriteL(pData, 1, nSize, fp) == nSize;
+    bOK &= VSIFCloseL(fp) == 0;
+    if (!bOK || VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    // Scan the cache directory at first use, and then each time 10% of
+    // its maximum size has been written.
+    std::lock_guard<std::mutex> oLock(goPersistentCacheMutex);
+    const GIntBig nMaxSize =
+        CPLAtoGIntBig(CPLGetConfigOption("CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE",
+                                         "1073741824"));
+    if (gnPersistentCacheBytesWrittenSinceLastScan < 0 ||
+        gnPersistentCacheBytesWrittenSinceLastScan >= nMaxSize / 10)
+    {
+        VSICurlPersistentCacheEvict(osDir);
+        gnPersistentCacheBytesWrittenSinceLastScan = 0;
+    }
+    gnPersistentCacheBytesWrittenSinceLastScan += static_cast<GIntBig>(nSize);
+}
+
 /************************************************************************/
 /*          VSICurlFindStringSensitiveExceptEscapeSequences()           */
 /************************************************************************/
@@ -414,8 +756,31 @@ VSICurlHandle::VSICurlHandle(VSICurlFilesystemHandlerBase *poFSIn,
       m_dfRetryDelay(CPLAtof(CPLGetConfigOption(
           "GDAL_HTTP_RETRY_DELAY", CPLSPrintf("%f", CPL_HTTP_RETRY_DELAY)))),
       m_bUseHead(
-          CPLTestBool(CPLGetConfigOption("CPL_VSIL_CURL_USE_HEAD", "YES")))
+          CPLTestBool(CPLGetConfigOption("CPL_VSIL_CURL_USE_HEAD", "YES"))),
+      m_bReadAhead(
+          CPLTestBool(CPLGetConfigOption("CPL_VSIL_CURL_READ_AHEAD", "NO")))
 {
+    const char *pszReadAheadMaxSize =
+        CPLGetConfigOption("CPL_VSIL_CURL_READ_AHEAD_MAX_SIZE", nullptr);
+    if (pszReadAheadMaxSize)
+    {
+        const GIntBig nMaxBlocks = CPLAtoGIntBig(pszReadAheadMaxSize) /
+                                   VSICURLGetDownloadChunkSize();
+        m_nMaxBlocksToDownload = static_cast<int>(
+            std::max<GIntBig>(1, std::min<GIntBig>(nMaxBlocks, INT_MAX / 2)));
+    }
+
+    m_nParallelReadCount = std::max(
+        1, atoi(CPLGetConfigOption("CPL_VSIL_CURL_PARALLEL_READ_COUNT", "8")));
+    const GIntBig nParallelReadMinSize = CPLAtoGIntBig(CPLGetConfigOption(
+        "CPL_VSIL_CURL_PARALLEL_READ_MIN_SIZE", "16777216"));
+    if (nParallelReadMinSize > 0 &&
+        static_cast<GUIntBig>(nParallelReadMinSize) <
+            std::numeric_limits<size_t>::max())
+    {
+        m_nParallelReadMinSize = static_cast<size_t>(nParallelReadMinSize);
+    }
+
     m_papszHTTPOptions = CPLHTTPGetOptionsFromEnv(pszFilename);
     if (pszURLIn)
     {
@@ -448,6 +813,10 @@ VSICurlHandle::~VSICurlHandle()
     {
         m_oThreadAdviseRead.join();
     }
+    if (m_oThreadReadAhead.joinable())
+    {
+        m_oThreadReadAhead.join();
+    }
 
     if (!m_bCached)
     {
@@ -1959,6 +2328,38 @@ void VSICurlHandle::UpdateRedirectInfo(
     }
 }
 
+/************************************************************************/
+/*                      GetPersistentCacheKey()                         */
+/************************************************************************/
+
+// Return the key identifying the content of the file in the persistent
+// cache, or an empty string if the persistent cache is disabled or the
+// content of the file cannot be identified.
+std::string VSICurlHandle::GetPersistentCacheKey() const
+{
+    if (!m_bCached || VSICurlPersistentCacheGetDir().empty())
+        return std::string();
+
+    std::string osKey(VSICurlPersistentCacheStripURL(m_pszURL));
+    if (!oFileProp.ETag.empty())
+    {
+        osKey += "\netag:";
+        osKey += oFileProp.ETag;
+    }
+    else if (oFileProp.bHasComputedFileSize && oFileProp.mTime > 0)
+    {
+        osKey += CPLSPrintf("\nsize:" CPL_FRMT_GUIB ",mtime:" CPL_FRMT_GIB,
+                            static_cast<GUIntBig>(oFileProp.fileSize),
+                            static_cast<GIntBig>(oFileProp.mTime));
+    }
+    else
+    {
+        return std::string();
+    }
+    osKey += CPLSPrintf("\nchunk:%d", VSICURLGetDownloadChunkSize());
+    return osKey;
+}
+
 /************************************************************************/
 /*                      DownloadRegionPostProcess()                     */
 /************************************************************************/
@@ -1980,6 +2381,7 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
                 static_cast<unsigned int>(nBlocks * knDOWNLOAD_CHUNK_SIZE));
     }
 
+    const std::string osPersistentCacheKey(GetPersistentCacheKey());
     vsi_l_offset l_startOffset = startOffset;
     while (nSize > 0)
     {
@@ -1993,6 +2395,11 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
         const size_t nChunkSize =
             std::min(static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE), nSize);
         poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer);
+        if (!osPersistentCacheKey.empty())
+        {
+            VSICurlPersistentCachePut(osPersistentCacheKey, l_startOffset,
+                                      pBuffer, nChunkSize);
+        }
         l_startOffset += nChunkSize;
         pBuffer += nChunkSize;
         nSize -= nChunkSize;
@@ -2024,6 +2431,7 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
     vsi_l_offset iterOffset = curOffset;
     const int knMAX_REGIONS = GetMaxRegions();
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    bool bSequentialRead = false;
     while (nBufferRequestSize)
     {
         // Don't try to read after end of file.
@@ -2045,10 +2453,73 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
         std::string osRegion;
         std::shared_ptr<std::string> psRegion =
             poFS->GetRegion(m_pszURL, nOffsetToDownload);
+        if (psRegion == nullptr && m_oThreadReadAhead.joinable())
+        {
+            // Wait for the pending read-ahead, which may have fetched
+            // the region we need.
+            if (WaitReadAhead() && nOffsetToDownload >= m_nReadAheadOffset &&
+                nOffsetToDownload < lastDownloadedOffset)
+            {
+                psRegion = poFS->GetRegion(m_pszURL, nOffsetToDownload);
+                bSequentialRead = true;
+            }
+        }
         if (psRegion != nullptr)
         {
             osRegion = *psRegion;
         }
+        else if (VSICurlPersistentCacheGet(GetPersistentCacheKey(),
+                                           nOffsetToDownload, osRegion))
+        {
+            poFS->AddRegion(m_pszURL, nOffsetToDownload, osRegion.size(),
+                            osRegion.data());
+        }
+        else if (nBufferRequestSize >= m_nParallelReadMinSize &&
+                 m_nParallelReadCount > 1 && oFileProp.bHasComputedFileSize &&
+                 CanUseRangeRequests())
+        {
+            // Large read: split it into several ranges that are downloaded
+            // concurrently, directly into the user buffer, bypassing the
+            // region cache.
+            const size_t nToRead = static_cast<size_t>(std::min(
+                static_cast<vsi_l_offset>(nBufferRequestSize),
+                oFileProp.fileSize - iterOffset));
+            size_t nPartSize = (nToRead + m_nParallelReadCount - 1) /
+                               m_nParallelReadCount;
+            nPartSize = ((nPartSize + knDOWNLOAD_CHUNK_SIZE - 1) /
+                         knDOWNLOAD_CHUNK_SIZE) *
+                        knDOWNLOAD_CHUNK_SIZE;
+            std::vector<void *> apData;
+            std::vector<vsi_l_offset> anOffsets;
+            std::vector<size_t> anSizes;
+            for (size_t nPos = 0; nPos < nToRead; nPos += nPartSize)
+            {
+                apData.push_back(static_cast<char *>(pBuffer) + nPos);
+                anOffsets.push_back(iterOffset + nPos);
+                anSizes.push_back(std::min(nPartSize, nToRead - nPos));
+            }
+            if (ENABLE_DEBUG)
+                CPLDebug(poFS->GetDebugKey(),
+                         "Reading " CPL_FRMT_GUIB " bytes with %d parallel "
+                         "requests",
+                         static_cast<GUIntBig>(nToRead),
+                         static_cast<int>(anOffsets.size()));
+            if (ReadMultiRangeParallel(static_cast<int>(anOffsets.size()),
+                                       apData.data(), anOffsets.data(),
+                                       anSizes.data(), false) != 0)
+            {
+                if (!bInterrupted)
+                    bEOF = true;
+                return 0;
+            }
+            pBuffer = static_cast<char *>(pBuffer) + nToRead;
+            iterOffset += nToRead;
+            nBufferRequestSize -= nToRead;
+            // So that a subsequent read is considered as sequential
+            lastDownloadedOffset =
+                (iterOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+            continue;
+        }
         else
         {
             if (nOffsetToDownload == lastDownloadedOffset)
@@ -2057,8 +2528,10 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
                 // heuristic that we will read the file sequentially, so
                 // we double the requested size to decrease the number of
                 // client/server roundtrips.
-                if (nBlocksToDownload < 100)
-                    nBlocksToDownload *= 2;
+                if (nBlocksToDownload < m_nMaxBlocksToDownload)
+                    nBlocksToDownload = std::min(nBlocksToDownload * 2,
+                                                 m_nMaxBlocksToDownload);
+                bSequentialRead = true;
             }
             else
             {
@@ -2137,9 +2610,163 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
 
     curOffset = iterOffset;
 
+    // Fetch the next region in the background while the caller processes
+    // the data it just got.
+    if (bSequentialRead && m_bReadAhead && !bEOF)
+        StartReadAhead();
+
     return ret;
 }
 
+/************************************************************************/
+/*                          StartReadAhead()                            */
+/************************************************************************/
+
+// Launch in a background thread the download of the blocks that follow
+// lastDownloadedOffset. The thread only works on its own curl handle and
+// on m_osReadAheadData, so that the handle state is only modified by
+// WaitReadAhead() in the calling thread.
+void VSICurlHandle::StartReadAhead()
+{
+    if (m_oThreadReadAhead.joinable() || !m_bCached || !CanUseRangeRequests() ||
+        (bInterrupted && bStopOnInterruptUntilUninstall))
+        return;
+
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if (oFileProp.eExists == EXIST_NO || !oFileProp.bHasComputedFileSize ||
+        lastDownloadedOffset >= oFileProp.fileSize)
+        return;
+
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    const vsi_l_offset nStartOffset = lastDownloadedOffset;
+    if (poFS->GetRegion(m_pszURL, nStartOffset) != nullptr)
+        return;
+
+    if (nBlocksToDownload < m_nMaxBlocksToDownload)
+        nBlocksToDownload =
+            std::min(nBlocksToDownload * 2, m_nMaxBlocksToDownload);
+    int nBlocks = std::min(nBlocksToDownload, GetMaxRegions());
+    const vsi_l_offset nRemainingBlocks =
+        (oFileProp.fileSize - nStartOffset + knDOWNLOAD_CHUNK_SIZE - 1) /
+        knDOWNLOAD_CHUNK_SIZE;
+    if (static_cast<vsi_l_offset>(nBlocks) > nRemainingBlocks)
+        nBlocks = static_cast<int>(nRemainingBlocks);
+    // Stop before blocks that are already cached
+    for (int i = 1; i < nBlocks; i++)
+    {
+        if (poFS->GetRegion(m_pszURL, nStartOffset +
+                                          i * knDOWNLOAD_CHUNK_SIZE) != nullptr)
+        {
+            nBlocks = i;
+            break;
+        }
+    }
+    const size_t nExpectedSize = static_cast<size_t>(
+        std::min<vsi_l_offset>(oFileProp.fileSize - nStartOffset,
+                               static_cast<vsi_l_offset>(nBlocks) *
+                                   knDOWNLOAD_CHUNK_SIZE));
+
+    ManagePlanetaryComputerSigning();
+
+    bool bHasExpired = false;
+    const CPLString osURL(GetRedirectURLIfValid(bHasExpired));
+    if (bHasExpired)
+        return;
+
+    CURL *hCurlHandle = curl_easy_init();
+    struct curl_slist *headers =
+        VSICurlSetOptions(hCurlHandle, osURL, m_papszHTTPOptions);
+    if (!AllowAutomaticRedirection())
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_FOLLOWLOCATION, 0);
+
+    char rangeStr[512] = {};
+    snprintf(rangeStr, sizeof(rangeStr), CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+             nStartOffset, nStartOffset + nExpectedSize - 1);
+    if (STARTS_WITH(m_pszURL, "http"))
+    {
+        CPLString osHeaderRange;
+        osHeaderRange.Printf("Range: bytes=%s", rangeStr);
+        // So it gets included in Azure signature
+        headers = curl_slist_append(headers, osHeaderRange.c_str());
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, nullptr);
+    }
+    else
+    {
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, rangeStr);
+    }
+    headers = VSICurlMergeHeaders(headers, GetCurlHeaders("GET", headers));
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
+
+    if (ENABLE_DEBUG)
+        CPLDebug(poFS->GetDebugKey(), "Reading ahead %s (%s)...", rangeStr,
+                 osURL.c_str());
+
+    m_nReadAheadOffset = nStartOffset;
+    m_nReadAheadBlocks = nBlocks;
+    m_osReadAheadData.clear();
+
+    const std::string osFSPrefix(poFS->GetFSPrefix());
+    const auto task = [this, hCurlHandle, headers, nExpectedSize, osFSPrefix]()
+    {
+        NetworkStatisticsFileSystem oContextFS(osFSPrefix.c_str());
+        NetworkStatisticsFile oContextFile(m_osFilename);
+        NetworkStatisticsAction oContextAction("ReadAhead");
+
+        WriteFuncStruct sWriteFuncData;
+        VSICURLInitWriteFuncStruct(&sWriteFuncData, nullptr, nullptr, nullptr);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA,
+                                   &sWriteFuncData);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
+                                   VSICurlHandleWriteFunc);
+
+        CURLM *hMultiHandle = curl_multi_init();
+        MultiPerform(hMultiHandle, hCurlHandle);
+
+        long response_code = 0;
+        curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
+
+        // Be conservative: anything else than a complete partial response
+        // is discarded, and Read() will go through DownloadRegion() that
+        // knows how to deal with errors and retries.
+        if ((response_code == 206 || response_code == 225) &&
+            sWriteFuncData.nSize == nExpectedSize)
+        {
+            m_osReadAheadData.assign(sWriteFuncData.pBuffer,
+                                     sWriteFuncData.nSize);
+        }
+        NetworkStatisticsLogger::LogGET(sWriteFuncData.nSize);
+
+        curl_multi_remove_handle(hMultiHandle, hCurlHandle);
+        VSICURLResetHeaderAndWriterFunctions(hCurlHandle);
+        curl_easy_cleanup(hCurlHandle);
+        curl_multi_cleanup(hMultiHandle);
+        CPLFree(sWriteFuncData.pBuffer);
+        curl_slist_free_all(headers);
+    };
+    m_oThreadReadAhead = std::thread(task);
+}
+
+/************************************************************************/
+/*                           WaitReadAhead()                            */
+/************************************************************************/
+
+// Wait for the pending read-ahead to complete and store its result in the
+// region cache. Returns true if data was obtained.
+bool VSICurlHandle::WaitReadAhead()
+{
+    if (!m_oThreadReadAhead.joinable())
+        return false;
+    m_oThreadReadAhead.join();
+    if (m_osReadAheadData.empty())
+        return false;
+
+    DownloadRegionPostProcess(m_nReadAheadOffset, m_nReadAheadBlocks,
+                              m_osReadAheadData.data(),
+                              m_osReadAheadData.size());
+    m_osReadAheadData.clear();
+    return true;
+}
+
 /************************************************************************/
 /*                           ReadMultiRange()                           */
 /************************************************************************/
@@ -2173,6 +2800,26 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                                                 panSizes);
     }
 
+    const bool bMergeConsecutiveRanges = CPLTestBool(
+        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+
+    return ReadMultiRangeParallel(nRanges, ppData, panOffsets, panSizes,
+                                  bMergeConsecutiveRanges);
+}
+
+/************************************************************************/
+/*                       ReadMultiRangeParallel()                       */
+/************************************************************************/
+
+// Issue one GET request per range (or group of consecutive ranges if
+// bMergeConsecutiveRanges is set), all running concurrently on the
+// multi handle.
+int VSICurlHandle::ReadMultiRangeParallel(int const nRanges,
+                                          void **const ppData,
+                                          const vsi_l_offset *const panOffsets,
+                                          const size_t *const panSizes,
+                                          bool bMergeConsecutiveRanges)
+{
     ManagePlanetaryComputerSigning();
 
     bool bHasExpired = false;
@@ -2210,9 +2857,6 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     };
     std::vector<CurlErrBuffer> asCurlErrors(nRanges);
 
-    const bool bMergeConsecutiveRanges = CPLTestBool(
-        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
-
     for (int i = 0, iRequest = 0; i < nRanges;)
     {
         size_t nSize = 0;
@@ -3795,6 +4439,24 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='CPL_VSIL_CURL_CACHE_SIZE' type='integer' "                \
     "description='Size in bytes of the global /vsicurl/ cache' "               \
     "default='16384000'/>"                                                     \
+    "  <Option name='CPL_VSIL_CURL_PERSISTENT_CACHE_DIR' type='string' "       \
+    "description='Directory where to persist downloaded content across "       \
+    "processes'/>"                                                             \
+    "  <Option name='CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE' type='integer' "     \
+    "description='Maximum size in bytes of the persistent cache' "             \
+    "default='1073741824'/>"                                                   \
+    "  <Option name='CPL_VSIL_CURL_READ_AHEAD' type='boolean' "                \
+    "description='Whether to fetch the next region in the background when "    \
+    "a file is read sequentially' default='NO'/>"                              \
+    "  <Option name='CPL_VSIL_CURL_READ_AHEAD_MAX_SIZE' type='integer' "       \
+    "description='Maximum size in bytes of a single request when a file "      \
+    "is read sequentially' default='2097152'/>"                                \
+    "  <Option name='CPL_VSIL_CURL_PARALLEL_READ_MIN_SIZE' type='integer' "    \
+    "description='Minimum size in bytes of a read to be split into "           \
+    "concurrent range requests' default='16777216'/>"                          \
+    "  <Option name='CPL_VSIL_CURL_PARALLEL_READ_COUNT' type='integer' "       \
+    "description='Number of concurrent range requests used for large "         \
+    "reads. 1 to disable' default='8'/>"                                       \
     "  <Option name='CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE' type='boolean' "    \
     "description='Whether to skip files with Glacier storage class in "        \
     "directory listing.' default='YES'/>"
@@ -370,6 +370,9 @@ class VSICurlHandle : public VSIVirtualHandle
 
     vsi_l_offset lastDownloadedOffset = VSI_L_OFFSET_MAX;
     int nBlocksToDownload = 1;
+    int m_nMaxBlocksToDownload = 128;
+    size_t m_nParallelReadMinSize = 16 * 1024 * 1024;
+    int m_nParallelReadCount = 8;
 
     bool bStopOnInterruptUntilUninstall = false;
     bool bInterrupted = false;
@@ -385,6 +388,8 @@ class VSICurlHandle : public VSIVirtualHandle
                                    const int nBlocks, const char *pBuffer,
                                    size_t nSize);
 
+    std::string GetPersistentCacheKey() const;
+
   private:
     vsi_l_offset curOffset = 0;
 
@@ -404,6 +409,10 @@ class VSICurlHandle : public VSIVirtualHandle
     int ReadMultiRangeSingleGet(int nRanges, void **ppData,
                                 const vsi_l_offset *panOffsets,
                                 const size_t *panSizes);
+    int ReadMultiRangeParallel(int nRanges, void **ppData,
+                               const vsi_l_offset *panOffsets,
+                               const size_t *panSizes,
+                               bool bMergeConsecutiveRanges);
     CPLString GetRedirectURLIfValid(bool &bHasExpired) const;
 
     void UpdateRedirectInfo(CURL *hCurlHandle,
@@ -422,6 +431,15 @@ class VSICurlHandle : public VSIVirtualHandle
     std::vector<std::unique_ptr<AdviseReadRange>> m_aoAdviseReadRanges{};
     std::thread m_oThreadAdviseRead{};
 
+    // Used by the sequential read-ahead
+    bool m_bReadAhead = false;
+    vsi_l_offset m_nReadAheadOffset = 0;
+    int m_nReadAheadBlocks = 0;
+    std::string m_osReadAheadData{};
+    std::thread m_oThreadReadAhead{};
+    void StartReadAhead();
+    bool WaitReadAhead();
+
   protected:
     virtual struct curl_slist *
     GetCurlHeaders(const CPLString & /*osVerb*/,
@@ -441,6 +459,10 @@ class VSICurlHandle : public VSIVirtualHandle
     {
         return false;
     }
+    virtual bool CanUseRangeRequests()
+    {
+        return true;
+    }
     virtual bool IsDirectoryFromExists(const char * /*pszVerb*/,
                                        int /*response_code*/)
     {
@@ -138,6 +138,12 @@ class VSIWebHDFSHandle final : public VSICurlHandle
 
     std::string DownloadRegion(vsi_l_offset startOffset, int nBlocks) override;
 
+    bool CanUseRangeRequests() override
+    {
+        // Ranges are requested through WebHDFS specific query parameters
+        return false;
+    }
+
   public:
     VSIWebHDFSHandle(VSIWebHDFSFSHandler *poFS, const char *pszFilename,
                      const char *pszURL);